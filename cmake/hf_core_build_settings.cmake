@@ -194,6 +194,11 @@ if(NOT DEFINED HF_CORE_ENABLE_VORTEX_DRIVER)
     set(HF_CORE_ENABLE_VORTEX_DRIVER OFF)
 endif()
 
+# ── I/O expander pin wrappers: inline pool instead of heap (PCAL95555, PCA9685)
+if(NOT DEFINED HF_CORE_EXPANDER_PIN_POOL)
+    set(HF_CORE_EXPANDER_PIN_POOL OFF)
+endif()
+
 # ── Logger (almost always needed) ─────────────────────────────────────────
 if(NOT DEFINED HF_CORE_ENABLE_LOGGER)
     set(HF_CORE_ENABLE_LOGGER ON)
@@ -482,7 +487,8 @@ endif()
 if(HF_CORE_ENABLE_ADS7952)
     include("${HF_CORE_DRIVER_EXT}/hf-ads7952-driver/cmake/hf_ads7952_build_settings.cmake")
     list(APPEND HF_CORE_HANDLER_SOURCES
-        "${HF_CORE_HANDLER_ROOT}/ads7952/Ads7952Handler.cpp")
+        "${HF_CORE_HANDLER_ROOT}/ads7952/Ads7952Handler.cpp"
+        "${HF_CORE_HANDLER_ROOT}/ads7952/Ads7952ScanGroup.cpp")
     list(APPEND HF_CORE_EXT_DRIVER_INCLUDE_DIRS ${HF_ADS7952_PUBLIC_INCLUDE_DIRS})
     list(APPEND HF_CORE_EXT_DRIVER_SOURCES      ${HF_ADS7952_SOURCE_FILES})
 endif()
@@ -509,7 +515,8 @@ endif()
 if(HF_CORE_ENABLE_NTC_THERMISTOR)
     include("${HF_CORE_DRIVER_EXT}/hf-ntc-thermistor-driver/cmake/hf_ntc_thermistor_build_settings.cmake")
     list(APPEND HF_CORE_HANDLER_SOURCES
-        "${HF_CORE_HANDLER_ROOT}/ntc/NtcTemperatureHandler.cpp")
+        "${HF_CORE_HANDLER_ROOT}/ntc/NtcTemperatureHandler.cpp"
+        "${HF_CORE_HANDLER_ROOT}/ntc/NtcThermistorBank.cpp")
     list(APPEND HF_CORE_EXT_DRIVER_INCLUDE_DIRS ${HF_NTC_THERMISTOR_PUBLIC_INCLUDE_DIRS})
     list(APPEND HF_CORE_EXT_DRIVER_SOURCES      ${HF_NTC_THERMISTOR_SOURCE_FILES})
 endif()
@@ -523,6 +530,12 @@ if(HF_CORE_ENABLE_MCP9700)
     list(APPEND HF_CORE_EXT_DRIVER_SOURCES      ${HF_MCP9700_SOURCE_FILES})
 endif()
 
+# ── Shared temperature sampling scheduler (used by NTC / MCP9700) ──────────
+if(HF_CORE_ENABLE_NTC_THERMISTOR OR HF_CORE_ENABLE_MCP9700)
+    list(APPEND HF_CORE_HANDLER_SOURCES
+        "${HF_CORE_HANDLER_ROOT}/common/TemperatureSamplingScheduler.cpp")
+endif()
+
 # ── Alicat BASIS-2 mass-flow meter / controller (UART Modbus-RTU) ──────────
 if(HF_CORE_ENABLE_ALICAT_BASIS2)
     include("${HF_CORE_DRIVER_EXT}/hf-alicat-basis2-driver/cmake/hf_alicat_basis2_build_settings.cmake")
@@ -557,7 +570,9 @@ endif()
 if(HF_CORE_ENABLE_PCA9685)
     include("${HF_CORE_DRIVER_EXT}/hf-pca9685-driver/cmake/hf_pca9685_build_settings.cmake")
     list(APPEND HF_CORE_HANDLER_SOURCES
-        "${HF_CORE_HANDLER_ROOT}/pca9685/Pca9685Handler.cpp")
+        "${HF_CORE_HANDLER_ROOT}/pca9685/Pca9685Handler.cpp"
+        "${HF_CORE_HANDLER_ROOT}/pca9685/Pca9685ServoTrajectory.cpp"
+    )
     list(APPEND HF_CORE_EXT_DRIVER_INCLUDE_DIRS ${HF_PCA9685_PUBLIC_INCLUDE_DIRS})
     list(APPEND HF_CORE_EXT_DRIVER_SOURCES      ${HF_PCA9685_SOURCE_FILES})
 endif()
@@ -575,7 +590,9 @@ endif()
 if(HF_CORE_ENABLE_PCAL95555)
     include("${HF_CORE_DRIVER_EXT}/hf-pcal95555-driver/cmake/hf_pcal95555_build_settings.cmake")
     list(APPEND HF_CORE_HANDLER_SOURCES
-        "${HF_CORE_HANDLER_ROOT}/pcal95555/Pcal95555Handler.cpp")
+        "${HF_CORE_HANDLER_ROOT}/pcal95555/Pcal95555Handler.cpp"
+        "${HF_CORE_HANDLER_ROOT}/pcal95555/Pcal95555InterruptAggregator.cpp"
+    )
     list(APPEND HF_CORE_EXT_DRIVER_INCLUDE_DIRS ${HF_PCAL95555_PUBLIC_INCLUDE_DIRS})
     list(APPEND HF_CORE_EXT_DRIVER_SOURCES      ${HF_PCAL95555_SOURCE_FILES})
 endif()
@@ -912,6 +929,9 @@ endif()
 if(HF_CORE_ENABLE_WS2812)
     list(APPEND HF_CORE_COMPILE_DEFINITIONS HARDFOC_WS2812_SUPPORT=1)
 endif()
+if(HF_CORE_EXPANDER_PIN_POOL)
+    list(APPEND HF_CORE_COMPILE_DEFINITIONS HARDFOC_EXPANDER_PIN_POOL=1)
+endif()
 if(HF_CORE_ENABLE_LOGGER)
     list(APPEND HF_CORE_COMPILE_DEFINITIONS HARDFOC_LOGGER=1)
 endif()
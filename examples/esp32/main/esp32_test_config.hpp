@@ -63,6 +63,20 @@
 #define AS5047U_SPI_CLOCK_HZ 1000000  // 1 MHz
 #endif
 
+// ═══════════════════════════════════════════════════════════════════════════
+// ADS7952 12-CHANNEL ADC (SPI)
+// ═══════════════════════════════════════════════════════════════════════════
+
+#ifndef PIN_ADS7952_CS
+#define PIN_ADS7952_CS 14
+#endif
+#ifndef PIN_ADS7952_CS_2
+#define PIN_ADS7952_CS_2 -1  // Second ADS7952 for the scan-group test (-1 = not fitted)
+#endif
+#ifndef ADS7952_SPI_CLOCK_HZ
+#define ADS7952_SPI_CLOCK_HZ 10000000  // 10 MHz (device max 20 MHz)
+#endif
+
 // ═══════════════════════════════════════════════════════════════════════════
 // BNO08x IMU (I2C)
 // ═══════════════════════════════════════════════════════════════════════════
@@ -103,6 +117,9 @@
 #ifndef PIN_PCAL95555_INT
 #define PIN_PCAL95555_INT 6  // Interrupt output (active-low, optional)
 #endif
+#ifndef PCAL95555_SECOND_I2C_ADDR
+#define PCAL95555_SECOND_I2C_ADDR 0x21  // Optional second expander sharing the INT line (A0=HIGH)
+#endif
 
 // ═══════════════════════════════════════════════════════════════════════════
 // NTC THERMISTOR (ADC)
@@ -0,0 +1,70 @@
+/**
+ * @file gpio_pin_registry_test.hpp
+ * @brief Shared pin-wrapper storage test for I/O expander handlers.
+ *
+ * Pcal95555Handler and Pca9685Handler both keep their pin wrappers in a
+ * GpioPinRegistry whose storage is fixed by HF_CORE_EXPANDER_PIN_POOL.
+ * RunGpioPinRegistryTest() checks, on a live handler, the mode it was built with:
+ * - owning (default): CreateGpioPin() handles co-own the wrapper and survive
+ *   EnsureDeinitialized();
+ * - pooled: creating all 16 wrappers allocates nothing (allocation counter,
+ *   free heap within a tolerance) and handles are non-owning.
+ *
+ * The handler is deinitialized and re-initialized on exit.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright GPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "esp_log.h"
+#include "esp_system.h"
+#ifdef __cplusplus
+}
+#endif
+
+template <typename Handler>
+static bool RunGpioPinRegistryTest(Handler& handler, const char* tag) noexcept {
+    using Pin = std::remove_pointer_t<decltype(handler.GetGpioPinRef(0))>;
+    // Other tasks may allocate meanwhile; one pooled-mode wrapper on the heap would exceed this.
+    constexpr long kHeapToleranceBytes = static_cast<long>(sizeof(Pin));
+    bool ok = handler.EnsureDeinitialized() && handler.EnsureInitialized();
+    const uint32_t allocations_before = handler.GetPinHeapAllocations();
+
+    if constexpr (!Handler::IsPinPoolEnabled()) {
+        // Heap-owned wrappers, co-owned by the shared_ptr handles
+        std::shared_ptr<BaseGpio> owned = handler.CreateGpioPin(0);
+        ok &= owned != nullptr && owned.use_count() >= 2 &&
+              handler.GetPinHeapAllocations() == allocations_before + 1;
+        ok &= handler.EnsureDeinitialized() && owned.use_count() == 1;  // outlives the registry
+        ESP_LOGI(tag, "Pin registry: heap-owned, wrapper %u bytes", static_cast<unsigned>(sizeof(Pin)));
+    } else {
+        // Wrappers constructed in place, handles are non-owning
+        const uint32_t heap_before = esp_get_free_heap_size();
+        for (hf_pin_num_t pin = 0; pin < 16; ++pin) {
+            ok &= (handler.CreateGpioPinRef(pin) != nullptr);
+        }
+        for (hf_pin_num_t pin = 0; pin < 16; ++pin) {
+            auto handle = handler.CreateGpioPin(pin);
+            ok &= (handle.get() == handler.GetGpioPinRef(pin)) && (handle.use_count() == 0);
+        }
+        const long heap_delta = static_cast<long>(heap_before) - static_cast<long>(esp_get_free_heap_size());
+        const uint32_t pooled_allocations = handler.GetPinHeapAllocations() - allocations_before;
+        ok &= pooled_allocations == 0 && heap_delta < kHeapToleranceBytes;
+        ESP_LOGI(tag, "Pin registry: pooled allocations=%lu, heap delta=%ld bytes (tolerance %ld), wrapper %u bytes",
+                 static_cast<unsigned long>(pooled_allocations), heap_delta, kHeapToleranceBytes,
+                 static_cast<unsigned>(sizeof(Pin)));
+    }
+
+    ok &= handler.EnsureDeinitialized() && handler.EnsureInitialized();
+    return ok;
+}
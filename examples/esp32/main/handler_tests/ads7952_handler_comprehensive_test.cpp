@@ -0,0 +1,357 @@
+/**
+ * @file ads7952_handler_comprehensive_test.cpp
+ * @brief Comprehensive test suite for Ads7952Handler and Ads7952ScanGroup
+ *
+ * Tests the ADS7952 12-channel SAR ADC handler through its public API,
+ * exercising the CRTP SPI adapter, the persistent Auto-1/Auto-2 stream and
+ * the multi-device scan group.
+ *
+ * Test Categories:
+ * 1. Initialization & single-channel reads
+ * 2. Streaming: start/stop, back-to-back polls vs. polls after an idle gap
+ *    (stale-frame discard), initial mode restored by StopStreaming()
+ * 3. Burst: decimation counts (0, 2 and clamped extra bits), burst_samples accounting
+ * 4. Multi-channel: ReadMultipleChannels()/burst leave the configured mode in place
+ * 5. Scan group: Start/Snapshot/Stop across members, priming frame per member
+ *
+ * Hardware Required:
+ * - ADS7952 on SPI bus (see esp32_test_config.hpp for pins)
+ * - Optional second ADS7952 (PIN_ADS7952_CS_2 >= 0) for the group sweep
+ * - Inputs tied to a steady voltage (e.g. a divider) for the decimation checks
+ *
+ * @author HardFOC Team
+ * @date 2025-2026
+ * @copyright GPL-3.0-or-later
+ */
+
+#include "TestFramework.h"
+#include "esp32_bus_setup.hpp"
+#include "esp32_test_config.hpp"
+
+// Handler under test
+#include "handlers/ads7952/Ads7952Handler.h"
+#include "handlers/ads7952/Ads7952ScanGroup.h"
+
+#include <cstdlib>
+#include <memory>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#ifdef __cplusplus
+}
+#endif
+
+static const char* TAG = "ADS7952_Handler_Test";
+static TestResults g_test_results;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEST SECTION CONFIGURATION
+// ═══════════════════════════════════════════════════════════════════════════
+
+static constexpr bool ENABLE_INITIALIZATION_TESTS = true;
+static constexpr bool ENABLE_STREAMING_TESTS = true;
+static constexpr bool ENABLE_BURST_TESTS = true;
+static constexpr bool ENABLE_MULTI_CHANNEL_TESTS = true;
+static constexpr bool ENABLE_SCAN_GROUP_TESTS = true;
+
+// Channel sampled by the single-channel and burst checks.
+static constexpr hf_channel_id_t kTestChannel = 0;
+// Channels streamed in Auto-1 mode (CH0..CH3).
+static constexpr uint16_t kStreamMask = 0x000F;
+static constexpr uint32_t kStreamChannels = 4;
+// Per-sample noise allowance (LSB at 12 bits) when comparing separate bursts.
+static constexpr uint32_t kBurstNoiseLsb = 8;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// SHARED RESOURCES
+// ═══════════════════════════════════════════════════════════════════════════
+
+static std::unique_ptr<Ads7952Handler> g_handler;
+static std::unique_ptr<Ads7952Handler> g_second_handler;
+
+// ═══════════════════════════════════════════════════════════════════════════
+// HELPER: CREATE HANDLERS
+// ═══════════════════════════════════════════════════════════════════════════
+
+static std::unique_ptr<Ads7952Handler> create_handler(int cs_pin, uint8_t device_index) noexcept {
+    auto* spi_bus = get_shared_spi_bus();
+    if (!spi_bus) {
+        ESP_LOGE(TAG, "SPI bus not available");
+        return nullptr;
+    }
+
+    // Create SPI device for the ADS7952 with chip-select pin
+    hf_spi_device_config_t dev_cfg = {};
+    dev_cfg.cs_pin = static_cast<hf_pin_num_t>(cs_pin);
+    dev_cfg.clock_speed_hz = ADS7952_SPI_CLOCK_HZ;
+    dev_cfg.mode = hf_spi_mode_t::HF_SPI_MODE_0;  // CPOL=0, CPHA=0 per ADS7952 datasheet
+    dev_cfg.queue_size = 1;
+
+    int dev_idx = spi_bus->CreateDevice(dev_cfg);
+    if (dev_idx < 0) {
+        ESP_LOGE(TAG, "SPI device creation failed for ADS7952 (CS=%d)", cs_pin);
+        return nullptr;
+    }
+    BaseSpi* spi_device = spi_bus->GetDevice(dev_idx);
+    if (!spi_device) {
+        ESP_LOGE(TAG, "SPI device init failed for ADS7952 (CS=%d)", cs_pin);
+        return nullptr;
+    }
+
+    Ads7952HandlerConfig config = GetDefaultAds7952Config();
+    config.auto1_channel_mask = kStreamMask;
+    config.device_index = device_index;
+    return CreateAds7952Handler(*spi_device, config);
+}
+
+static bool stream_frames(Ads7952Handler& handler, uint32_t& frames) noexcept {
+    Ads7952StreamStats stats{};
+    if (!handler.GetStreamStats(stats)) return false;
+    frames = stats.frames;
+    return true;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTS
+// ═══════════════════════════════════════════════════════════════════════════
+
+// ─────────────────────── Initialization ───────────────────────
+
+static bool test_initialize() noexcept {
+    g_handler = create_handler(PIN_ADS7952_CS, 0);
+    if (!g_handler || !g_handler->Initialize()) {
+        ESP_LOGE(TAG, "ADS7952 initialization failed");
+        return false;
+    }
+
+    hf_u32_t count = 0;
+    float voltage = 0.0f;
+    if (g_handler->ReadChannel(kTestChannel, count, voltage) != hf_adc_err_t::ADC_SUCCESS) {
+        ESP_LOGE(TAG, "Single-channel read failed");
+        return false;
+    }
+    ESP_LOGI(TAG, "CH%u: count %lu, %.4f V", static_cast<unsigned>(kTestChannel),
+             static_cast<unsigned long>(count), static_cast<double>(voltage));
+    return count <= 0x0FFFU;
+}
+
+// ─────────────────────── Streaming ───────────────────────
+
+static bool test_stream_start_stop() noexcept {
+    if (!g_handler) return false;
+    bool ok = g_handler->StartStreaming(ads7952::Mode::Auto1);
+    ok &= g_handler->IsStreaming();
+    // Manual is not a streaming mode.
+    ok &= !g_handler->StartStreaming(ads7952::Mode::Manual);
+
+    ok &= (g_handler->PollStream(4) == 4);
+    Ads7952Scan scan{};
+    ok &= g_handler->GetLatestScan(scan);
+    ok &= (scan.channel_mask == kStreamMask);
+
+    Ads7952StreamStats stats{};
+    ok &= g_handler->GetStreamStats(stats);
+    ok &= stats.active && stats.mode == ads7952::Mode::Auto1 && stats.channel_mask == kStreamMask;
+    ok &= (stats.scans == 4) && (stats.buffered == 4) && (stats.frame_errors == 0);
+
+    // Sequence numbers are contiguous while the ring has room.
+    uint32_t expected_sequence = 0;
+    while (g_handler->PopScan(scan)) {
+        ok &= (scan.sequence == expected_sequence++);
+    }
+    ok &= (expected_sequence == 4);
+
+    ok &= g_handler->StopStreaming();
+    ok &= !g_handler->IsStreaming();
+    ok &= (g_handler->PollStream(1) == 0);
+
+    // StopStreaming() puts the configured (Manual) mode back.
+    Ads7952Diagnostics diag{};
+    ok &= g_handler->GetHandlerDiagnostics(diag);
+    ok &= !diag.streaming && diag.current_mode == ads7952::Mode::Manual;
+    ESP_LOGI(TAG, "Stream start/stop: %lu scans, %lu frames — %s", static_cast<unsigned long>(stats.scans),
+             static_cast<unsigned long>(stats.frames), ok ? "OK" : "FAILED");
+    return ok;
+}
+
+static bool test_stream_idle_discard() noexcept {
+    if (!g_handler) return false;
+    bool ok = g_handler->StartStreaming(ads7952::Mode::Auto1);
+    // Align on a scan boundary: the next frame returns the first channel.
+    ok &= (g_handler->PollStream(2) == 2);
+
+    // Back to back: exactly one frame per channel.
+    uint32_t before = 0, after = 0;
+    ok &= stream_frames(*g_handler, before);
+    ok &= (g_handler->PollStream(1) == 1);
+    ok &= stream_frames(*g_handler, after);
+    const uint32_t hot_frames = after - before;
+    ok &= (hot_frames == kStreamChannels);
+
+    // After idling past kAds7952StreamStaleUs the first (stale) frame is
+    // clocked and thrown away before the scan is assembled.
+    vTaskDelay(pdMS_TO_TICKS(5 + kAds7952StreamStaleUs / 1000));
+    ok &= stream_frames(*g_handler, before);
+    ok &= (g_handler->PollStream(1) == 1);
+    ok &= stream_frames(*g_handler, after);
+    const uint32_t idle_frames = after - before;
+    ok &= (idle_frames == kStreamChannels + 1);
+
+    Ads7952StreamStats stats{};
+    ok &= g_handler->GetStreamStats(stats);
+    ok &= (stats.frame_errors == 0);
+
+    ok &= g_handler->StopStreaming();
+    ESP_LOGI(TAG, "Frames per scan: %lu back-to-back, %lu after idle — %s",
+             static_cast<unsigned long>(hot_frames), static_cast<unsigned long>(idle_frames),
+             ok ? "OK" : "FAILED");
+    return ok;
+}
+
+// ─────────────────────── Burst / decimation ───────────────────────
+
+static bool test_burst_decimation() noexcept {
+    if (!g_handler) return false;
+    static constexpr uint16_t kSamples = 64;
+
+    Ads7952Diagnostics diag{};
+    bool ok = g_handler->GetHandlerDiagnostics(diag);
+    const uint32_t samples_before = diag.burst_samples;
+
+    hf_u32_t count0 = 0, count2 = 0, count_max = 0;
+    float v0 = 0.0f, v2 = 0.0f, v_max = 0.0f;
+    ok &= (g_handler->ReadChannelBurst(kTestChannel, kSamples, 0, count0, v0) == hf_adc_err_t::ADC_SUCCESS);
+    ok &= (g_handler->ReadChannelBurst(kTestChannel, kSamples, 2, count2, v2) == hf_adc_err_t::ADC_SUCCESS);
+    // Requests beyond kAds7952MaxDecimationBits are clamped to 16-bit results.
+    ok &= (g_handler->ReadChannelBurst(kTestChannel, kSamples, 8, count_max, v_max) == hf_adc_err_t::ADC_SUCCESS);
+
+    ok &= (count0 <= 0x0FFFU) && (count2 <= 0x3FFFU) && (count_max <= 0xFFFFU);
+    ok &= (static_cast<uint32_t>(std::abs(static_cast<int32_t>(count2) - static_cast<int32_t>(count0 << 2))) <=
+           (kBurstNoiseLsb << 2));
+    ok &= (static_cast<uint32_t>(std::abs(static_cast<int32_t>(count_max) - static_cast<int32_t>(count0 << 4))) <=
+           (kBurstNoiseLsb << 4));
+
+    // Each burst adds exactly its sample count.
+    ok &= g_handler->GetHandlerDiagnostics(diag);
+    ok &= (diag.burst_samples - samples_before == 3U * kSamples);
+
+    ESP_LOGI(TAG, "Burst x%u: 12-bit %lu, 14-bit %lu, 16-bit %lu (%.0f conv/s) — %s",
+             static_cast<unsigned>(kSamples), static_cast<unsigned long>(count0),
+             static_cast<unsigned long>(count2), static_cast<unsigned long>(count_max),
+             static_cast<double>(diag.burst_samples_per_second), ok ? "OK" : "FAILED");
+    return ok;
+}
+
+// ─────────────────────── Multi-channel ───────────────────────
+
+static bool test_multi_channel_restores_mode() noexcept {
+    if (!g_handler) return false;
+    static constexpr hf_channel_id_t kChannels[] = {0, 2, 3};
+    static constexpr hf_u8_t kCount = 3;
+
+    hf_u32_t counts[kCount] = {};
+    float volts[kCount] = {};
+    hf_u32_t burst_counts[kCount] = {};
+    bool ok = (g_handler->ReadMultipleChannels(kChannels, kCount, counts, volts) == hf_adc_err_t::ADC_SUCCESS);
+    ok &= (g_handler->ReadMultipleChannelsBurst(kChannels, kCount, 16, 2, burst_counts, nullptr) ==
+           hf_adc_err_t::ADC_SUCCESS);
+
+    ads7952::ChannelReadings readings{};
+    ok &= g_handler->ReadAllChannels(readings);
+
+    // Every multi-channel path leaves the configured mode in place.
+    Ads7952Diagnostics diag{};
+    ok &= g_handler->GetHandlerDiagnostics(diag);
+    ok &= (diag.current_mode == ads7952::Mode::Manual);
+
+    for (hf_u8_t i = 0; i < kCount; ++i) {
+        ok &= (burst_counts[i] <= 0x3FFFU);
+        ESP_LOGI(TAG, "CH%u: %lu (%.4f V), burst 14-bit %lu", static_cast<unsigned>(kChannels[i]),
+                 static_cast<unsigned long>(counts[i]), static_cast<double>(volts[i]),
+                 static_cast<unsigned long>(burst_counts[i]));
+    }
+    return ok;
+}
+
+// ─────────────────────── Scan group ───────────────────────
+
+static bool test_scan_group_sweep() noexcept {
+    if (!g_handler) return false;
+    if (PIN_ADS7952_CS_2 >= 0 && !g_second_handler) {
+        g_second_handler = create_handler(PIN_ADS7952_CS_2, 1);
+        if (!g_second_handler || !g_second_handler->Initialize()) {
+            ESP_LOGE(TAG, "Second ADS7952 initialization failed");
+            return false;
+        }
+    }
+
+    Ads7952ScanGroup group;
+    bool ok = group.AddDevice(*g_handler);
+    ok &= !group.AddDevice(*g_handler);  // duplicates rejected
+    if (g_second_handler) ok &= group.AddDevice(*g_second_handler);
+    const uint8_t members = group.GetDeviceCount();
+
+    Ads7952GroupSnapshot snapshot{};
+    ok &= !group.Snapshot(snapshot);  // not started
+    ok &= group.Start(ads7952::Mode::Auto1);
+    ok &= group.IsRunning() && g_handler->IsStreaming();
+
+    // Idle between sweeps: each member's priming frame still keeps stale
+    // conversions out of the snapshot, so a clean sweep costs channels + 1.
+    static constexpr uint32_t kSweeps = 8;
+    for (uint32_t i = 0; i < kSweeps && ok; ++i) {
+        ok &= group.Snapshot(snapshot);
+        ok &= (snapshot.sequence == i) && (snapshot.device_count == members);
+        for (uint8_t d = 0; d < members; ++d) {
+            ok &= (snapshot.channel_mask[d] == kStreamMask) && (snapshot.device_index[d] == d);
+        }
+        vTaskDelay(pdMS_TO_TICKS(2));
+    }
+
+    const Ads7952GroupStats stats = group.GetStats();
+    ok &= (stats.snapshots == kSweeps) && (stats.failures == 0) && (stats.frame_errors == 0);
+    ok &= (stats.frames >= kSweeps * members * (kStreamChannels + 1));
+
+    ok &= group.Stop();
+    ok &= !group.IsRunning() && !g_handler->IsStreaming();
+    if (g_second_handler) ok &= !g_second_handler->IsStreaming();
+
+    ESP_LOGI(TAG, "Group: %u member(s), %lu snapshots, %lu frames, worst sweep %lu us, %.0f conv/s — %s",
+             static_cast<unsigned>(members), static_cast<unsigned long>(stats.snapshots),
+             static_cast<unsigned long>(stats.frames), static_cast<unsigned long>(stats.max_sweep_us),
+             static_cast<double>(stats.conversions_per_second), ok ? "OK" : "FAILED");
+    return ok;
+}
+
+extern "C" void app_main(void) {
+    ESP_LOGI(TAG, "\n");
+    ESP_LOGI(TAG, "╔══════════════════════════════════════════════════════════════╗");
+    ESP_LOGI(TAG, "║        ADS7952 ADC HANDLER COMPREHENSIVE TEST SUITE         ║");
+    ESP_LOGI(TAG, "╚══════════════════════════════════════════════════════════════╝");
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_INITIALIZATION_TESTS, "INITIALIZATION",
+        RUN_TEST_IN_TASK("init", test_initialize, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_STREAMING_TESTS, "STREAMING",
+        RUN_TEST_IN_TASK("stream_start_stop", test_stream_start_stop, 8192, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("stream_idle_discard", test_stream_idle_discard, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_BURST_TESTS, "BURST / DECIMATION",
+        RUN_TEST_IN_TASK("burst_decimation", test_burst_decimation, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_MULTI_CHANNEL_TESTS, "MULTI-CHANNEL",
+        RUN_TEST_IN_TASK("multi_channel_mode", test_multi_channel_restores_mode, 8192, 5);
+        flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_SCAN_GROUP_TESTS, "SCAN GROUP",
+        RUN_TEST_IN_TASK("scan_group_sweep", test_scan_group_sweep, 8192, 5); flip_test_progress_indicator();
+    );
+
+    print_test_summary(g_test_results, "ADS7952 ADC HANDLER COMPREHENSIVE", TAG);
+    while (true) { vTaskDelay(pdMS_TO_TICKS(10000)); }
+}
@@ -15,6 +15,12 @@
  * 7. Diagnostics & error flags
  * 8. Thread safety (mutex contention)
  * 9. Error handling & edge cases
+ * 10. Pipelined measurement read (simulated AS5047U + live frame count)
+ * 11. Streaming: multi-turn / PLL observer on a simulated encoder (even spacing,
+ *     burst/yield gaps, a long stall), live 10 kHz stream
+ * 12. Queued SPI: batch frames against the simulated AS5047U, live async measurement,
+ *     queued batches interleaved with ReadMeasurement()
+ * 13. Frame codec: compile-time CRC table / precomputed frames, build + verify benchmark
  *
  * Hardware Required:
  * - AS5047U encoder on SPI bus (see esp32_test_config.hpp for pins)
@@ -32,12 +38,17 @@
 // Handler under test
 #include "handlers/as5047u/As5047uHandler.h"
 
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 #include <memory>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #ifdef __cplusplus
@@ -59,6 +70,10 @@ static constexpr bool ENABLE_ZERO_POSITION_TESTS = true;
 static constexpr bool ENABLE_DIAGNOSTICS_TESTS = true;
 static constexpr bool ENABLE_ERROR_HANDLING_TESTS = true;
 static constexpr bool ENABLE_THREAD_SAFETY_TESTS = true;
+static constexpr bool ENABLE_PIPELINE_TESTS = true;
+static constexpr bool ENABLE_STREAMING_TESTS = true;
+static constexpr bool ENABLE_QUEUED_SPI_TESTS = true;
+static constexpr bool ENABLE_FRAME_CODEC_TESTS = true;
 
 // ═══════════════════════════════════════════════════════════════════════════
 // SHARED RESOURCES
@@ -314,6 +329,607 @@ static bool test_concurrent_access() noexcept {
     return g_thread_test_pass;
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// TEST: PIPELINED MEASUREMENT
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * Simulated AS5047U at the frame level: every frame returns the result of
+ * the previous command, with CRC in 24/32-bit formats.
+ */
+class SimulatedAs5047u {
+public:
+    explicit SimulatedAs5047u(FrameFormat format) noexcept : format_(format) {}
+
+    uint16_t ReadRegister(uint16_t address) const noexcept {
+        switch (address) {
+            case As5047uFrameCodec::kRegAngleCom: return angle_com;
+            case As5047uFrameCodec::kRegAngleUnc: return angle_unc;
+            case As5047uFrameCodec::kRegVel:      return velocity;
+            case As5047uFrameCodec::kRegMag:      return magnitude;
+            case As5047uFrameCodec::kRegAgc:      return agc;
+            case As5047uFrameCodec::kRegErrfl:    return errfl;
+            default:                              return 0;
+        }
+    }
+
+    void Transfer(const uint8_t* tx, uint8_t* rx, size_t len) noexcept {
+        ++frames;
+        const size_t offset = (format_ == FrameFormat::SPI_32) ? 1 : 0;
+        const auto word = static_cast<uint16_t>(((pending_ & 0x3FFFU) | (errfl ? 0x4000U : 0U)));
+        for (size_t i = 0; i < len; ++i) rx[i] = 0;
+        rx[offset] = static_cast<uint8_t>(word >> 8);
+        rx[offset + 1] = static_cast<uint8_t>(word & 0xFFU);
+        if (format_ != FrameFormat::SPI_16) {
+            rx[offset + 2] = static_cast<uint8_t>(As5047uFrameCodec::Crc8(word) ^ (frames == corrupt_frame ? 0x01U : 0x00U));
+        }
+        const auto command = static_cast<uint16_t>((tx[offset] << 8) | tx[offset + 1]);
+        pending_ = ReadRegister(command & 0x3FFFU);
+    }
+
+    uint16_t angle_com = 0x1234;
+    uint16_t angle_unc = 0x1230;
+    uint16_t velocity = 0x3FF6;   // -10 LSB
+    uint16_t magnitude = 0x0F00;
+    uint16_t agc = 0x0080;
+    uint16_t errfl = 0;
+    uint32_t frames = 0;
+    uint32_t corrupt_frame = 0;   ///< 1-based frame whose CRC is flipped (0 = none)
+
+private:
+    FrameFormat format_;
+    uint16_t pending_ = 0;
+};
+
+static bool test_pipeline_simulated() noexcept {
+    static constexpr uint16_t kRegs[] = {
+        As5047uFrameCodec::kRegAngleCom, As5047uFrameCodec::kRegAngleUnc, As5047uFrameCodec::kRegVel,
+        As5047uFrameCodec::kRegMag,      As5047uFrameCodec::kRegAgc,      As5047uFrameCodec::kRegErrfl,
+    };
+    constexpr size_t kCount = sizeof(kRegs) / sizeof(kRegs[0]);
+    bool pass = true;
+
+    for (FrameFormat format : {FrameFormat::SPI_16, FrameFormat::SPI_24, FrameFormat::SPI_32}) {
+        SimulatedAs5047u sim(format);
+        const auto transfer = [&sim](const uint8_t* tx, uint8_t* rx, size_t len) { sim.Transfer(tx, rx, len); };
+
+        uint16_t values[kCount] = {};
+        As5047uPipelineStatus status{};
+        const bool ok = As5047uFrameCodec::ReadPipelined(format, transfer, kRegs, kCount, values, status);
+        bool match = true;
+        for (size_t i = 0; i < kCount; ++i) match &= (values[i] == sim.ReadRegister(kRegs[i]));
+
+        // A corrupted result frame must be rejected in CRC formats.
+        sim.corrupt_frame = sim.frames + 3;
+        As5047uPipelineStatus bad{};
+        As5047uFrameCodec::ReadPipelined(format, transfer, kRegs, kCount, values, bad);
+        const bool crc_detected = (format == FrameFormat::SPI_16) ? bad.crc_ok : !bad.crc_ok;
+
+        ESP_LOGI(TAG, "Simulated %s: frames=%lu (expect %u) values %s, corrupt CRC %s",
+                 format == FrameFormat::SPI_16 ? "16-bit" : format == FrameFormat::SPI_24 ? "24-bit" : "32-bit",
+                 static_cast<unsigned long>(status.frames), static_cast<unsigned>(kCount + 1),
+                 match ? "OK" : "MISMATCH", crc_detected ? "handled" : "MISSED");
+        pass &= ok && match && status.frames == kCount + 1 && crc_detected;
+    }
+    return pass;
+}
+
+static bool test_read_measurement_live() noexcept {
+    if (!g_handler) return false;
+    const As5047uDiagnostics before = g_handler->GetDiagnostics();
+
+    As5047uMeasurement m{};
+    if (!g_handler->ReadMeasurement(m) || !m.valid) {
+        ESP_LOGE(TAG, "ReadMeasurement failed");
+        return false;
+    }
+    const As5047uDiagnostics after = g_handler->GetDiagnostics();
+    const uint32_t frames = after.spi_frames - before.spi_frames;
+    const bool retried = after.communication_errors != before.communication_errors;
+
+    ESP_LOGI(TAG, "Measurement: angle=%u com=%u vel=%d (%.1f rpm) agc=%u mag=%u errfl=0x%04X frames=%lu",
+             m.angle_raw, m.angle_compensated, m.velocity_raw, static_cast<double>(m.velocity_rpm),
+             m.agc_value, m.magnitude, m.error_flags, static_cast<unsigned long>(frames));
+
+    return m.angle_raw <= 16383 && m.angle_compensated <= 16383 &&
+           (retried || frames == As5047uHandler::kMeasurementFrames);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEST: STREAMING
+// ═══════════════════════════════════════════════════════════════════════════
+
+/**
+ * Simulated encoder: accelerate to 3000 rpm, hold, brake through zero to
+ * -1800 rpm, hold. Angles are quantised to 14 bits with +/-2 LSB of noise.
+ */
+class SimulatedEncoder {
+public:
+    SimulatedEncoder() noexcept = default;
+
+    /** @brief Constant-speed encoder (no acceleration profile). */
+    explicit SimulatedEncoder(double rpm) noexcept : velocity_(rpm / 60.0 * kTwoPi), profile_(false) {}
+
+    void Step(double dt) noexcept {
+        const double t = time_;
+        const double accel = !profile_ ? 0.0
+                                       : (t < 0.5 ? 100.0 * kTwoPi
+                                                  : (t < 1.0 ? 0.0 : (t < 1.5 ? -160.0 * kTwoPi : 0.0)));
+        velocity_ += accel * dt;
+        position_ += velocity_ * dt;
+        time_ += dt;
+    }
+
+    /** @brief True position in counts (multi-turn, floor). */
+    int64_t TrueCounts() const noexcept {
+        return static_cast<int64_t>(std::floor(position_ / kTwoPi * 16384.0));
+    }
+
+    /** @brief Noisy 14-bit angle as the sensor would report it. */
+    uint16_t Angle(int64_t& noisy_counts, bool noise = true) noexcept {
+        lcg_ = lcg_ * 1664525U + 1013904223U;
+        noisy_counts = TrueCounts() + (noise ? static_cast<int32_t>(lcg_ >> 29) % 5 - 2 : 0);
+        return static_cast<uint16_t>(noisy_counts & 0x3FFF);
+    }
+
+    double Time() const noexcept { return time_; }
+    double Velocity() const noexcept { return velocity_; }
+
+private:
+    static constexpr double kTwoPi = 6.283185307179586;
+    double time_ = 0.0;
+    double position_ = 0.0;
+    double velocity_ = 0.0;
+    bool profile_ = true;
+    uint32_t lcg_ = 1;
+};
+
+/**
+ * Stream-task timing: bursts of 40 samples at 10 kHz separated by a yield of
+ * @p gap_s. Returns the worst velocity error during the constant-speed hold.
+ */
+static double tracker_burst_gap_error(double gap_s, int64_t& position_error) noexcept {
+    constexpr double kDt = 1.0e-4;
+    As5047uAngleTracker tracker;
+    tracker.Configure(150.0f, 1.0f, static_cast<float>(kDt));
+    SimulatedEncoder enc;
+
+    int64_t seed_offset = 0;
+    double worst = 0.0;
+    for (uint32_t burst = 0; enc.Time() < 2.0; ++burst) {
+        for (uint32_t i = 0; i < 40; ++i) {
+            const double dt = (i == 0 && burst > 0) ? gap_s : kDt;
+            enc.Step(dt);
+            int64_t noisy = 0;
+            const uint16_t angle = enc.Angle(noisy);
+            if (burst == 0 && i == 0) seed_offset = static_cast<int64_t>(angle) - noisy;
+            tracker.Update(angle, static_cast<float>(dt));
+            if (enc.Time() > 0.6 && enc.Time() < 0.95) {
+                worst = std::fmax(worst, std::fabs(tracker.GetVelocityRadPerSec() - enc.Velocity()));
+            }
+        }
+    }
+    position_error = tracker.GetPositionCounts() - (enc.TrueCounts() + seed_offset);
+    return worst;
+}
+
+static bool test_tracker_gaps() noexcept {
+    // Yields after each burst: the correction step stays at the nominal period,
+    // longer gaps re-seed the position and keep the velocity.
+    bool ok = true;
+    for (double gap_ms : std::array<double, 4>{1.0, 2.0, 5.0, 10.0}) {
+        int64_t position_error = 0;
+        const double worst = tracker_burst_gap_error(gap_ms * 1.0e-3, position_error);
+        ESP_LOGI(TAG, "Tracker bursts + %.0f ms gaps: worst vel err %.3f rad/s, pos err %lld counts", gap_ms,
+                 worst, static_cast<long long>(position_error));
+        ok &= worst < 2.0 && std::llabs(position_error) <= 2;
+    }
+
+    // One 30 ms stall at a constant 1000 rpm, no noise
+    constexpr double kDt = 1.0e-4;
+    As5047uAngleTracker tracker;
+    tracker.Configure(150.0f, 1.0f, static_cast<float>(kDt));
+    SimulatedEncoder enc(1000.0);
+    int64_t seed_offset = 0;
+    double worst_rpm = 0.0;
+    for (uint32_t i = 0; i < 5000; ++i) {
+        const double dt = (i == 2500) ? 0.030 : kDt;
+        enc.Step(dt);
+        int64_t counts = 0;
+        const uint16_t angle = enc.Angle(counts, false);
+        if (i == 0) seed_offset = static_cast<int64_t>(angle) - counts;
+        tracker.Update(angle, static_cast<float>(dt));
+        if (i > 1000) worst_rpm = std::fmax(worst_rpm, std::fabs(tracker.GetVelocityRpm() - 1000.0));
+    }
+    const int64_t stall_position_error = tracker.GetPositionCounts() - (enc.TrueCounts() + seed_offset);
+    ESP_LOGI(TAG, "Tracker 30 ms stall @1000 rpm: worst vel err %.3f rpm, pos err %lld counts", worst_rpm,
+             static_cast<long long>(stall_position_error));
+    return ok && worst_rpm < 5.0 && stall_position_error == 0;
+}
+
+static bool test_tracker_simulated() noexcept {
+    constexpr double kRate = 20000.0;
+    constexpr double kDt = 1.0 / kRate;
+    As5047uAngleTracker tracker;
+    tracker.Configure(200.0f, 1.0f, static_cast<float>(kDt));
+    SimulatedEncoder enc;
+
+    int64_t seed_offset = 0;
+    uint16_t previous = 0;
+    double se_pll = 0.0, se_diff = 0.0;
+    uint32_t n = 0;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(2.0 * kRate); ++i) {
+        enc.Step(kDt);
+        int64_t noisy = 0;
+        const uint16_t angle = enc.Angle(noisy);
+        if (i == 0) seed_offset = static_cast<int64_t>(angle) - noisy;  // first angle defines turn 0
+        tracker.Update(angle, static_cast<float>(kDt));
+
+        // Compare against a plain finite difference during the constant-speed hold
+        if (enc.Time() > 0.6 && enc.Time() < 0.95) {
+            int32_t d = static_cast<int32_t>(angle) - static_cast<int32_t>(previous);
+            if (d >= 8192) d -= 16384;
+            if (d < -8192) d += 16384;
+            const double diff_vel = d / kDt * As5047uAngleTracker::kRadPerCount;
+            const double pll_err = tracker.GetVelocityRadPerSec() - enc.Velocity();
+            se_pll += pll_err * pll_err;
+            se_diff += (diff_vel - enc.Velocity()) * (diff_vel - enc.Velocity());
+            ++n;
+        }
+        previous = angle;
+    }
+
+    const double rms_pll = std::sqrt(se_pll / n);
+    const double rms_diff = std::sqrt(se_diff / n);
+    const int64_t expected = enc.TrueCounts() + seed_offset;
+    const int64_t position_error = tracker.GetPositionCounts() - expected;
+    const double final_err = std::fabs(tracker.GetVelocityRadPerSec() - enc.Velocity());
+    const int32_t turns = tracker.GetTurns();
+
+    ESP_LOGI(TAG, "Tracker @20 kHz: turns=%ld (expect %ld) pos err=%lld counts, vel rms PLL=%.3f vs diff=%.3f rad/s, "
+             "final vel %.1f (true %.1f)",
+             static_cast<long>(turns), static_cast<long>(expected >> 14),
+             static_cast<long long>(position_error), rms_pll, rms_diff,
+             static_cast<double>(tracker.GetVelocityRadPerSec()), enc.Velocity());
+
+    // SetTurns() rebases the count without disturbing the observer
+    const float velocity_before = tracker.GetVelocityRpm();
+    tracker.SetTurns(0);
+    const bool rebased = tracker.GetTurns() == 0 && tracker.GetVelocityRpm() == velocity_before;
+
+    return turns == static_cast<int32_t>(expected >> 14) && std::llabs(position_error) <= 2 &&
+           rms_pll * 20.0 < rms_diff && final_err < 0.01 * std::fabs(enc.Velocity()) && rebased;
+}
+
+static bool test_streaming_live() noexcept {
+    if (!g_handler) return false;
+
+    As5047uStreamConfig config;
+    config.sample_rate_hz = 10000;
+    config.observer_bandwidth_hz = 100.0f;
+
+    // A task that never yields would starve IDLE; an unpinnable core must be refused
+    As5047uStreamConfig busy_spin = config;
+    busy_spin.yield_ms = 0;
+    As5047uStreamConfig bad_core = config;
+    bad_core.core_id = As5047uHandler::IsStreamCorePinningSupported() ? 64 : 0;
+    if (g_handler->StartStreaming(busy_spin) || g_handler->StartStreaming(bad_core)) {
+        ESP_LOGE(TAG, "Unsafe stream task configuration accepted");
+        g_handler->StopStreaming();
+        return false;
+    }
+
+    if (!g_handler->StartStreaming(config)) {
+        ESP_LOGE(TAG, "StartStreaming failed");
+        return false;
+    }
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    As5047uStreamSample first{};
+    const bool have_first = g_handler->GetLatestSample(first);
+
+    // A regular read in between breaks the frame chain once
+    As5047uMeasurement m{};
+    const bool measured = g_handler->ReadMeasurement(m);
+    vTaskDelay(pdMS_TO_TICKS(100));
+
+    // Queued reads break it as well; their ERRFL / MAG responses must never be taken as angles
+    As5047uStreamStats before_queued{};
+    g_handler->GetStreamStats(before_queued);
+    bool queued = g_handler->StartSpiQueue();
+    for (int i = 0; i < 10 && queued; ++i) {
+        As5047uMeasurement qm{};
+        queued = g_handler->BeginReadMeasurement() && g_handler->FinishReadMeasurement(qm) && qm.valid;
+    }
+    queued &= g_handler->StopSpiQueue();
+    vTaskDelay(pdMS_TO_TICKS(50));
+
+    As5047uStreamSample last{};
+    const bool have_last = g_handler->GetLatestSample(last);
+    As5047uStreamStats stats{};
+    g_handler->GetStreamStats(stats);
+    const bool stopped = g_handler->StopStreaming() && !g_handler->IsStreaming();
+
+    ESP_LOGI(TAG, "Stream: samples=%lu frames=%lu rate=%.0f/s crc=%lu resyncs=%lu overruns=%lu max_late=%lu us",
+             static_cast<unsigned long>(stats.samples), static_cast<unsigned long>(stats.frames),
+             static_cast<double>(stats.samples_per_second), static_cast<unsigned long>(stats.crc_errors),
+             static_cast<unsigned long>(stats.resyncs), static_cast<unsigned long>(stats.overruns),
+             static_cast<unsigned long>(stats.max_late_us));
+    ESP_LOGI(TAG, "Latest: seq=%lu angle=%u turns=%ld est=%.3f rad vel=%.1f rpm err=%.2f counts",
+             static_cast<unsigned long>(last.sequence), last.angle, static_cast<long>(last.turns),
+             static_cast<double>(last.estimated_angle_rad), static_cast<double>(last.velocity_rpm),
+             static_cast<double>(last.tracking_error_counts));
+
+    // The task samples burst_ms out of every burst_ms + yield_ms
+    const float duty = static_cast<float>(config.burst_ms) / static_cast<float>(config.burst_ms + config.yield_ms);
+    return have_first && have_last && measured && queued && stopped && last.sequence > first.sequence &&
+           stats.samples_per_second > 0.8f * duty * static_cast<float>(config.sample_rate_hz) &&
+           stats.resyncs > before_queued.resyncs && before_queued.resyncs >= 1 &&
+           stats.error_frames == before_queued.error_frames;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEST: QUEUED SPI
+// ═══════════════════════════════════════════════════════════════════════════
+
+static bool test_transaction_simulated() noexcept {
+    static constexpr uint16_t kRegs[] = {
+        As5047uFrameCodec::kRegAngleCom, As5047uFrameCodec::kRegVel, As5047uFrameCodec::kRegErrfl,
+    };
+    constexpr size_t kCount = sizeof(kRegs) / sizeof(kRegs[0]);
+    bool pass = alignof(As5047uSpiTransaction) >= 4 && sizeof(As5047uSpiTransaction::tx[0]) == 4;
+
+    for (FrameFormat format : {FrameFormat::SPI_16, FrameFormat::SPI_24, FrameFormat::SPI_32}) {
+        SimulatedAs5047u sim(format);
+        As5047uSpiTransaction txn;
+        pass &= txn.PrepareRead(format, kRegs, kCount) && txn.frame_count == kCount + 1;
+
+        // Play the prepared batch through the simulated device, as the queue task would
+        for (uint8_t i = 0; i < txn.frame_count; ++i) sim.Transfer(txn.tx[i], txn.rx[i], txn.frame_bytes);
+
+        uint16_t values[kCount] = {};
+        As5047uPipelineStatus status{};
+        const bool ok = As5047uFrameCodec::ParsePipelineResponses(format, txn.rx, kCount, values, status);
+        bool match = true;
+        for (size_t i = 0; i < kCount; ++i) match &= (values[i] == sim.ReadRegister(kRegs[i]));
+
+        // A failed frame is filled with 0xFF by the adapter: CRC formats must reject it
+        memset(txn.rx[1], 0xFF, sizeof(txn.rx[1]));
+        As5047uPipelineStatus failed{};
+        As5047uFrameCodec::ParsePipelineResponses(format, txn.rx, kCount, values, failed);
+        const bool rejected = (format == FrameFormat::SPI_16) ? failed.error : !failed.crc_ok;
+
+        ESP_LOGI(TAG, "Batch %s: frames=%lu values %s, 0xFF frame %s",
+                 format == FrameFormat::SPI_16 ? "16-bit" : format == FrameFormat::SPI_24 ? "24-bit" : "32-bit",
+                 static_cast<unsigned long>(sim.frames), match ? "OK" : "MISMATCH", rejected ? "rejected" : "ACCEPTED");
+        pass &= ok && match && sim.frames == kCount + 1 && rejected;
+    }
+    return pass;
+}
+
+static bool test_async_measurement_live() noexcept {
+    if (!g_handler) return false;
+    if (!g_handler->StartSpiQueue()) {
+        ESP_LOGE(TAG, "StartSpiQueue failed");
+        return false;
+    }
+
+    static std::atomic<uint32_t> s_completions{0};
+    s_completions = 0;
+    const As5047uDiagnostics before = g_handler->GetDiagnostics();
+
+    bool pass = true;
+    uint32_t max_overlap_iterations = 0;
+    uint64_t total_us = 0;
+    constexpr uint32_t kReads = 100;
+    for (uint32_t i = 0; i < kReads && pass; ++i) {
+        const uint64_t start = esp_timer_get_time();
+        pass &= g_handler->BeginReadMeasurement([](As5047uSpiTransaction&) { s_completions.fetch_add(1); });
+
+        // Stand-in for FOC math running while the frames are on the bus
+        volatile float acc = 0.0f;
+        uint32_t iterations = 0;
+        while (s_completions.load() == i && iterations < 100000) {
+            acc = acc + 1.0f;
+            ++iterations;
+        }
+        if (iterations > max_overlap_iterations) max_overlap_iterations = iterations;
+
+        As5047uMeasurement m{};
+        pass &= g_handler->FinishReadMeasurement(m) && m.valid && m.angle_compensated <= 16383;
+        total_us += static_cast<uint64_t>(esp_timer_get_time() - start);
+    }
+
+    const As5047uDiagnostics after = g_handler->GetDiagnostics();
+    const bool stopped = g_handler->StopSpiQueue();
+    const bool rejected_after_stop = !g_handler->BeginReadMeasurement();
+
+    ESP_LOGI(TAG, "Async measurement: %lu reads, avg %.1f us, up to %lu work iterations overlapped, "
+             "callbacks=%lu, frames=%lu, spi_errors=%lu",
+             static_cast<unsigned long>(kReads), static_cast<double>(total_us) / kReads,
+             static_cast<unsigned long>(max_overlap_iterations),
+             static_cast<unsigned long>(s_completions.load()),
+             static_cast<unsigned long>(after.spi_frames - before.spi_frames),
+             static_cast<unsigned long>(after.spi_errors - before.spi_errors));
+
+    return pass && stopped && rejected_after_stop && s_completions.load() == kReads &&
+           after.spi_frames - before.spi_frames == kReads * As5047uHandler::kMeasurementFrames &&
+           after.spi_errors == before.spi_errors;
+}
+
+static std::atomic<bool> g_interleave_run{false};
+static std::atomic<uint32_t> g_interleave_batches{0};
+static std::atomic<uint32_t> g_interleave_failures{0};
+
+/** Keeps the SPI queue busy with MAG reads while the test task runs ReadMeasurement(). */
+static void queued_batch_task(void* arg) {
+    auto* handler = static_cast<As5047uHandler*>(arg);
+    static constexpr uint16_t kMagRegs[] = {
+        As5047uFrameCodec::kRegMag, As5047uFrameCodec::kRegMag, As5047uFrameCodec::kRegMag,
+    };
+    // g_handler runs the default configuration
+    As5047uSpiTransaction txn;
+    const bool prepared = txn.PrepareRead(As5047uHandler::GetDefaultConfig().frame_format, kMagRegs, 3);
+    while (g_interleave_run.load()) {
+        if (!prepared || !handler->SubmitTransaction(txn)) {
+            g_interleave_failures.fetch_add(1);
+            vTaskDelay(1);
+            continue;
+        }
+        while (!txn.IsComplete()) taskYIELD();
+        if (txn.state.load() != As5047uTransactionState::Done) g_interleave_failures.fetch_add(1);
+        txn.state.store(As5047uTransactionState::Idle);
+        g_interleave_batches.fetch_add(1);
+    }
+    g_interleave_run.store(true);  // handshake: task is done with the transaction
+    vTaskDelete(nullptr);
+}
+
+static bool test_queued_interleave_live() noexcept {
+    if (!g_handler) return false;
+
+    // Reference values with a quiet bus; the magnet is assumed static during the test
+    As5047uMeasurement reference{};
+    if (!g_handler->ReadMeasurement(reference) || !reference.valid) {
+        ESP_LOGE(TAG, "Reference measurement failed");
+        return false;
+    }
+    if (!g_handler->StartSpiQueue()) {
+        ESP_LOGE(TAG, "StartSpiQueue failed");
+        return false;
+    }
+
+    g_interleave_batches = 0;
+    g_interleave_failures = 0;
+    g_interleave_run = true;
+    // Same priority as the test task so the two are time-sliced against each other
+    xTaskCreate(queued_batch_task, "as5047u_batch", 4096, g_handler.get(), 5, nullptr);
+
+    // A MAG result landing in another slot shows up as a velocity spike, an
+    // angle pair that disagrees, or error flags / magnitude that moved.
+    constexpr uint32_t kReads = 500;
+    uint32_t failed_reads = 0;
+    uint32_t misassigned = 0;
+    for (uint32_t i = 0; i < kReads; ++i) {
+        As5047uMeasurement m{};
+        if (!g_handler->ReadMeasurement(m) || !m.valid) {
+            ++failed_reads;
+            continue;
+        }
+        int32_t angle_diff = static_cast<int32_t>(m.angle_compensated) - static_cast<int32_t>(m.angle_raw);
+        if (angle_diff >= 8192) angle_diff -= 16384;
+        if (angle_diff < -8192) angle_diff += 16384;
+        const int32_t mag_diff = static_cast<int32_t>(m.magnitude) - static_cast<int32_t>(reference.magnitude);
+        const bool consistent = std::abs(angle_diff) <= 128 && std::abs(m.velocity_raw) <= 64 &&
+                                std::abs(mag_diff) * 10 <= static_cast<int32_t>(reference.magnitude) + 10 &&
+                                (m.error_flags & ~reference.error_flags) == 0;
+        if (!consistent) ++misassigned;
+        if ((i & 0x0F) == 0) taskYIELD();
+    }
+
+    g_interleave_run = false;
+    for (int i = 0; i < 100 && !g_interleave_run.load(); ++i) vTaskDelay(pdMS_TO_TICKS(1));
+    const bool task_done = g_interleave_run.exchange(false);
+    const bool stopped = g_handler->StopSpiQueue();
+
+    ESP_LOGI(TAG, "Interleave: %lu reads (%lu failed, %lu misassigned) against %lu queued batches (%lu failed)",
+             static_cast<unsigned long>(kReads), static_cast<unsigned long>(failed_reads),
+             static_cast<unsigned long>(misassigned), static_cast<unsigned long>(g_interleave_batches.load()),
+             static_cast<unsigned long>(g_interleave_failures.load()));
+
+    return task_done && stopped && failed_reads == 0 && misassigned == 0 && g_interleave_batches.load() > 0 &&
+           g_interleave_failures.load() == 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TEST: FRAME CODEC
+// ═══════════════════════════════════════════════════════════════════════════
+
+static constexpr auto kCodecRead = As5047uFrameCodec::PrecomputeRead(std::array<uint16_t, 6>{
+    As5047uFrameCodec::kRegAngleCom, As5047uFrameCodec::kRegAngleUnc, As5047uFrameCodec::kRegVel,
+    As5047uFrameCodec::kRegMag,      As5047uFrameCodec::kRegAgc,      As5047uFrameCodec::kRegErrfl,
+});
+
+static bool test_frame_tables() noexcept {
+    uint32_t crc_mismatches = 0;
+    for (uint32_t word = 0; word <= 0xFFFFU; ++word) {
+        crc_mismatches += As5047uFrameCodec::Crc8(static_cast<uint16_t>(word)) !=
+                          As5047uFrameCodec::Crc8Bitwise(static_cast<uint16_t>(word));
+    }
+
+    bool frames_match = true;
+    for (FrameFormat format : {FrameFormat::SPI_16, FrameFormat::SPI_24, FrameFormat::SPI_32}) {
+        As5047uSpiTransaction runtime;
+        As5047uSpiTransaction precomputed;
+        frames_match &= runtime.PrepareRead(format, kCodecRead.registers.data(), kCodecRead.registers.size()) &&
+                        precomputed.PrepareRead(format, kCodecRead) &&
+                        runtime.frame_count == precomputed.frame_count &&
+                        runtime.frame_bytes == precomputed.frame_bytes &&
+                        memcmp(runtime.tx, precomputed.tx, sizeof(runtime.tx)) == 0;
+    }
+
+    ESP_LOGI(TAG, "CRC table vs bitwise: %lu mismatches over 65536 words; precomputed frames %s",
+             static_cast<unsigned long>(crc_mismatches), frames_match ? "match" : "DIFFER");
+    return crc_mismatches == 0 && frames_match;
+}
+
+static bool test_frame_codec_benchmark() noexcept {
+    constexpr FrameFormat kFormat = FrameFormat::SPI_24;
+    constexpr size_t kCount = kCodecRead.registers.size();
+    constexpr uint32_t kIterations = 20000;
+
+    // Capture one set of device responses to verify on every iteration
+    SimulatedAs5047u sim(kFormat);
+    As5047uSpiTransaction txn;
+    txn.PrepareRead(kFormat, kCodecRead);
+    for (uint8_t i = 0; i < txn.frame_count; ++i) sim.Transfer(txn.tx[i], txn.rx[i], txn.frame_bytes);
+
+    uint16_t values[kCount] = {};
+    As5047uPipelineStatus status{};
+    uint32_t checksum = 0;
+
+    // Per-read frame build and CRC check with the bit-by-bit CRC (codec before the lookup table)
+    int64_t start = esp_timer_get_time();
+    for (uint32_t n = 0; n < kIterations; ++n) {
+        for (size_t i = 0; i <= kCount; ++i) {
+            const auto word = static_cast<uint16_t>(
+                (1U << 14) | ((i < kCount ? kCodecRead.registers[i] : As5047uFrameCodec::kRegNop) & 0x3FFFU));
+            txn.tx[i][0] = static_cast<uint8_t>(word >> 8);
+            txn.tx[i][1] = static_cast<uint8_t>(word & 0xFFU);
+            txn.tx[i][2] = As5047uFrameCodec::Crc8Bitwise(word);
+        }
+        for (size_t i = 1; i <= kCount; ++i) {
+            const auto word = static_cast<uint16_t>((txn.rx[i][0] << 8) | txn.rx[i][1]);
+            values[i - 1] = static_cast<uint16_t>(word & 0x3FFFU);
+            checksum += txn.rx[i][2] == As5047uFrameCodec::Crc8Bitwise(word);
+        }
+    }
+    const double bitwise_ns = static_cast<double>(esp_timer_get_time() - start) * 1000.0 / kIterations;
+
+    // Runtime-format build and parse with the lookup table
+    start = esp_timer_get_time();
+    for (uint32_t n = 0; n < kIterations; ++n) {
+        txn.PrepareRead(kFormat, kCodecRead.registers.data(), kCount);
+        checksum += As5047uFrameCodec::ParsePipelineResponses(kFormat, txn.rx, kCount, values, status);
+    }
+    const double table_ns = static_cast<double>(esp_timer_get_time() - start) * 1000.0 / kIterations;
+
+    // Precomputed command frames, parse only
+    start = esp_timer_get_time();
+    for (uint32_t n = 0; n < kIterations; ++n) {
+        txn.PrepareRead(kFormat, kCodecRead);
+        checksum += As5047uFrameCodec::ParsePipelineResponses(kFormat, txn.rx, kCount, values, status);
+    }
+    const double precomputed_ns = static_cast<double>(esp_timer_get_time() - start) * 1000.0 / kIterations;
+
+    ESP_LOGI(TAG, "Build %u frames + verify %u (24-bit): bitwise CRC %.0f ns, table CRC %.0f ns, "
+             "precomputed %.0f ns per read", static_cast<unsigned>(kCount + 1), static_cast<unsigned>(kCount),
+             bitwise_ns, table_ns, precomputed_ns);
+
+    // Every CRC must verify in all three loops; timing only has to show the table beating the bit loop.
+    return checksum == kIterations * (kCount + 2) && table_ns < bitwise_ns && precomputed_ns < bitwise_ns;
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // MAIN
 // ═══════════════════════════════════════════════════════════════════════════
@@ -383,6 +999,38 @@ extern "C" void app_main(void) {
         flip_test_progress_indicator();
     );
 
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_PIPELINE_TESTS, "PIPELINED MEASUREMENT",
+        RUN_TEST_IN_TASK("simulated_frames", test_pipeline_simulated, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("live_measurement", test_read_measurement_live, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_STREAMING_TESTS, "STREAMING",
+        RUN_TEST_IN_TASK("tracker_simulated", test_tracker_simulated, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("tracker_gaps", test_tracker_gaps, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("stream_live", test_streaming_live, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_QUEUED_SPI_TESTS, "QUEUED SPI",
+        RUN_TEST_IN_TASK("transaction_simulated", test_transaction_simulated, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("async_measurement", test_async_measurement_live, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("queued_interleave", test_queued_interleave_live, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_FRAME_CODEC_TESTS, "FRAME CODEC",
+        RUN_TEST_IN_TASK("frame_tables", test_frame_tables, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("codec_benchmark", test_frame_codec_benchmark, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
     print_test_summary(g_test_results, "AS5047U HANDLER COMPREHENSIVE", TAG);
 
     ESP_LOGI(TAG, "Entering idle loop...");
@@ -15,6 +15,8 @@
  * 7. Hardware reset / boot / wake pins
  * 8. Error mapping (SH-2 → Bno08xError)
  * 9. Thread safety
+ * 10. Dispatch overhead (static driver dispatch, inline callbacks)
+ * 11. Quaternion math (batched / fast Euler conversion, multiply, slerp)
  *
  * Hardware Required:
  * - BNO085/BNO080 on I2C bus
@@ -31,12 +33,16 @@
 
 #include "handlers/bno08x/Bno08xHandler.h"
 
+#include <atomic>
+#include <cmath>
+#include <functional>
 #include <memory>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #ifdef __cplusplus
@@ -59,6 +65,10 @@ static constexpr bool ENABLE_CALLBACK_TESTS        = true;
 static constexpr bool ENABLE_HARDWARE_CTRL_TESTS   = true;
 static constexpr bool ENABLE_ERROR_HANDLING_TESTS   = true;
 static constexpr bool ENABLE_THREAD_SAFETY_TESTS    = true;
+static constexpr bool ENABLE_SERVICE_TASK_TESTS     = true;
+static constexpr bool ENABLE_REPORT_RING_TESTS      = true;
+static constexpr bool ENABLE_DISPATCH_BENCHMARK     = true;
+static constexpr bool ENABLE_QUATERNION_MATH_TESTS  = true;
 
 // ═══════════════════════════════════════════════════════════════════════════
 // SHARED RESOURCES
@@ -87,8 +97,10 @@ static bool create_handler() noexcept {
         return false;
     }
 
+    Bno08xConfig config{};
+    config.report_ring_capacity = 64;
     g_handler = std::make_unique<Bno08xHandler>(
-        *i2c_dev, Bno08xConfig{}, g_rst_gpio.get(), g_int_gpio.get());
+        *i2c_dev, config, g_rst_gpio.get(), g_int_gpio.get());
     ESP_LOGI(TAG, "Bno08xHandler created (I2C mode, addr=0x%02X)", BNO08X_I2C_ADDR);
     return true;
 }
@@ -258,6 +270,461 @@ static bool test_operations_before_init() noexcept {
     return correct;
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTS: THREAD SAFETY (latest-sample store)
+// ═══════════════════════════════════════════════════════════════════════════
+
+static volatile bool g_reader_running = false;
+static volatile bool g_reader_pass = true;
+static volatile uint32_t g_reader_reads = 0;
+static volatile int64_t g_reader_max_us = 0;
+
+static void sample_reader_task(void* param) {
+    auto* handler = static_cast<Bno08xHandler*>(param);
+    while (g_reader_running) {
+        const int64_t start = esp_timer_get_time();
+        Bno08xImuData imu;
+        Bno08xVector3 accel;
+        const bool have_imu = handler->GetLatestImuData(imu);
+        handler->GetLatestVector(BNO085Sensor::Accelerometer, accel);
+        const int64_t elapsed = esp_timer_get_time() - start;
+
+        if (elapsed > g_reader_max_us) g_reader_max_us = elapsed;
+        // A torn copy would show up as a rotation far off the unit sphere.
+        if (have_imu && imu.rotation.valid) {
+            const float n = imu.rotation.w * imu.rotation.w + imu.rotation.x * imu.rotation.x +
+                            imu.rotation.y * imu.rotation.y + imu.rotation.z * imu.rotation.z;
+            if (n < 0.8f || n > 1.2f) g_reader_pass = false;
+        }
+        ++g_reader_reads;
+        vTaskDelay(1);
+    }
+    vTaskDelete(nullptr);
+}
+
+static bool test_sample_store_concurrent_reads() noexcept {
+    if (!g_handler) return false;
+    auto* sensor = g_handler->GetSensor();
+    if (!sensor) { ESP_LOGE(TAG, "GetSensor() returned nullptr"); return false; }
+    sensor->EnableSensor(BNO085Sensor::Accelerometer, 10, 0.0f);
+    sensor->EnableSensor(BNO085Sensor::RotationVector, 10, 0.0f);
+
+    g_reader_running = true;
+    g_reader_pass = true;
+    g_reader_reads = 0;
+    g_reader_max_us = 0;
+    xTaskCreate(sample_reader_task, "bno_reader", 4096, g_handler.get(), 6, nullptr);
+
+    // This task owns the bus: pump the service loop while the reader copies.
+    const uint32_t snapshots_before = g_handler->GetImuSnapshotCount();
+    for (int i = 0; i < 200; ++i) {
+        g_handler->Update();
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    g_reader_running = false;
+    vTaskDelay(pdMS_TO_TICKS(50));  // Let the reader exit
+
+    const uint32_t snapshots = g_handler->GetImuSnapshotCount() - snapshots_before;
+    ESP_LOGI(TAG, "Sample store: %lu snapshots, %lu reads, max read latency %lld us",
+             static_cast<unsigned long>(snapshots), static_cast<unsigned long>(g_reader_reads),
+             static_cast<long long>(g_reader_max_us));
+
+    // Reads never wait for an I2C transfer, so they stay far below one transaction.
+    return g_reader_pass && g_reader_reads > 0 && g_reader_max_us < 500;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTS: SERVICE TASK (INT-driven)
+// ═══════════════════════════════════════════════════════════════════════════
+
+static bool test_service_task() noexcept {
+    if (!g_handler) return false;
+    auto* sensor = g_handler->GetSensor();
+    if (!sensor) { ESP_LOGE(TAG, "GetSensor() returned nullptr"); return false; }
+    sensor->EnableSensor(BNO085Sensor::RotationVector, 10, 0.0f);
+
+    auto err = g_handler->StartServiceTask();
+    if (err != Bno08xError::SUCCESS) {
+        ESP_LOGE(TAG, "StartServiceTask failed: %s", Bno08xErrorToString(err));
+        return false;
+    }
+
+    // No Update() calls from here on: the task must keep the store fresh.
+    const uint32_t snapshots_before = g_handler->GetImuSnapshotCount();
+    vTaskDelay(pdMS_TO_TICKS(1000));
+    const uint32_t snapshots = g_handler->GetImuSnapshotCount() - snapshots_before;
+
+    const Bno08xServiceStats stats = g_handler->GetServiceStats();
+    err = g_handler->StopServiceTask();
+
+    ESP_LOGI(TAG, "Service task: %lu snapshots/s, edges=%lu wakeups=%lu coalesced=%lu timeouts=%lu",
+             static_cast<unsigned long>(snapshots), static_cast<unsigned long>(stats.int_edges),
+             static_cast<unsigned long>(stats.wakeups), static_cast<unsigned long>(stats.coalesced_wakeups),
+             static_cast<unsigned long>(stats.idle_timeouts));
+    ESP_LOGI(TAG, "Service task: passes=%lu latency last=%lu us max=%lu us",
+             static_cast<unsigned long>(stats.service_passes),
+             static_cast<unsigned long>(stats.last_latency_us),
+             static_cast<unsigned long>(stats.max_latency_us));
+
+    // 100 Hz rotation vector: expect most reports to arrive via the task.
+    return err == Bno08xError::SUCCESS && !g_handler->IsServiceTaskRunning() &&
+           stats.int_edges > 0 && snapshots >= 50;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTS: REPORT RINGS
+// ═══════════════════════════════════════════════════════════════════════════
+
+/// Calibrated gyroscope input reports (SH-2 report ID 0x02) recorded from a BNO085
+/// turning slowly about z: ID, sequence, status (accuracy in bits 1:0), delay,
+/// then x, y, z as little-endian int16 Q9 rad/s.
+static constexpr uint8_t kRecordedGyroReports[][10] = {
+    {0x02, 0x31, 0x03, 0x00, 0x0C, 0x00, 0xF9, 0xFF, 0x1A, 0x01},
+    {0x02, 0x32, 0x03, 0x00, 0x0B, 0x00, 0xFA, 0xFF, 0x2E, 0x01},
+    {0x02, 0x33, 0x03, 0x00, 0x09, 0x00, 0xFC, 0xFF, 0x41, 0x01},
+    {0x02, 0x34, 0x03, 0x00, 0x08, 0x00, 0xFD, 0xFF, 0x4F, 0x01},
+    {0x02, 0x35, 0x02, 0x00, 0x06, 0x00, 0xFF, 0xFF, 0x58, 0x01},
+    {0x02, 0x36, 0x02, 0x00, 0x05, 0x00, 0x01, 0x00, 0x4B, 0x01},
+    {0x02, 0x37, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x36, 0x01},
+    {0x02, 0x38, 0x03, 0x00, 0x02, 0x00, 0x04, 0x00, 0x1F, 0x01},
+};
+static constexpr size_t kRecordedGyroCount = sizeof(kRecordedGyroReports) / sizeof(kRecordedGyroReports[0]);
+
+static SensorEvent g_replay_events[kRecordedGyroCount];
+static std::atomic<uint32_t> g_replay_produced{0};
+static std::atomic<bool> g_replay_rejected{false};
+
+/// Decode one recorded report the way the SH-2 layer hands it to the driver callback.
+static SensorEvent decode_sh2_gyro(const uint8_t* report) noexcept {
+    const auto q9 = [report](size_t at) noexcept {
+        return static_cast<float>(static_cast<int16_t>(report[at] | (report[at + 1] << 8))) / 512.0f;
+    };
+    SensorEvent event{};
+    event.sensor = BNO085Sensor::Gyroscope;
+    event.vector.x = q9(4);
+    event.vector.y = q9(6);
+    event.vector.z = q9(8);
+    event.vector.accuracy = static_cast<uint8_t>(report[2] & 0x03U);
+    return event;
+}
+
+/// 1 kHz producer: loops the recording through the handler's sensor-event path.
+static void replay_timer_callback(void* /*arg*/) {
+    const uint32_t n = g_replay_produced.load(std::memory_order_relaxed);
+    if (g_handler->ReplayEvent(g_replay_events[n % kRecordedGyroCount]) != Bno08xError::SUCCESS) {
+        g_replay_rejected = true;
+    }
+    g_replay_produced.store(n + 1, std::memory_order_release);
+}
+
+static bool test_report_ring_replay() noexcept {
+    if (!g_handler) return false;
+    Bno08xReportRingStats before{};
+    if (!g_handler->GetReportRingStats(BNO085Sensor::Gyroscope, before)) {
+        ESP_LOGE(TAG, "No gyroscope report ring");
+        return false;
+    }
+
+    // Live reports queued by earlier tests are not part of the replay.
+    Bno08xReport batch[32];
+    while (g_handler->DrainReports(BNO085Sensor::Gyroscope, batch, 32) > 0) {}
+    g_handler->GetReportRingStats(BNO085Sensor::Gyroscope, before);
+    for (size_t i = 0; i < kRecordedGyroCount; ++i) {
+        g_replay_events[i] = decode_sh2_gyro(kRecordedGyroReports[i]);
+    }
+    g_replay_produced = 0;
+    g_replay_rejected = false;
+
+    esp_timer_handle_t timer = nullptr;
+    esp_timer_create_args_t args{};
+    args.callback = replay_timer_callback;
+    args.name = "bno_replay";
+    if (esp_timer_create(&args, &timer) != ESP_OK) return false;
+    esp_timer_start_periodic(timer, 1000);
+
+    // Phase 1: drain in batches every 10 ms for one second - nothing may be lost.
+    uint32_t popped = 0;
+    uint16_t next_sequence = 0;
+    bool ordered = true;
+    for (int i = 0; i < 100; ++i) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        size_t n;
+        while ((n = g_handler->DrainReports(BNO085Sensor::Gyroscope, batch, 32)) > 0) {
+            for (size_t k = 0; k < n; ++k) {
+                const SensorEvent& expected = g_replay_events[popped % kRecordedGyroCount];
+                ordered &= (popped == 0 || batch[k].sequence == next_sequence) &&
+                           batch[k].sensor == BNO085Sensor::Gyroscope &&
+                           batch[k].data[0] == expected.vector.x && batch[k].data[1] == expected.vector.y &&
+                           batch[k].data[2] == expected.vector.z &&
+                           batch[k].accuracy == expected.vector.accuracy;
+                next_sequence = static_cast<uint16_t>(batch[k].sequence + 1);
+                ++popped;
+            }
+        }
+    }
+    Bno08xReportRingStats stats{};
+    g_handler->GetReportRingStats(BNO085Sensor::Gyroscope, stats);
+    const uint32_t dropped_while_draining = stats.dropped - before.dropped;
+
+    // Phase 2: stall the consumer past the ring depth - drops are counted, not blocking.
+    vTaskDelay(pdMS_TO_TICKS(200));
+    esp_timer_stop(timer);
+    esp_timer_delete(timer);
+    vTaskDelay(pdMS_TO_TICKS(5));  // let a callback already in flight finish
+    while (g_handler->DrainReports(BNO085Sensor::Gyroscope, batch, 32) > 0) {}
+
+    g_handler->GetReportRingStats(BNO085Sensor::Gyroscope, stats);
+    const uint32_t produced = g_replay_produced.load(std::memory_order_acquire);
+    const uint32_t pushed = stats.pushed - before.pushed;
+    const uint32_t dropped = stats.dropped - before.dropped;
+    ESP_LOGI(TAG, "Replay @1kHz: produced=%lu popped(phase1)=%lu pushed=%lu dropped=%lu peak=%lu",
+             static_cast<unsigned long>(produced), static_cast<unsigned long>(popped),
+             static_cast<unsigned long>(pushed), static_cast<unsigned long>(dropped),
+             static_cast<unsigned long>(stats.high_water));
+
+    return ordered && !g_replay_rejected && dropped_while_draining == 0 && popped > 900 &&
+           dropped > 0 && pushed + dropped == produced;
+}
+
+static bool test_report_ring_live() noexcept {
+    if (!g_handler) return false;
+    for (int i = 0; i < 50; ++i) {
+        g_handler->Update();
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    Bno08xReportRingStats stats{};
+    if (!g_handler->GetReportRingStats(BNO085Sensor::Accelerometer, stats)) {
+        ESP_LOGE(TAG, "No accelerometer report ring");
+        return false;
+    }
+
+    Bno08xReport batch[16];
+    size_t drained = 0;
+    size_t n;
+    uint64_t last_ts = 0;
+    bool monotonic = true;
+    while ((n = g_handler->DrainReports(BNO085Sensor::Accelerometer, batch, 16)) > 0) {
+        for (size_t k = 0; k < n; ++k) {
+            monotonic &= batch[k].timestamp_us >= last_ts;
+            last_ts = batch[k].timestamp_us;
+        }
+        drained += n;
+    }
+    ESP_LOGI(TAG, "Accel ring: depth=%lu pushed=%lu dropped=%lu peak=%lu drained=%u",
+             static_cast<unsigned long>(stats.capacity), static_cast<unsigned long>(stats.pushed),
+             static_cast<unsigned long>(stats.dropped), static_cast<unsigned long>(stats.high_water),
+             static_cast<unsigned>(drained));
+    return monotonic && drained > 0;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTS: DISPATCH BENCHMARK (static driver dispatch, inline callbacks)
+// ═══════════════════════════════════════════════════════════════════════════
+
+/// Stand-in for the former virtual driver interface, to time against.
+class VirtualDriverShim {
+public:
+    virtual ~VirtualDriverShim() = default;
+    virtual SensorEvent GetLatest(BNO085Sensor sensor) const noexcept = 0;
+};
+
+class VirtualDriverShimImpl final : public VirtualDriverShim {
+public:
+    explicit VirtualDriverShimImpl(const Bno08xDriver& drv) noexcept : drv_(drv) {}
+    SensorEvent GetLatest(BNO085Sensor sensor) const noexcept override { return drv_.GetLatest(sensor); }
+private:
+    const Bno08xDriver& drv_;
+};
+
+static volatile uint32_t g_dispatch_sink = 0;
+static volatile uint32_t g_live_callbacks = 0;
+
+static bool test_dispatch_overhead() noexcept {
+    if (!g_handler) return false;
+    auto* sensor = g_handler->GetSensor();
+    if (!sensor) { ESP_LOGE(TAG, "GetSensor() returned nullptr"); return false; }
+
+    constexpr uint32_t kIterations = 20000;
+    const SensorEvent event = sensor->GetLatest(BNO085Sensor::Accelerometer);
+
+    // Driver call: virtual interface vs variant dispatch (cached data, no bus I/O)
+    std::unique_ptr<VirtualDriverShim> shim = std::make_unique<VirtualDriverShimImpl>(*sensor);
+    int64_t t0 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIterations; ++i) {
+        g_dispatch_sink = g_dispatch_sink + shim->GetLatest(BNO085Sensor::Accelerometer).vector.accuracy;
+    }
+    int64_t t1 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIterations; ++i) {
+        g_dispatch_sink = g_dispatch_sink + sensor->GetLatest(BNO085Sensor::Accelerometer).vector.accuracy;
+    }
+    int64_t t2 = esp_timer_get_time();
+
+    // Report callback: std::function vs Bno08xEventCallback
+    uint32_t calls_fn = 0;
+    uint32_t calls_inline = 0;
+    std::function<void(const SensorEvent&)> fn_cb = [&calls_fn](const SensorEvent&) { ++calls_fn; };
+    Bno08xEventCallback inline_cb = [&calls_inline](const SensorEvent&) { ++calls_inline; };
+    int64_t t3 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIterations; ++i) fn_cb(event);
+    int64_t t4 = esp_timer_get_time();
+    for (uint32_t i = 0; i < kIterations; ++i) inline_cb(event);
+    int64_t t5 = esp_timer_get_time();
+
+    const auto ns_per = [](int64_t us) { return static_cast<double>(us) * 1000.0 / kIterations; };
+    ESP_LOGI(TAG, "Driver call:   virtual %.1f ns  static %.1f ns", ns_per(t1 - t0), ns_per(t2 - t1));
+    ESP_LOGI(TAG, "Callback:      std::function %.1f ns  inline %.1f ns", ns_per(t4 - t3), ns_per(t5 - t4));
+
+    // The inline callback must also work end-to-end through the handler.
+    g_live_callbacks = 0;
+    g_handler->SetSensorCallback([](const SensorEvent&) { g_live_callbacks = g_live_callbacks + 1; });
+    for (int i = 0; i < 20; ++i) {
+        g_handler->Update();
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    g_handler->ClearSensorCallback();
+    ESP_LOGI(TAG, "Live callbacks via Bno08xEventCallback: %lu", static_cast<unsigned long>(g_live_callbacks));
+
+    return calls_fn == kIterations && calls_inline == kIterations && g_live_callbacks > 0;
+}
+
+static void count_event(const SensorEvent&) noexcept { g_live_callbacks = g_live_callbacks + 1; }
+
+static bool test_inline_callback_empty() noexcept {
+    // Null function / member pointers must give an empty callback, not one that calls null.
+    void (*null_fn)(const SensorEvent&) = nullptr;
+    Bno08xEventCallback from_null_fn(null_fn);
+    Bno08xEventCallback from_null_context(static_cast<Bno08xEventCallback::ContextFn>(nullptr), nullptr);
+    BNO085Sensor SensorEvent::*null_member = nullptr;
+    InlineCallback<BNO085Sensor(const SensorEvent&)> from_null_member(null_member);
+    Bno08xEventCallback from_fn(&count_event);
+
+    g_live_callbacks = 0;
+    from_fn(SensorEvent{});
+    ESP_LOGI(TAG, "Empty: fn=%d context=%d member=%d; non-null fn=%d called=%lu",
+             static_cast<bool>(from_null_fn), static_cast<bool>(from_null_context),
+             static_cast<bool>(from_null_member), static_cast<bool>(from_fn),
+             static_cast<unsigned long>(g_live_callbacks));
+    return !from_null_fn && !from_null_context && !from_null_member && from_fn && g_live_callbacks == 1;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+// TESTS: QUATERNION MATH
+// ═══════════════════════════════════════════════════════════════════════════
+
+static constexpr size_t kEulerBenchCount = 256;
+static Bno08xQuaternion g_bench_quats[kEulerBenchCount];
+static Bno08xEulerAngles g_bench_exact[kEulerBenchCount];
+static Bno08xEulerAngles g_bench_fast[kEulerBenchCount];
+
+static float angle_error(float a, float b) noexcept {
+    float e = std::fabs(a - b);
+    return e > static_cast<float>(M_PI) ? 2.0f * static_cast<float>(M_PI) - e : e;
+}
+
+static bool test_euler_batch() noexcept {
+    // Deterministic pseudo-random unit quaternions
+    uint32_t lcg = 12345;
+    const auto next = [&lcg]() noexcept {
+        lcg = lcg * 1664525U + 1013904223U;
+        return static_cast<float>(lcg >> 8) / 8388608.0f - 1.0f;
+    };
+    for (auto& q : g_bench_quats) {
+        q.w = next(); q.x = next(); q.y = next(); q.z = next();
+        q.valid = Bno08xHandler::QuaternionNormalize(q);
+    }
+
+    constexpr int kRounds = 20;
+    int64_t t0 = esp_timer_get_time();
+    for (int r = 0; r < kRounds; ++r) {
+        for (size_t i = 0; i < kEulerBenchCount; ++i) {
+            Bno08xHandler::QuaternionToEuler(g_bench_quats[i], g_bench_exact[i]);
+        }
+    }
+    int64_t t1 = esp_timer_get_time();
+    for (int r = 0; r < kRounds; ++r) {
+        Bno08xHandler::QuaternionsToEuler(g_bench_quats, g_bench_fast, kEulerBenchCount,
+                                          Bno08xEulerMode::Fast);
+    }
+    int64_t t2 = esp_timer_get_time();
+
+    float max_err = 0.0f;
+    const auto accumulate_error = [&max_err]() noexcept {
+        for (size_t i = 0; i < kEulerBenchCount; ++i) {
+            if (!g_bench_quats[i].valid) continue;
+            max_err = std::fmax(max_err, angle_error(g_bench_exact[i].roll, g_bench_fast[i].roll));
+            max_err = std::fmax(max_err, angle_error(g_bench_exact[i].pitch, g_bench_fast[i].pitch));
+            max_err = std::fmax(max_err, angle_error(g_bench_exact[i].yaw, g_bench_fast[i].yaw));
+        }
+    };
+    accumulate_error();
+
+    // One report at a time, as publishEventLocked() converts: the scalar tail path.
+    int64_t t3 = esp_timer_get_time();
+    for (int r = 0; r < kRounds; ++r) {
+        for (size_t i = 0; i < kEulerBenchCount; ++i) {
+            Bno08xHandler::QuaternionsToEuler(&g_bench_quats[i], &g_bench_fast[i], 1, Bno08xEulerMode::Fast);
+        }
+    }
+    int64_t t4 = esp_timer_get_time();
+    accumulate_error();
+
+    // Two full blocks plus a short tail.
+    constexpr size_t kTailCount = 2 * Bno08xHandler::kEulerBatchBlock + 5;
+    Bno08xHandler::QuaternionsToEuler(g_bench_quats, g_bench_fast, kTailCount, Bno08xEulerMode::Fast);
+    accumulate_error();
+
+    const double total = static_cast<double>(kRounds * kEulerBenchCount);
+    ESP_LOGI(TAG, "Euler: scalar %.0f ns/q  fast batch %.0f ns/q  fast single %.0f ns/q  max error %.2e rad",
+             static_cast<double>(t1 - t0) * 1000.0 / total,
+             static_cast<double>(t2 - t1) * 1000.0 / total,
+             static_cast<double>(t4 - t3) * 1000.0 / total, static_cast<double>(max_err));
+    return max_err <= 1e-5f;
+}
+
+static bool test_quaternion_helpers() noexcept {
+    Bno08xQuaternion identity;
+    identity.valid = true;
+    Bno08xQuaternion yaw90;
+    yaw90.w = std::cos(static_cast<float>(M_PI) / 4.0f);
+    yaw90.z = std::sin(static_cast<float>(M_PI) / 4.0f);
+    yaw90.timestamp_us = 1000;
+    yaw90.valid = true;
+
+    Bno08xEulerAngles e;
+    const auto yaw_deg = [&e](const Bno08xQuaternion& q) {
+        Bno08xHandler::QuaternionToEuler(q, e);
+        return e.yaw * 180.0f / static_cast<float>(M_PI);
+    };
+
+    const float product = yaw_deg(Bno08xHandler::QuaternionMultiply(yaw90, yaw90));
+    const Bno08xQuaternion mid = Bno08xHandler::QuaternionSlerp(identity, yaw90, 0.5f);
+    const float halfway = yaw_deg(mid);
+
+    // -q is the same rotation; slerp must still take the short arc.
+    Bno08xQuaternion yaw90_neg = yaw90;
+    yaw90_neg.w = -yaw90_neg.w;
+    yaw90_neg.z = -yaw90_neg.z;
+    const float halfway_neg = yaw_deg(Bno08xHandler::QuaternionSlerp(identity, yaw90_neg, 0.5f));
+
+    Bno08xQuaternion scaled = yaw90;
+    scaled.w *= 3.0f;
+    scaled.z *= 3.0f;
+    const bool normalized = Bno08xHandler::QuaternionNormalize(scaled) &&
+                            std::fabs(scaled.w - yaw90.w) < 1e-6f;
+    Bno08xQuaternion zero;
+    zero.w = 0.0f;
+    const bool zero_rejected = !Bno08xHandler::QuaternionNormalize(zero);
+
+    ESP_LOGI(TAG, "yaw90*yaw90=%.3f deg  slerp(0.5)=%.3f deg (neg %.3f)  ts=%llu",
+             static_cast<double>(product), static_cast<double>(halfway),
+             static_cast<double>(halfway_neg), static_cast<unsigned long long>(mid.timestamp_us));
+
+    return std::fabs(std::fabs(product) - 180.0f) < 0.01f && std::fabs(halfway - 45.0f) < 0.01f &&
+           std::fabs(halfway_neg - 45.0f) < 0.01f && mid.timestamp_us == 500 && normalized &&
+           zero_rejected;
+}
+
 // ═══════════════════════════════════════════════════════════════════════════
 // MAIN
 // ═══════════════════════════════════════════════════════════════════════════
@@ -319,6 +786,37 @@ extern "C" void app_main(void) {
         flip_test_progress_indicator();
     );
 
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_THREAD_SAFETY_TESTS, "THREAD SAFETY",
+        RUN_TEST_IN_TASK("sample_store_reads", test_sample_store_concurrent_reads, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_SERVICE_TASK_TESTS, "SERVICE TASK",
+        RUN_TEST_IN_TASK("int_service_task", test_service_task, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_REPORT_RING_TESTS, "REPORT RINGS",
+        RUN_TEST_IN_TASK("replay_1khz", test_report_ring_replay, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("live_drain", test_report_ring_live, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_DISPATCH_BENCHMARK, "DISPATCH BENCHMARK",
+        RUN_TEST_IN_TASK("dispatch_overhead", test_dispatch_overhead, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("inline_callback_empty", test_inline_callback_empty, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_QUATERNION_MATH_TESTS, "QUATERNION MATH",
+        RUN_TEST_IN_TASK("euler_batch", test_euler_batch, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("quaternion_helpers", test_quaternion_helpers, 8192, 5);
+        flip_test_progress_indicator();
+    );
+
     print_test_summary(g_test_results, "BNO08x HANDLER COMPREHENSIVE", TAG);
 
     while (true) { vTaskDelay(pdMS_TO_TICKS(10000)); }
@@ -0,0 +1,211 @@
+/**
+ * @file mcp9700_handler_comprehensive_test.cpp
+ * @brief Comprehensive test suite for Mcp9700TemperatureHandler
+ *
+ * Tests: initialization, the float Mcp9700Thermistor path against the Q16
+ * raw-count path at fixed ADC counts, the ADC scaling check in SetAdcScaling()
+ * and Initialize(), and oversampling. The counts come from a scripted BaseAdc,
+ * so the suite runs on target without an MCP9700 attached.
+ *
+ * @author HardFOC Team
+ * @date 2025-2026
+ * @copyright GPL-3.0-or-later
+ */
+
+#include "TestFramework.h"
+
+#include "handlers/mcp9700/Mcp9700TemperatureHandler.h"
+
+#include <cmath>
+#include <memory>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#ifdef __cplusplus
+}
+#endif
+
+static const char* TAG = "MCP9700_Handler_Test";
+static TestResults g_test_results;
+
+static constexpr bool ENABLE_INITIALIZATION_TESTS = true;
+static constexpr bool ENABLE_RAW_COUNT_TESTS      = true;
+static constexpr bool ENABLE_SCALING_CHECK_TESTS  = true;
+static constexpr bool ENABLE_OVERSAMPLING_TESTS   = true;
+
+static constexpr hf_channel_id_t kChannel = 0;
+static constexpr float kReferenceV = 3.3f;
+static constexpr uint8_t kResolutionBits = 12;
+
+/**
+ * @brief BaseAdc returning a scripted count, with the voltage a 3.3 V / 12-bit
+ *        converter would report for it.
+ */
+class ScriptedAdc : public BaseAdc {
+public:
+    void SetCount(hf_u32_t count) noexcept { count_ = count; }
+
+    bool Initialize() noexcept override { return true; }
+    bool Deinitialize() noexcept override { return true; }
+    hf_u8_t GetMaxChannels() const noexcept override { return 1; }
+    bool IsChannelAvailable(hf_channel_id_t channel_id) const noexcept override {
+        return channel_id == kChannel;
+    }
+
+    hf_adc_err_t ReadChannelV(hf_channel_id_t channel_id, float& channel_reading_v, hf_u8_t = 1,
+                              hf_time_t = 0) noexcept override {
+        if (channel_id != kChannel) return hf_adc_err_t::ADC_ERR_INVALID_CHANNEL;
+        channel_reading_v = static_cast<float>(count_) * kReferenceV / static_cast<float>(1U << kResolutionBits);
+        return hf_adc_err_t::ADC_SUCCESS;
+    }
+
+    hf_adc_err_t ReadChannelCount(hf_channel_id_t channel_id, hf_u32_t& channel_reading_count, hf_u8_t = 1,
+                                  hf_time_t = 0) noexcept override {
+        if (channel_id != kChannel) return hf_adc_err_t::ADC_ERR_INVALID_CHANNEL;
+        channel_reading_count = count_;
+        return hf_adc_err_t::ADC_SUCCESS;
+    }
+
+    hf_adc_err_t ReadChannel(hf_channel_id_t channel_id, hf_u32_t& channel_reading_count,
+                             float& channel_reading_v, hf_u8_t = 1, hf_time_t = 0) noexcept override {
+        const hf_adc_err_t err = ReadChannelCount(channel_id, channel_reading_count);
+        return err != hf_adc_err_t::ADC_SUCCESS ? err : ReadChannelV(channel_id, channel_reading_v);
+    }
+
+    hf_adc_err_t ReadMultipleChannels(const hf_channel_id_t* channel_ids, hf_u8_t num_channels,
+                                      hf_u32_t* readings, float* voltages) noexcept override {
+        for (hf_u8_t i = 0; i < num_channels; ++i) {
+            const hf_adc_err_t err = ReadChannel(channel_ids[i], readings[i], voltages[i]);
+            if (err != hf_adc_err_t::ADC_SUCCESS) return err;
+        }
+        return hf_adc_err_t::ADC_SUCCESS;
+    }
+
+    hf_adc_err_t GetStatistics(hf_adc_statistics_t& statistics) noexcept override {
+        statistics = hf_adc_statistics_t{};
+        return hf_adc_err_t::ADC_SUCCESS;
+    }
+    hf_adc_err_t GetDiagnostics(hf_adc_diagnostics_t& diagnostics) noexcept override {
+        diagnostics = hf_adc_diagnostics_t{};
+        return hf_adc_err_t::ADC_SUCCESS;
+    }
+    hf_adc_err_t ResetStatistics() noexcept override { return hf_adc_err_t::ADC_SUCCESS; }
+    hf_adc_err_t ResetDiagnostics() noexcept override { return hf_adc_err_t::ADC_SUCCESS; }
+
+private:
+    hf_u32_t count_ = 931;  // 0.75 V, 25 °C
+};
+
+static ScriptedAdc g_adc;
+static std::unique_ptr<Mcp9700TemperatureHandler> g_float_handler;  // Mcp9700Thermistor path
+static std::unique_ptr<Mcp9700TemperatureHandler> g_raw_handler;    // Q16 raw-count path
+
+// ─────────────────────── Initialization ───────────────────────
+
+static bool test_initialize() noexcept {
+    g_float_handler = std::make_unique<Mcp9700TemperatureHandler>(&g_adc, kChannel, "MCP9700_Float");
+    g_raw_handler = std::make_unique<Mcp9700TemperatureHandler>(&g_adc, kChannel, "MCP9700_Raw");
+    g_adc.SetCount(931);
+    bool ok = g_float_handler->EnsureInitialized() && g_raw_handler->EnsureInitialized();
+    ok &= (g_raw_handler->SetAdcScaling(kReferenceV, kResolutionBits) == hf_temp_err_t::TEMP_SUCCESS);
+    ok &= g_raw_handler->IsRawCountPathEnabled() && !g_float_handler->IsRawCountPathEnabled();
+    ESP_LOGI(TAG, "Initialize: %s", ok ? "OK" : "FAILED");
+    return ok;
+}
+
+// ─────────────────────── Raw-count vs float ───────────────────────
+
+static bool test_raw_count_matches_float() noexcept {
+    if (!g_float_handler || !g_raw_handler) return false;
+    // -35, 0, 25, 50 and 100 °C on a 3.3 V / 12-bit ADC.
+    static constexpr hf_u32_t kCounts[] = {186, 621, 931, 1241, 1862};
+    bool ok = true;
+    for (hf_u32_t count : kCounts) {
+        g_adc.SetCount(count);
+        float float_c = 0.0f;
+        int32_t raw_centi = 0;
+        if (g_float_handler->ReadTemperatureCelsius(&float_c) != hf_temp_err_t::TEMP_SUCCESS ||
+            g_raw_handler->ReadTemperatureCentiCelsius(&raw_centi) != hf_temp_err_t::TEMP_SUCCESS) {
+            return false;
+        }
+        const float diff = std::fabs(static_cast<float>(raw_centi) * 0.01f - float_c);
+        ESP_LOGI(TAG, "count %4lu: float %.3f °C, raw %.2f °C (diff %.3f)", static_cast<unsigned long>(count),
+                 static_cast<double>(float_c), static_cast<double>(raw_centi) * 0.01, static_cast<double>(diff));
+        // Q16 rounding adds at most half a centi-degree.
+        ok &= (diff <= 0.02f);
+    }
+    return ok;
+}
+
+// ─────────────────────── Scaling check ───────────────────────
+
+static bool test_scaling_check() noexcept {
+    if (!g_raw_handler) return false;
+    g_adc.SetCount(931);
+
+    // 10 bits predicts ~233 counts for 0.75 V, the ADC reports 931: rejected,
+    // and the previous scaling stays in place.
+    bool ok = (g_raw_handler->SetAdcScaling(kReferenceV, 10) == hf_temp_err_t::TEMP_ERR_INVALID_PARAMETER);
+    ok &= g_raw_handler->IsRawCountPathEnabled();
+    int32_t centi = 0;
+    ok &= (g_raw_handler->ReadTemperatureCentiCelsius(&centi) == hf_temp_err_t::TEMP_SUCCESS);
+    ok &= (std::abs(centi - 2500) <= 5);
+
+    // A wrong reference set before Initialize() is dropped there.
+    Mcp9700TemperatureHandler late(&g_adc, kChannel, "MCP9700_Late");
+    ok &= (late.SetAdcScaling(1.1f, kResolutionBits) == hf_temp_err_t::TEMP_SUCCESS);
+    ok &= late.EnsureInitialized();
+    ok &= !late.IsRawCountPathEnabled();
+
+    // Below 1/8 of full scale the pair proves nothing, so even 11 bits passes.
+    g_adc.SetCount(200);
+    Mcp9700TemperatureHandler cold(&g_adc, kChannel, "MCP9700_Cold");
+    ok &= cold.EnsureInitialized();
+    ok &= (cold.SetAdcScaling(kReferenceV, 11) == hf_temp_err_t::TEMP_SUCCESS);
+    ESP_LOGI(TAG, "Scaling check: %s", ok ? "OK" : "FAILED");
+    return ok;
+}
+
+// ─────────────────────── Oversampling ───────────────────────
+
+static bool test_oversampling() noexcept {
+    if (!g_raw_handler) return false;
+    bool ok = (g_raw_handler->SetOversampling(4) == hf_temp_err_t::TEMP_SUCCESS);
+    int32_t centi = 0;
+    for (hf_u32_t count : {621U, 621U, 1241U, 1241U}) {
+        g_adc.SetCount(count);
+        ok &= (g_raw_handler->ReadTemperatureCentiCelsius(&centi) == hf_temp_err_t::TEMP_SUCCESS);
+    }
+    // Window of 0, 0, 50, 50 °C.
+    ok &= (std::abs(centi - 2500) <= 5);
+    ok &= (g_raw_handler->SetOversampling(1) == hf_temp_err_t::TEMP_SUCCESS);
+    ESP_LOGI(TAG, "Oversampled: %.2f °C", static_cast<double>(centi) * 0.01);
+    return ok;
+}
+
+extern "C" void app_main(void) {
+    ESP_LOGI(TAG, "\n");
+    ESP_LOGI(TAG, "╔══════════════════════════════════════════════════════════════╗");
+    ESP_LOGI(TAG, "║   MCP9700 TEMPERATURE HANDLER COMPREHENSIVE TEST SUITE      ║");
+    ESP_LOGI(TAG, "╚══════════════════════════════════════════════════════════════╝");
+
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_INITIALIZATION_TESTS, "INITIALIZATION",
+        RUN_TEST_IN_TASK("init", test_initialize, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_RAW_COUNT_TESTS, "RAW-COUNT VS FLOAT",
+        RUN_TEST_IN_TASK("raw_vs_float", test_raw_count_matches_float, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_SCALING_CHECK_TESTS, "ADC SCALING CHECK",
+        RUN_TEST_IN_TASK("scaling_check", test_scaling_check, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_OVERSAMPLING_TESTS, "OVERSAMPLING",
+        RUN_TEST_IN_TASK("oversampling", test_oversampling, 8192, 5); flip_test_progress_indicator();
+    );
+
+    print_test_summary(g_test_results, "MCP9700 TEMPERATURE HANDLER COMPREHENSIVE", TAG);
+    while (true) { vTaskDelay(pdMS_TO_TICKS(10000)); }
+}
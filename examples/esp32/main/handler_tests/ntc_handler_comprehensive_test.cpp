@@ -2,10 +2,14 @@
  * @file ntc_handler_comprehensive_test.cpp
  * @brief Comprehensive test suite for NtcTemperatureHandler
  *
- * Tests: BaseAdc-driven init, temperature reading (Celsius/Fahrenheit), calibration
+ * Tests: BaseAdc-driven init, temperature reading (Celsius/Fahrenheit), combined
+ * single-acquisition readings, calibration
  * offset, EMA filtering, voltage divider config, conversion methods, threshold
  * monitoring, continuous monitoring (PeriodicTimer), statistics, diagnostics,
- * self-test, health check, sleep mode, and thread safety via RtosMutex.
+ * self-test, health check, sleep mode, thread safety via RtosMutex, and the
+ * compile-time fixed-point LUT conversion path (accuracy and speed vs. float),
+ * the batched multi-thermistor bank with its BaseTemperature views, and
+ * non-blocking incremental oversampling.
  *
  * @author HardFOC Team
  * @date 2025-2026
@@ -17,7 +21,10 @@
 #include "esp32_test_config.hpp"
 
 #include "handlers/ntc/NtcTemperatureHandler.h"
+#include "handlers/ntc/NtcThermistorBank.h"
+#include "handlers/common/TemperatureSamplingScheduler.h"
 
+#include <atomic>
 #include <cmath>
 #include <memory>
 
@@ -25,6 +32,7 @@
 extern "C" {
 #endif
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #ifdef __cplusplus
@@ -43,6 +51,11 @@ static constexpr bool ENABLE_CONTINUOUS_MONITORING_TESTS = true;
 static constexpr bool ENABLE_STATISTICS_TESTS           = true;
 static constexpr bool ENABLE_SLEEP_MODE_TESTS           = true;
 static constexpr bool ENABLE_ERROR_HANDLING_TESTS        = true;
+static constexpr bool ENABLE_FIXED_POINT_LUT_TESTS       = true;
+static constexpr bool ENABLE_THERMISTOR_BANK_TESTS       = true;
+static constexpr bool ENABLE_INCREMENTAL_SAMPLING_TESTS  = true;
+static constexpr bool ENABLE_SAMPLING_SCHEDULER_TESTS    = true;
+static constexpr bool ENABLE_MONITORING_REGISTRY_TESTS   = true;
 
 static std::unique_ptr<NtcTemperatureHandler> g_handler;
 
@@ -136,6 +149,31 @@ static bool test_read_temperature_consistency() noexcept {
     return consistent;
 }
 
+static bool test_combined_reading() noexcept {
+    if (!g_handler) return false;
+    ntc_temp_handler_reading_t reading{};
+    auto err = g_handler->ReadCombined(&reading);
+    if (err != TEMP_SUCCESS) {
+        ESP_LOGW(TAG, "ReadCombined failed: %d (may be OK if NTC not connected)",
+                 static_cast<int>(err));
+        return true; // Pass even without hardware
+    }
+    ESP_LOGI(TAG, "Combined: raw=%" PRIu32 " %.3fV %.0fΩ %.2f°C", reading.raw_count,
+             reading.voltage_volts, reading.resistance_ohms, reading.temperature_celsius);
+
+    // Diagnostics and the cached reading must describe the same acquisition.
+    hf_temp_diagnostics_t diag{};
+    g_handler->GetDiagnostics(diag);
+    ntc_temp_handler_reading_t last{};
+    if (g_handler->GetLastReading(&last) != TEMP_SUCCESS) return false;
+    bool consistent = (diag.current_temperature_raw == reading.raw_count) &&
+                      (last.raw_count == reading.raw_count) &&
+                      (last.timestamp_us == reading.timestamp_us);
+    ESP_LOGI(TAG, "Raw count consistent with diagnostics/last reading: %s",
+             consistent ? "YES" : "NO");
+    return consistent;
+}
+
 // ─────────────────────── Calibration ───────────────────────
 
 static bool test_set_calibration_offset() noexcept {
@@ -272,6 +310,365 @@ static bool test_health_check() noexcept {
     return err == TEMP_SUCCESS;
 }
 
+// ─────────────────────── Fixed-Point LUT ───────────────────────
+
+// Matches create_handler(): default NTC type, 10k series resistor, 3.3 V, 12-bit.
+static constexpr NtcFixedPointLut kTestNtcLut{
+    MakeNtcLutParams(NtcType::NtcG163Jft103Ft1S, 10000.0f, 3.3f, 12)};
+static_assert(kTestNtcLut.IsValid(), "test LUT parameters rejected");
+
+/// Same thermistor built for another ADC: must be refused by the handler and the bank.
+static constexpr NtcFixedPointLut kWrongResolutionLut{MakeNtcLutParams(10000.0f, 3435.0f, 10000.0f, 3.3f, 13)};
+static constexpr NtcFixedPointLut kWrongReferenceLut{MakeNtcLutParams(10000.0f, 3435.0f, 10000.0f, 1.1f, 12)};
+static_assert(kTestNtcLut.MatchesConfig(10000.0f, 3.3f, 12) && !kWrongResolutionLut.MatchesConfig(10000.0f, 3.3f, 12),
+              "LUT configuration check");
+static_assert(!kTestNtcLut.MatchesAdcReading(1000, 1.6f) && kTestNtcLut.MatchesAdcReading(2000, 1.6f),
+              "LUT ADC scaling check");
+
+/// Float reference: Beta equation on the same divider (what the LUT approximates).
+static float beta_reference_celsius(uint32_t count) noexcept {
+    const float ratio = static_cast<float>(count) / 4096.0f;
+    const float r_ntc = 10000.0f * ratio / (1.0f - ratio);
+    const float t_inv = 1.0f / 298.15f + std::log(r_ntc / 10000.0f) / 3435.0f;
+    return 1.0f / t_inv - 273.15f;
+}
+
+static bool test_lut_accuracy() noexcept {
+    float max_error = 0.0f;
+    uint32_t worst_count = 0;
+    for (uint32_t count = 1; count < 4095; ++count) {
+        const float reference = beta_reference_celsius(count);
+        if (reference < -40.0f || reference > 125.0f) continue;
+        const float lut = static_cast<float>(kTestNtcLut.CountToCentiCelsius(count)) * 0.01f;
+        const float error = std::fabs(lut - reference);
+        if (error > max_error) {
+            max_error = error;
+            worst_count = count;
+        }
+    }
+    ESP_LOGI(TAG, "LUT vs float: max error %.3f°C at count %" PRIu32 " (%.2f°C)",
+             max_error, worst_count, beta_reference_celsius(worst_count));
+    return max_error < 0.2f;
+}
+
+static bool test_lut_benchmark() noexcept {
+    static constexpr uint32_t kPasses = 4;
+    volatile int32_t lut_sink = 0;
+    volatile float float_sink = 0.0f;
+
+    int64_t start = esp_timer_get_time();
+    for (uint32_t pass = 0; pass < kPasses; ++pass) {
+        for (uint32_t count = 1; count < 4095; ++count) {
+            lut_sink = kTestNtcLut.CountToCentiCelsius(count);
+        }
+    }
+    const int64_t lut_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (uint32_t pass = 0; pass < kPasses; ++pass) {
+        for (uint32_t count = 1; count < 4095; ++count) {
+            float_sink = beta_reference_celsius(count);
+        }
+    }
+    const int64_t float_us = esp_timer_get_time() - start;
+    (void)lut_sink;
+    (void)float_sink;
+
+    const uint32_t conversions = kPasses * 4094U;
+    ESP_LOGI(TAG, "%" PRIu32 " conversions: LUT %lld us (%.1f ns each), float %lld us (%.1f ns each), %.1fx",
+             conversions, lut_us, 1000.0f * static_cast<float>(lut_us) / conversions,
+             float_us, 1000.0f * static_cast<float>(float_us) / conversions,
+             lut_us > 0 ? static_cast<float>(float_us) / static_cast<float>(lut_us) : 0.0f);
+    return lut_us < float_us;
+}
+
+static bool test_lut_handler_read() noexcept {
+    if (!g_handler) return false;
+    if (g_handler->SetFixedPointLut(&kWrongResolutionLut) != TEMP_ERR_INVALID_PARAMETER ||
+        g_handler->SetFixedPointLut(&kWrongReferenceLut) != TEMP_ERR_INVALID_PARAMETER ||
+        g_handler->IsFixedPointLutActive()) {
+        ESP_LOGE(TAG, "Mismatched LUT accepted");
+        return false;
+    }
+    if (g_handler->SetFixedPointLut(&kTestNtcLut) != TEMP_SUCCESS) return false;
+    bool active = g_handler->IsFixedPointLutActive();
+
+    int32_t centi = 0;
+    auto err = g_handler->ReadTemperatureCentiCelsius(&centi);
+    g_handler->SetFixedPointLut(nullptr);
+    bool restored = !g_handler->IsFixedPointLutActive();
+
+    if (err != TEMP_SUCCESS) {
+        ESP_LOGW(TAG, "LUT read failed: %d (may be OK if NTC not connected)", static_cast<int>(err));
+        return active && restored;
+    }
+
+    float float_temp = 0.0f;
+    if (g_handler->ReadTemperatureCelsius(&float_temp) != TEMP_SUCCESS) {
+        return active && restored;
+    }
+    const float diff = std::fabs(static_cast<float>(centi) * 0.01f - float_temp);
+    ESP_LOGI(TAG, "LUT read %.2f°C, float read %.2f°C (diff %.2f°C)",
+             static_cast<float>(centi) * 0.01f, float_temp, diff);
+    return active && restored && diff < 1.0f;
+}
+
+// ─────────────────────── Thermistor Bank ───────────────────────
+
+static bool test_thermistor_bank() noexcept {
+    auto* adc = get_shared_adc();
+    if (!adc) return false;
+
+    NtcThermistorBank bank(*adc);
+    uint8_t index = 0xFF;
+    if (bank.AddChannel({NTC_ADC_CHANNEL, &kTestNtcLut, 0.0f, "bank_ntc"}, &index) != TEMP_SUCCESS) {
+        return false;
+    }
+    // A second slot on the same channel exercises the batched path with N > 1.
+    if (bank.AddChannel({NTC_ADC_CHANNEL, &kTestNtcLut, 1.0f, "bank_ntc_offset"}) != TEMP_SUCCESS) {
+        return false;
+    }
+    if (bank.AddChannel({NTC_ADC_CHANNEL, nullptr, 0.0f, "no_lut"}) != TEMP_ERR_INVALID_PARAMETER) {
+        return false;
+    }
+    // Every table must be built for the bank's single ADC.
+    if (bank.AddChannel({NTC_ADC_CHANNEL, &kWrongResolutionLut, 0.0f, "wrong_bits"}) != TEMP_ERR_INVALID_PARAMETER) {
+        return false;
+    }
+
+    auto err = bank.Scan();
+    if (err != TEMP_SUCCESS) {
+        ESP_LOGW(TAG, "Bank scan failed: %d (ReadMultipleChannels may be unsupported)",
+                 static_cast<int>(err));
+        return bank.GetChannelCount() == 2;
+    }
+
+    int32_t centi[NtcThermistorBank::kMaxChannels] = {};
+    size_t copied = bank.CopyCentiCelsius(centi, NtcThermistorBank::kMaxChannels);
+    uint32_t raw = 0;
+    bank.GetRawCount(index, &raw);
+    ESP_LOGI(TAG, "Bank scan: %u channels, raw=%" PRIu32 ", [0]=%.2f°C [1]=%.2f°C",
+             static_cast<unsigned>(copied), raw, centi[0] * 0.01f, centi[1] * 0.01f);
+    // Same sample, same table: channels differ exactly by the 1.00 °C offset
+    // unless the value is clamped at the range limit.
+    bool offset_ok = (centi[1] - centi[0] == 100) || centi[0] <= -4000 || centi[0] >= 12500;
+
+    // Views: with a 1 s cache window, back-to-back reads share one scan.
+    bank.SetMaxSampleAgeUs(1000000);
+    bank.ResetStats();
+    BaseTemperature* view0 = bank.GetChannel(0);
+    BaseTemperature* view1 = bank.GetChannel(1);
+    float t0 = 0.0f, t1 = 0.0f;
+    bool views_ok = view0 && view1 &&
+                    view0->ReadTemperatureCelsius(&t0) == TEMP_SUCCESS &&
+                    view1->ReadTemperatureCelsius(&t1) == TEMP_SUCCESS;
+    NtcBankStats stats = bank.GetStats();
+    ESP_LOGI(TAG, "Views: %.2f°C / %.2f°C, view reads=%" PRIu32 " cache hits=%" PRIu32,
+             t0, t1, stats.view_reads, stats.view_cache_hits);
+    bank.DumpDiagnostics();
+
+    return copied == 2 && offset_ok && views_ok && bank.GetAdcMismatchMask() == 0 &&
+           stats.view_reads == 2 && stats.view_cache_hits == 2;
+}
+
+// ─────────────────────── Incremental Sampling ───────────────────────
+
+static bool test_incremental_sampling() noexcept {
+    if (!g_handler) return false;
+
+    // Blocking equivalent of this configuration stalls 7 * 5 ms = 35 ms per read.
+    g_handler->SetSamplingParameters(8, 5);
+    if (g_handler->SetIncrementalSampling(true) != TEMP_SUCCESS) return false;
+    bool enabled = g_handler->IsIncrementalSampling();
+
+    int64_t max_read_us = 0;
+    bool reads_ok = true;
+    for (int i = 0; i < 12; ++i) {
+        float temp = 0.0f;
+        const int64_t start = esp_timer_get_time();
+        auto err = g_handler->ReadTemperatureCelsius(&temp);
+        const int64_t elapsed = esp_timer_get_time() - start;
+        if (err != TEMP_SUCCESS) {
+            reads_ok = false;
+            break;
+        }
+        if (elapsed > max_read_us) max_read_us = elapsed;
+    }
+
+    uint32_t filled = 0, window = 0;
+    g_handler->GetIncrementalFill(&filled, &window);
+    ntc_temp_handler_reading_t last{};
+    bool have_last = (g_handler->GetLastReading(&last) == TEMP_SUCCESS);
+
+    g_handler->SetIncrementalSampling(false);
+    g_handler->SetSamplingParameters(1, 0);
+
+    if (!reads_ok) {
+        ESP_LOGW(TAG, "Incremental reads failed (may be OK if NTC not connected)");
+        return enabled;
+    }
+    ESP_LOGI(TAG, "Incremental: window %" PRIu32 "/%" PRIu32 ", last avg %.2f°C over %" PRIu32
+             " samples, max read %lld us", filled, window, last.temperature_celsius,
+             last.sample_count, max_read_us);
+    return enabled && filled == 8 && window == 8 && have_last && last.sample_count == 8 &&
+           max_read_us < 5000;
+}
+
+// ─────────────────────── Sampling Scheduler ───────────────────────
+
+static volatile int g_scheduled_handler_count = 0;
+static volatile int g_scheduled_bank_count = 0;
+
+static void scheduled_handler_callback(BaseTemperature*, const hf_temp_reading_t*, void*) {
+    g_scheduled_handler_count++;
+}
+
+static void scheduled_bank_callback(BaseTemperature*, const hf_temp_reading_t*, void*) {
+    g_scheduled_bank_count++;
+}
+
+static bool test_sampling_scheduler() noexcept {
+    if (!g_handler) return false;
+    auto* adc = get_shared_adc();
+    if (!adc) return false;
+
+    // Static: the scheduler carries its own task stack.
+    static TemperatureSamplingScheduler scheduler(5);
+    if (!scheduler.EnsureInitialized() || !scheduler.Start()) {
+        ESP_LOGW(TAG, "Scheduler task could not start");
+        return false;
+    }
+    scheduler.ResetStats();
+    g_scheduled_handler_count = 0;
+    g_scheduled_bank_count = 0;
+
+    // Handler monitoring through the scheduler instead of its own PeriodicTimer.
+    g_handler->SetIncrementalSampling(true);
+    bool attached = g_handler->SetSamplingScheduler(&scheduler) == TEMP_SUCCESS;
+    bool started = g_handler->StartContinuousMonitoring(20, scheduled_handler_callback, nullptr) == TEMP_SUCCESS;
+    hf_u32_t handler_id = g_handler->GetSchedulerSensorId();
+
+    // Two bank views with the same period and batch context: one scan per
+    // wakeup, and the default sample age serves both views from it.
+    NtcThermistorBank bank(*adc);
+    bank.AddChannel({NTC_ADC_CHANNEL, &kTestNtcLut, 0.0f, "sched_ntc_a"});
+    bank.AddChannel({NTC_ADC_CHANNEL, &kTestNtcLut, 0.0f, "sched_ntc_b"});
+    hf_u32_t bank_ids[2] = {};
+    bool bank_added = true;
+    for (uint8_t i = 0; i < 2; ++i) {
+        bank_added &= scheduler.AddSensor({bank.GetChannel(i), 100, scheduled_bank_callback, nullptr,
+                                           &NtcThermistorBank::ScanBatch, &bank},
+                                          &bank_ids[i]) == TEMP_SUCCESS;
+    }
+
+    vTaskDelay(pdMS_TO_TICKS(1000));
+
+    TemperatureSamplingStats handler_stats{};
+    scheduler.GetSensorStats(handler_id, &handler_stats);
+    scheduler.DumpDiagnostics();
+
+    g_handler->StopContinuousMonitoring();
+    bool id_cleared = g_handler->GetSchedulerSensorId() == 0;
+    for (hf_u32_t id : bank_ids) {
+        scheduler.RemoveSensor(id);
+    }
+    // Removed IDs are stale and rejected, even after the slot is reused.
+    bool stale_rejected = scheduler.RemoveSensor(bank_ids[0]) == TEMP_ERR_INVALID_PARAMETER &&
+                          scheduler.RemoveSensor(handler_id) == TEMP_ERR_INVALID_PARAMETER;
+    const TemperatureSchedulerStats stats = scheduler.GetStats();
+    const NtcBankStats bank_stats = bank.GetStats();
+
+    g_handler->SetSamplingScheduler(nullptr);
+    g_handler->SetIncrementalSampling(false);
+    scheduler.Stop();
+
+    ESP_LOGI(TAG, "Scheduler: handler callbacks=%d (misses=%" PRIu32 ", max late=%" PRIu32 " us), "
+             "bank callbacks=%d, batch acquires=%" PRIu32 ", shared reads=%" PRIu32 ", bank scans=%" PRIu32,
+             g_scheduled_handler_count, handler_stats.deadline_misses, handler_stats.max_lateness_us,
+             g_scheduled_bank_count, stats.batch_acquires, stats.batched_reads, bank_stats.scan_count);
+
+    // ~20 handler samples and ~10 grouped bank wakeups in one second.
+    return attached && started && handler_id != 0 && bank_added && id_cleared && stale_rejected &&
+           g_scheduled_handler_count >= 15 && g_scheduled_bank_count >= 16 &&
+           stats.batched_reads >= 8 && stats.batch_acquires >= 8 &&
+           bank_stats.scan_count == stats.batch_acquires &&
+           bank_stats.view_cache_hits == bank_stats.view_reads &&
+           scheduler.GetSensorCount() == 0;
+}
+
+// ─────────────────────── Monitoring Registry Stress ───────────────────────
+
+static std::atomic<int> g_stress_callback_count{0};
+static std::atomic<int> g_stress_tasks_done{0};
+static std::atomic<bool> g_stress_pass{true};
+static std::atomic<bool> g_stress_abort{false};  ///< Ends the toggle tasks early (timeout path).
+
+static void stress_callback(BaseTemperature*, const hf_temp_reading_t*, void*) {
+    g_stress_callback_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void monitoring_toggle_task(void* param) {
+    auto* handler = static_cast<NtcTemperatureHandler*>(param);
+    for (int i = 0; i < 50 && !g_stress_abort.load(); ++i) {
+        // 500 Hz ticks keep timer callbacks in flight while the context is released.
+        if (handler->StartContinuousMonitoring(500, stress_callback, nullptr) != TEMP_SUCCESS) {
+            g_stress_pass = false;
+        }
+        vTaskDelay(pdMS_TO_TICKS(2 + (i % 5)));
+        handler->StopContinuousMonitoring();
+    }
+    g_stress_tasks_done.fetch_add(1);
+    vTaskDelete(nullptr);
+}
+
+static bool test_monitoring_registry_stress() noexcept {
+    if (!g_handler) return false;
+    auto* adc = get_shared_adc();
+    if (!adc) return false;
+
+    ntc_temp_handler_config_t config = NTC_TEMP_HANDLER_CONFIG_DEFAULT();
+    config.adc_channel = NTC_ADC_CHANNEL;
+    config.sensor_name = "Stress_NTC";
+    auto second = std::make_unique<NtcTemperatureHandler>(adc, config);
+    if (!second || !second->EnsureInitialized()) return false;
+
+    g_stress_callback_count = 0;
+    g_stress_tasks_done = 0;
+    g_stress_pass = true;
+    g_stress_abort = false;
+    const hf_u32_t stale_before = NtcTemperatureHandler::GetStaleMonitoringCallbackCount();
+
+    // Two handlers start/stop concurrently while their timer callbacks resolve IDs.
+    int tasks = 0;
+    tasks += xTaskCreate(monitoring_toggle_task, "ntc_toggle_0", 4096, g_handler.get(), 5, nullptr) == pdPASS;
+    tasks += xTaskCreate(monitoring_toggle_task, "ntc_toggle_1", 4096, second.get(), 5, nullptr) == pdPASS;
+    for (int wait = 0; wait < 100 && g_stress_tasks_done < tasks; ++wait) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    bool finished = (tasks == 2) && (g_stress_tasks_done == tasks);
+
+    // On timeout, stop the tasks and wait for them: `second` must outlive its toggle task.
+    g_stress_abort = true;
+    while (g_stress_tasks_done < tasks) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+
+    // After the last stop no callback may reach either handler.
+    vTaskDelay(pdMS_TO_TICKS(20));
+    const int settled = g_stress_callback_count.load();
+    vTaskDelay(pdMS_TO_TICKS(100));
+    bool quiet = (g_stress_callback_count.load() == settled);
+
+    // Slots were all released: a fresh registration still succeeds.
+    bool restart_ok = g_handler->StartContinuousMonitoring(10, stress_callback, nullptr) == TEMP_SUCCESS;
+    g_handler->StopContinuousMonitoring();
+
+    ESP_LOGI(TAG, "Registry stress: finished=%d callbacks=%d stale ticks dropped=%" PRIu32
+             " quiet=%d restart=%d", finished, settled,
+             NtcTemperatureHandler::GetStaleMonitoringCallbackCount() - stale_before, quiet, restart_ok);
+    return finished && g_stress_pass.load() && quiet && restart_ok && settled > 0;
+}
+
 // ═══════════════════════ ENTRY POINT ═══════════════════════
 
 extern "C" void app_main(void) {
@@ -290,6 +687,7 @@ extern "C" void app_main(void) {
     RUN_TEST_SECTION_IF_ENABLED(ENABLE_TEMPERATURE_READING_TESTS, "TEMPERATURE READING",
         RUN_TEST_IN_TASK("read_temp", test_read_temperature, 8192, 5); flip_test_progress_indicator();
         RUN_TEST_IN_TASK("consistency", test_read_temperature_consistency, 8192, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("combined", test_combined_reading, 8192, 5); flip_test_progress_indicator();
     );
     RUN_TEST_SECTION_IF_ENABLED(ENABLE_CALIBRATION_TESTS, "CALIBRATION",
         RUN_TEST_IN_TASK("offset", test_set_calibration_offset, 8192, 5); flip_test_progress_indicator();
@@ -314,6 +712,23 @@ extern "C" void app_main(void) {
         RUN_TEST_IN_TASK("self_test", test_self_test, 8192, 5); flip_test_progress_indicator();
         RUN_TEST_IN_TASK("health", test_health_check, 8192, 5); flip_test_progress_indicator();
     );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_FIXED_POINT_LUT_TESTS, "FIXED-POINT LUT",
+        RUN_TEST_IN_TASK("lut_accuracy", test_lut_accuracy, 8192, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("lut_benchmark", test_lut_benchmark, 8192, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("lut_handler_read", test_lut_handler_read, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_THERMISTOR_BANK_TESTS, "THERMISTOR BANK",
+        RUN_TEST_IN_TASK("bank", test_thermistor_bank, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_INCREMENTAL_SAMPLING_TESTS, "INCREMENTAL SAMPLING",
+        RUN_TEST_IN_TASK("incremental", test_incremental_sampling, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_SAMPLING_SCHEDULER_TESTS, "SAMPLING SCHEDULER",
+        RUN_TEST_IN_TASK("scheduler", test_sampling_scheduler, 8192, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_MONITORING_REGISTRY_TESTS, "MONITORING REGISTRY",
+        RUN_TEST_IN_TASK("registry_stress", test_monitoring_registry_stress, 8192, 5); flip_test_progress_indicator();
+    );
 
     print_test_summary(g_test_results, "NTC TEMPERATURE HANDLER COMPREHENSIVE", TAG);
     while (true) { vTaskDelay(pdMS_TO_TICKS(10000)); }
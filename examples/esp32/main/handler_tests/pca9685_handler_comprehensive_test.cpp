@@ -4,7 +4,8 @@
  *
  * Tests the PCA9685 16-channel PWM controller handler: I2C comm adapter,
  * EnsureInitialized delegation, PWM duty cycle control, frequency setting,
- * sleep/wake, PwmAdapter, GpioPin wrapper, and error handling.
+ * sleep/wake, PwmAdapter, deferred (burst) updates, write suppression,
+ * servo trajectories, GpioPin wrapper, and error handling.
  *
  * @author HardFOC Team
  * @date 2025-2026
@@ -14,8 +15,10 @@
 #include "TestFramework.h"
 #include "esp32_bus_setup.hpp"
 #include "esp32_test_config.hpp"
+#include "gpio_pin_registry_test.hpp"
 
 #include "handlers/pca9685/Pca9685Handler.h"
+#include "handlers/pca9685/Pca9685ServoTrajectory.h"
 
 #include <memory>
 
@@ -23,6 +26,7 @@
 extern "C" {
 #endif
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #ifdef __cplusplus
@@ -39,6 +43,9 @@ static constexpr bool ENABLE_SLEEP_WAKE_TESTS      = true;
 static constexpr bool ENABLE_PWM_ADAPTER_TESTS     = true;
 static constexpr bool ENABLE_GPIO_PIN_TESTS        = true;
 static constexpr bool ENABLE_PHASE_OFFSET_TESTS    = true;
+static constexpr bool ENABLE_DEFERRED_UPDATE_TESTS = true;
+static constexpr bool ENABLE_WRITE_SUPPRESSION_TESTS = true;
+static constexpr bool ENABLE_SERVO_TRAJECTORY_TESTS = true;
 static constexpr bool ENABLE_ERROR_HANDLING_TESTS   = true;
 
 static std::unique_ptr<Pca9685Handler> g_handler;
@@ -107,6 +114,151 @@ static bool test_sleep_wake() noexcept {
     return ok;
 }
 
+static bool test_deferred_update_all() noexcept {
+    if (!g_pwm) return false;
+    auto adapter = std::static_pointer_cast<Pca9685PwmAdapter>(g_pwm);
+
+    // Immediate mode: one I2C transaction per channel.
+    int64_t t0 = esp_timer_get_time();
+    bool ok = true;
+    for (hf_channel_id_t ch = 0; ch < 16; ++ch) {
+        ok &= (adapter->SetDutyCycle(ch, 0.05f + 0.005f * ch) == hf_pwm_err_t::PWM_SUCCESS);
+    }
+    const int64_t immediate_us = esp_timer_get_time() - t0;
+
+    // Deferred mode: stage all 16 channels, then one auto-increment burst.
+    ok &= (adapter->SetDeferredUpdates(true) == hf_pwm_err_t::PWM_SUCCESS);
+    t0 = esp_timer_get_time();
+    for (hf_channel_id_t ch = 0; ch < 16; ++ch) {
+        ok &= (adapter->SetDutyCycle(ch, 0.10f - 0.005f * ch) == hf_pwm_err_t::PWM_SUCCESS);
+    }
+    ok &= (adapter->GetPendingChannelMask() == 0xFFFF);
+    ok &= (adapter->UpdateAll() == hf_pwm_err_t::PWM_SUCCESS);
+    const int64_t deferred_us = esp_timer_get_time() - t0;
+    ok &= (adapter->GetPendingChannelMask() == 0);
+
+    // Leaving deferred mode flushes anything still staged.
+    ok &= (adapter->SetDutyCycle(3, 0.5f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->GetPendingChannelMask() == (1U << 3));
+    ok &= (adapter->SetDeferredUpdates(false) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->GetPendingChannelMask() == 0);
+
+    ESP_LOGI(TAG, "16-channel update: immediate=%lld us, deferred burst=%lld us",
+             static_cast<long long>(immediate_us), static_cast<long long>(deferred_us));
+    return ok;
+}
+
+static bool test_write_suppression() noexcept {
+    if (!g_handler || !g_pwm) return false;
+    auto adapter = std::static_pointer_cast<Pca9685PwmAdapter>(g_pwm);
+    bool ok = (adapter->SetDutyCycle(4, 0.3f) == hf_pwm_err_t::PWM_SUCCESS);
+    for (hf_channel_id_t ch : {3, 5, 6}) {
+        ok &= (adapter->SetDutyCycle(ch, 0.05f) == hf_pwm_err_t::PWM_SUCCESS);
+    }
+
+    // Repeating an unchanged value must not reach the bus.
+    g_handler->ResetWriteStats();
+    for (int i = 0; i < 10; ++i) {
+        ok &= (adapter->SetDutyCycle(4, 0.3f) == hf_pwm_err_t::PWM_SUCCESS);
+    }
+    auto stats = g_handler->GetWriteStats();
+    ok &= (stats.channel_writes == 0) && (stats.suppressed_writes == 10);
+
+    // Deferred flush: ch0-2 and ch7 change, ch4 is staged unchanged. One burst
+    // covers ch0-7; ch3-6 go out as filler with the values the chip holds.
+    ok &= (adapter->SetDeferredUpdates(true) == hf_pwm_err_t::PWM_SUCCESS);
+    g_handler->ResetWriteStats();
+    ok &= (adapter->SetDutyCycle(0, 0.11f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDutyCycle(1, 0.12f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDutyCycle(2, 0.13f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDutyCycle(4, 0.3f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDutyCycle(7, 0.17f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->UpdateAll() == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDeferredUpdates(false) == hf_pwm_err_t::PWM_SUCCESS);
+    stats = g_handler->GetWriteStats();
+    ok &= (stats.channel_writes == 8) && (stats.suppressed_writes == 0);
+    ok &= (stats.burst_count == 1) && (stats.merged_writes == 7) && (stats.filler_writes == 4);
+
+    // A gap the handler holds no shadow for splits the burst: ch9 is unknown
+    // after invalidation, so ch8 and ch10 go out as two single-channel writes,
+    // neither of which counts as a burst.
+    g_handler->InvalidateWriteCache();
+    ok &= (adapter->SetDutyCycle(8, 0.2f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDutyCycle(10, 0.2f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDeferredUpdates(true) == hf_pwm_err_t::PWM_SUCCESS);
+    g_handler->ResetWriteStats();
+    ok &= (adapter->SetDutyCycle(8, 0.21f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDutyCycle(10, 0.21f) == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->UpdateAll() == hf_pwm_err_t::PWM_SUCCESS);
+    ok &= (adapter->SetDeferredUpdates(false) == hf_pwm_err_t::PWM_SUCCESS);
+    const auto split = g_handler->GetWriteStats();
+    ok &= (split.channel_writes == 2) && (split.burst_count == 0) && (split.merged_writes == 0) &&
+          (split.filler_writes == 0);
+
+    ESP_LOGI(TAG, "Writes=%lu suppressed=%lu merged=%lu bursts=%lu filler=%lu",
+             static_cast<unsigned long>(stats.channel_writes),
+             static_cast<unsigned long>(stats.suppressed_writes),
+             static_cast<unsigned long>(stats.merged_writes),
+             static_cast<unsigned long>(stats.burst_count),
+             static_cast<unsigned long>(stats.filler_writes));
+    return ok;
+}
+
+static bool test_trajectory_kinematics() noexcept {
+    // Pure fixed-point math: 1500 -> 2000 us, 2000 us/s, 8000 us/s^2, 20 ms frames.
+    constexpr int32_t kVStep = 40 << 16;               // 2000 us/s * 20 ms
+    constexpr int32_t kAStep = (32 << 16) / 10;        // 8000 us/s^2 * (20 ms)^2 = 3.2 us
+    int32_t pos = 1500 << 16;
+    int32_t vel = 0;
+    const int32_t target = 2000 << 16;
+    int frames = 0;
+    bool ok = true;
+    while ((pos != target || vel != 0) && frames < 500) {
+        const int32_t prev_vel = vel;
+        Pca9685ServoTrajectory::StepAxis(pos, vel, target, kVStep, kAStep);
+        ok &= (vel <= kVStep) && (vel - prev_vel <= kAStep);
+        ++frames;
+    }
+    ok &= (pos == target) && (frames < 500);
+    // 1500 us at 50 Hz = 1500 * 50 * 4096 / 1e6 = 307.2 ticks.
+    ok &= (Pca9685ServoTrajectory::PulseToTicks(1500 << 16, 50) == 307);
+    ESP_LOGI(TAG, "Trajectory 500 us move settled in %d frames: %s", frames, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+static bool test_trajectory_engine() noexcept {
+    if (!g_pwm) return false;
+    auto adapter = std::static_pointer_cast<Pca9685PwmAdapter>(g_pwm);
+    bool ok = (adapter->SetFrequency(0, 50) == hf_pwm_err_t::PWM_SUCCESS);
+
+    Pca9685ServoTrajectory servos(*adapter);
+    Pca9685ServoConfig cfg;
+    cfg.max_velocity_us_per_s = 2000;
+    cfg.max_accel_us_per_s2 = 8000;
+    for (uint8_t ch = 0; ch < 16; ++ch) {
+        ok &= (servos.ConfigureChannel(ch, cfg) == hf_pwm_err_t::PWM_SUCCESS);
+        ok &= (servos.SetPosition(ch, 1500) == hf_pwm_err_t::PWM_SUCCESS);
+    }
+    ok &= (servos.Start(50) == hf_pwm_err_t::PWM_SUCCESS);
+    for (uint8_t ch = 0; ch < 16; ++ch) {
+        ok &= (servos.SetTarget(ch, (ch & 1) ? 1000 : 2000) == hf_pwm_err_t::PWM_SUCCESS);
+    }
+
+    // 500 us moves take ~0.5 s; allow generous settling time.
+    for (int i = 0; i < 30 && servos.IsAnyMoving(); ++i) {
+        vTaskDelay(pdMS_TO_TICKS(100));
+    }
+    ok &= !servos.IsAnyMoving();
+    ok &= (servos.GetPosition(0) == 2000) && (servos.GetPosition(1) == 1000);
+    servos.Stop();
+
+    const auto stats = servos.GetStats();
+    ok &= (stats.frame_count > 0) && (stats.write_failures == 0);
+    servos.DumpDiagnostics();
+    ok &= (adapter->SetDeferredUpdates(false) == hf_pwm_err_t::PWM_SUCCESS);
+    return ok;
+}
+
 static bool test_gpio_pin_wrapper() noexcept {
     if (!g_handler) return false;
     auto pin = g_handler->CreateGpioPin(0);
@@ -119,6 +271,11 @@ static bool test_gpio_pin_wrapper() noexcept {
     return err == hf_gpio_err_t::GPIO_SUCCESS;
 }
 
+static bool test_gpio_pin_registry_storage() noexcept {
+    if (!g_handler) return false;
+    return RunGpioPinRegistryTest(*g_handler, TAG);
+}
+
 static bool test_error_invalid_channel() noexcept {
     if (!g_pwm) return false;
     auto err = g_pwm->SetDutyCycle(16, 0.5f);  // Channel 16 invalid (0-15)
@@ -153,9 +310,25 @@ extern "C" void app_main(void) {
         RUN_TEST_IN_TASK("sleep_wake", test_sleep_wake, 8192, 5);
         flip_test_progress_indicator();
     );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_DEFERRED_UPDATE_TESTS, "DEFERRED UPDATES",
+        RUN_TEST_IN_TASK("deferred_burst", test_deferred_update_all, 8192, 5);
+        flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_WRITE_SUPPRESSION_TESTS, "WRITE SUPPRESSION",
+        RUN_TEST_IN_TASK("write_suppress", test_write_suppression, 8192, 5);
+        flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_SERVO_TRAJECTORY_TESTS, "SERVO TRAJECTORY",
+        RUN_TEST_IN_TASK("traj_math", test_trajectory_kinematics, 8192, 5);
+        flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("traj_engine", test_trajectory_engine, 8192, 5);
+        flip_test_progress_indicator();
+    );
     RUN_TEST_SECTION_IF_ENABLED(ENABLE_GPIO_PIN_TESTS, "GPIO PIN WRAPPER",
         RUN_TEST_IN_TASK("gpio_pin", test_gpio_pin_wrapper, 8192, 5);
         flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("gpio_registry", test_gpio_pin_registry_storage, 8192, 5);
+        flip_test_progress_indicator();
     );
     RUN_TEST_SECTION_IF_ENABLED(ENABLE_ERROR_HANDLING_TESTS, "ERROR HANDLING",
         RUN_TEST_IN_TASK("invalid_ch", test_error_invalid_channel, 8192, 5);
@@ -4,7 +4,9 @@
  *
  * Tests: I2C comm, EnsureInitialized, per-pin direction/read/write/toggle,
  * batch 16-bit operations, interrupt management (deferred ISR), chip variant
- * detection (PCA9555 vs PCAL9555A), Agile I/O features, and GpioPin wrapper.
+ * detection (PCA9555 vs PCAL9555A), Agile I/O features, GpioPin wrapper, and
+ * the shared-INT aggregator (idle skipping needs a second expander at
+ * PCAL95555_SECOND_I2C_ADDR on the same INT line).
  *
  * @author HardFOC Team
  * @date 2025-2026
@@ -14,8 +16,10 @@
 #include "TestFramework.h"
 #include "esp32_bus_setup.hpp"
 #include "esp32_test_config.hpp"
+#include "gpio_pin_registry_test.hpp"
 
 #include "handlers/pcal95555/Pcal95555Handler.h"
+#include "handlers/pcal95555/Pcal95555InterruptAggregator.h"
 
 #include <memory>
 
@@ -134,6 +138,147 @@ static bool test_drain_pending_interrupts() noexcept {
     return true;
 }
 
+static bool test_shared_interrupt_aggregator() noexcept {
+    auto* dev = get_i2c_device(PCAL95555_I2C_ADDR);
+    if (!dev) return false;
+
+    // Tear down the dedicated-INT handler so the aggregator can own the pin.
+    g_handler.reset();
+
+    Pcal95555Handler shared_handler(*dev);
+    Pcal95555InterruptAggregator aggregator(*g_int_gpio);
+    if (aggregator.RegisterExpander(shared_handler, 1) != hf_gpio_err_t::GPIO_SUCCESS) {
+        return false;
+    }
+    if (!shared_handler.EnsureInitialized() || !shared_handler.HasInterruptSupport()) {
+        return false;
+    }
+    // Double registration must be rejected.
+    if (aggregator.RegisterExpander(shared_handler, 1) == hf_gpio_err_t::GPIO_SUCCESS) {
+        return false;
+    }
+    if (aggregator.EnableInterrupt() != hf_gpio_err_t::GPIO_SUCCESS) return false;
+
+    // Nothing pending yet: a drain must be a no-op.
+    bool ok = !aggregator.DrainPendingInterrupts();
+
+    // Raise a real edge without extra wiring: watch an unconnected input and
+    // flip its internal pull so the level changes and INT asserts.
+    static constexpr uint8_t kEdgePin = 15;
+    uint32_t edge_callbacks = 0;
+    auto edge_pin = shared_handler.CreateGpioPin(kEdgePin);
+    ok &= edge_pin && edge_pin->ConfigureInterrupt(
+                          hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_BOTH_EDGES,
+                          [](BaseGpio*, hf_gpio_interrupt_trigger_t, void* user_data) {
+                              ++*static_cast<uint32_t*>(user_data);
+                          },
+                          &edge_callbacks) == hf_gpio_err_t::GPIO_SUCCESS;
+    if (shared_handler.HasAgileIO()) {
+        ok &= shared_handler.SetPullMode(kEdgePin, hf_gpio_pull_mode_t::HF_GPIO_PULL_MODE_UP) ==
+              hf_gpio_err_t::GPIO_SUCCESS;
+        vTaskDelay(pdMS_TO_TICKS(5));
+        aggregator.DrainPendingInterrupts();
+        edge_callbacks = 0;
+        aggregator.ResetStats();
+
+        ok &= shared_handler.SetPullMode(kEdgePin, hf_gpio_pull_mode_t::HF_GPIO_PULL_MODE_DOWN) ==
+              hf_gpio_err_t::GPIO_SUCCESS;
+        vTaskDelay(pdMS_TO_TICKS(5));
+        ok &= aggregator.DrainPendingInterrupts();
+    } else {
+        ESP_LOGW(TAG, "PCA9555 has no pull control, skipping shared-INT edge check");
+    }
+
+    Pcal95555InterruptStats stats{};
+    ok &= aggregator.GetExpanderStats(shared_handler, stats);
+    if (shared_handler.HasAgileIO()) {
+        ok &= stats.service_count > 0 && stats.active_count > 0 && edge_callbacks > 0;
+    }
+    ESP_LOGI(TAG, "Aggregator: drains=%u reads=%u callbacks=%u skipped=%u max_latency=%uus",
+             static_cast<unsigned>(aggregator.GetDrainCount()),
+             static_cast<unsigned>(stats.service_count),
+             static_cast<unsigned>(edge_callbacks),
+             static_cast<unsigned>(stats.skipped_idle),
+             static_cast<unsigned>(stats.max_latency_us));
+    aggregator.DumpDiagnostics();
+
+    ok &= aggregator.UnregisterExpander(shared_handler) == hf_gpio_err_t::GPIO_SUCCESS;
+    ok &= !shared_handler.IsSharedInterruptAttached();
+    aggregator.DisableInterrupt();
+
+    // Restore the dedicated-INT handler for the remaining sections.
+    g_handler = std::make_unique<Pcal95555Handler>(*dev, g_int_gpio.get());
+    ok &= g_handler->EnsureInitialized();
+    return ok;
+}
+
+static bool test_shared_interrupt_idle_masks() noexcept {
+    auto* dev = get_i2c_device(PCAL95555_I2C_ADDR);
+    auto* second_dev = get_i2c_device(PCAL95555_SECOND_I2C_ADDR);
+    if (!dev || !second_dev) return false;
+
+    Pcal95555Handler second(*second_dev);
+    if (!second.EnsureInitialized()) {
+        ESP_LOGW(TAG, "No expander at 0x%02X, skipping shared-INT idle test",
+                 PCAL95555_SECOND_I2C_ADDR);
+        return true;
+    }
+    if (!second.HasAgileIO()) {
+        ESP_LOGW(TAG, "Second expander is a PCA9555 (no interrupt mask), skipping");
+        return true;
+    }
+
+    // Without an aggregator, init leaves the mask alone: the handler reports the
+    // power-on mask, but does not claim the chip matches it.
+    uint16_t first_mask = 0;
+    uint16_t second_mask = 0;
+    bool ok = second.GetAllInterruptMasks(second_mask) == hf_gpio_err_t::GPIO_SUCCESS &&
+              second_mask == 0xFFFF && !second.IsInterruptMaskKnown();
+
+    g_handler.reset();
+    Pcal95555Handler first(*dev);
+    Pcal95555InterruptAggregator aggregator(*g_int_gpio);
+    ok &= aggregator.RegisterExpander(first, 1) == hf_gpio_err_t::GPIO_SUCCESS &&
+          aggregator.RegisterExpander(second, 2) == hf_gpio_err_t::GPIO_SUCCESS &&
+          first.EnsureInitialized();
+
+    // Registration (second) and init while registered (first) mask every pin,
+    // so the aggregator may skip both without a status read.
+    ok &= first.GetAllInterruptMasks(first_mask) == hf_gpio_err_t::GPIO_SUCCESS && first_mask == 0xFFFF;
+    ok &= second.GetAllInterruptMasks(second_mask) == hf_gpio_err_t::GPIO_SUCCESS && second_mask == 0xFFFF;
+    ok &= first.IsInterruptMaskKnown() && second.IsInterruptMaskKnown();
+
+    // Unmasking a pin on one expander leaves the other fully masked (idle).
+    ok &= first.SetInterruptMask(3, false) == hf_gpio_err_t::GPIO_SUCCESS;
+    ok &= first.GetAllInterruptMasks(first_mask) == hf_gpio_err_t::GPIO_SUCCESS && first_mask == 0xFFF7;
+    ok &= second.GetAllInterruptMasks(second_mask) == hf_gpio_err_t::GPIO_SUCCESS && second_mask == 0xFFFF;
+
+    // A re-initialized handler re-masks the chip instead of trusting a stale shadow.
+    ok &= first.EnsureDeinitialized() && first.EnsureInitialized();
+    ok &= first.GetAllInterruptMasks(first_mask) == hf_gpio_err_t::GPIO_SUCCESS && first_mask == 0xFFFF;
+
+    // Direct driver access drops the shadow. The next mask change rewrites the
+    // whole mask and keeps the pins with registered callbacks unmasked.
+    auto watched = second.CreateGpioPin(6);
+    ok &= watched && watched->ConfigureInterrupt(
+                         hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_BOTH_EDGES,
+                         [](BaseGpio*, hf_gpio_interrupt_trigger_t, void*) {}) == hf_gpio_err_t::GPIO_SUCCESS;
+    ok &= second.GetDriver() != nullptr && !second.IsInterruptMaskKnown();
+    ok &= second.SetInterruptMask(9, false) == hf_gpio_err_t::GPIO_SUCCESS && second.IsInterruptMaskKnown();
+    ok &= second.GetAllInterruptMasks(second_mask) == hf_gpio_err_t::GPIO_SUCCESS &&
+          second_mask == static_cast<uint16_t>(~((1U << 6) | (1U << 9)));
+    ok &= second.SetInterruptMask(9, true) == hf_gpio_err_t::GPIO_SUCCESS;
+
+    ESP_LOGI(TAG, "Shared INT idle: masks 0x%04X / 0x%04X, ok=%d", first_mask, second_mask, ok);
+
+    aggregator.UnregisterExpander(first);
+    aggregator.UnregisterExpander(second);
+
+    g_handler = std::make_unique<Pcal95555Handler>(*dev, g_int_gpio.get());
+    ok &= g_handler->EnsureInitialized();
+    return ok;
+}
+
 static bool test_gpio_pin_wrapper() noexcept {
     if (!g_handler) return false;
     auto pin = g_handler->GetGpioPin(5);
@@ -143,6 +288,11 @@ static bool test_gpio_pin_wrapper() noexcept {
     return ok;
 }
 
+static bool test_pin_registry_storage() noexcept {
+    if (!g_handler) return false;
+    return RunGpioPinRegistryTest(*g_handler, TAG);
+}
+
 static bool test_error_invalid_pin() noexcept {
     if (!g_handler) return false;
     auto err = g_handler->SetOutput(16, true);
@@ -178,9 +328,12 @@ extern "C" void app_main(void) {
     RUN_TEST_SECTION_IF_ENABLED(ENABLE_INTERRUPT_TESTS, "INTERRUPT MANAGEMENT",
         RUN_TEST_IN_TASK("supports_int", test_supports_interrupts, 8192, 5); flip_test_progress_indicator();
         RUN_TEST_IN_TASK("drain_int", test_drain_pending_interrupts, 8192, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("shared_int", test_shared_interrupt_aggregator, 8192, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("shared_int_idle", test_shared_interrupt_idle_masks, 8192, 5); flip_test_progress_indicator();
     );
     RUN_TEST_SECTION_IF_ENABLED(ENABLE_GPIO_PIN_WRAPPER_TESTS, "GPIO PIN WRAPPER",
         RUN_TEST_IN_TASK("pin_wrap", test_gpio_pin_wrapper, 8192, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("pin_registry", test_pin_registry_storage, 8192, 5); flip_test_progress_indicator();
     );
     RUN_TEST_SECTION_IF_ENABLED(ENABLE_ERROR_HANDLING_TESTS, "ERROR HANDLING",
         RUN_TEST_IN_TASK("invalid_pin", test_error_invalid_pin, 8192, 5); flip_test_progress_indicator();
@@ -5,7 +5,9 @@
  * Tests: Config-based construction, initialization, pixel set (individual +
  * all), clear, show, brightness, animation effects (rainbow, chase, breathe),
  * tick/step, GetNumLeds, direct strip/animator access, diagnostics dump,
- * and pre-init error handling.
+ * pre-init error handling, the lookup-table symbol encoder (against bitwise
+ * encoding, chunked as the RMT driver requests it, benchmarked for 300 LEDs)
+ * and the double-buffered frame path.
  *
  * @note This test requires a WS2812B LED strip connected to the data GPIO.
  *       Without hardware, initialization may still succeed (RMT configures
@@ -22,13 +24,16 @@
 
 #include "handlers/ws2812/Ws2812Handler.h"
 
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 #include "esp_log.h"
 #include "driver/gpio.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #ifdef __cplusplus
@@ -46,6 +51,8 @@ static constexpr bool ENABLE_ANIMATION_TESTS       = true;
 static constexpr bool ENABLE_DIRECT_ACCESS_TESTS   = true;
 static constexpr bool ENABLE_DIAGNOSTICS_TESTS     = true;
 static constexpr bool ENABLE_ERROR_HANDLING_TESTS  = true;
+static constexpr bool ENABLE_SYMBOL_ENCODER_TESTS  = true;
+static constexpr bool ENABLE_FRAME_BUFFER_TESTS    = true;
 
 static std::unique_ptr<Ws2812Handler> g_handler;
 
@@ -281,6 +288,130 @@ static bool test_deinitialize() noexcept {
     return ok && !still_init;
 }
 
+// ─────────────────────── Symbol Encoder ───────────────────────
+
+static constexpr size_t kBenchLeds = 300;
+static constexpr size_t kBenchBytes = kBenchLeds * 3;
+
+static void fill_pattern(std::vector<uint8_t>& frame) noexcept {
+    uint32_t x = 1;
+    for (auto& b : frame) {
+        x = x * 1664525U + 1013904223U;
+        b = static_cast<uint8_t>(x >> 24);
+    }
+}
+
+static bool test_encoder_lut() noexcept {
+    const auto defaults = Ws2812Handler::GetDefaultConfig();
+    Ws2812SymbolEncoder enc;
+    if (!enc.Configure(defaults.resolution_hz, defaults.t0h, defaults.t0l, defaults.t1h, defaults.t1l,
+                       defaults.reset_us)) {
+        ESP_LOGE(TAG, "Configure with default timings failed");
+        return false;
+    }
+
+    std::vector<uint8_t> frame(kBenchBytes);
+    fill_pattern(frame);
+    std::vector<uint32_t> lut(kBenchBytes * Ws2812SymbolEncoder::kSymbolsPerByte);
+    std::vector<uint32_t> bitwise(lut.size());
+    enc.Encode(frame.data(), frame.size(), lut.data());
+    enc.EncodeBitwise(frame.data(), frame.size(), bitwise.data());
+    const bool lut_ok = lut == bitwise;
+
+    // Feed the frame through EncodeChunk() the way the RMT driver does: half its 64-symbol memory at a time
+    lut.push_back(enc.GetResetSymbol());
+    std::vector<uint32_t> chunked;
+    size_t written = 0;
+    bool done = false;
+    uint32_t calls = 0;
+    while (!done && calls < 10000) {
+        uint32_t mem[32];
+        const size_t n = enc.EncodeChunk(frame.data(), frame.size(), written, 32, mem, done);
+        chunked.insert(chunked.end(), mem, mem + n);
+        written += n;
+        ++calls;
+    }
+    const bool chunk_ok = chunked == lut;
+
+    // Timings that round to 0 ticks must be rejected
+    const bool rejects_zero = !enc.Configure(defaults.resolution_hz, 20, defaults.t0l, defaults.t1h, defaults.t1l);
+
+    ESP_LOGI(TAG, "LUT vs bitwise: %s, chunked (%lu calls): %s, zero-tick timing %s",
+             lut_ok ? "match" : "MISMATCH", static_cast<unsigned long>(calls), chunk_ok ? "match" : "MISMATCH",
+             rejects_zero ? "rejected" : "ACCEPTED");
+    return lut_ok && chunk_ok && rejects_zero;
+}
+
+static bool test_encoder_benchmark() noexcept {
+    const auto defaults = Ws2812Handler::GetDefaultConfig();
+    Ws2812SymbolEncoder enc;
+    enc.Configure(defaults.resolution_hz, defaults.t0h, defaults.t0l, defaults.t1h, defaults.t1l, defaults.reset_us);
+
+    std::vector<uint8_t> frame(kBenchBytes);
+    fill_pattern(frame);
+    std::vector<uint32_t> symbols(kBenchBytes * Ws2812SymbolEncoder::kSymbolsPerByte);
+    constexpr int kIterations = 50;
+
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < kIterations; ++i) enc.EncodeBitwise(frame.data(), frame.size(), symbols.data());
+    const int64_t bitwise_us = (esp_timer_get_time() - start) / kIterations;
+
+    start = esp_timer_get_time();
+    for (int i = 0; i < kIterations; ++i) enc.Encode(frame.data(), frame.size(), symbols.data());
+    const int64_t lut_us = (esp_timer_get_time() - start) / kIterations;
+
+    ESP_LOGI(TAG, "Encode %u LEDs: bitwise %lld us, LUT %lld us, wire time %lu us",
+             static_cast<unsigned>(kBenchLeds), static_cast<long long>(bitwise_us), static_cast<long long>(lut_us),
+             static_cast<unsigned long>(enc.GetFrameTimeUs(kBenchBytes)));
+    return lut_us < bitwise_us;
+}
+
+// ─────────────────────── Frame Buffers ───────────────────────
+
+static bool test_frame_buffers() noexcept {
+    if (!g_hw_present) { ESP_LOGW(TAG, "SKIP: no hardware"); return true; }
+
+    // Runs after the deinit test, so the data GPIO is free for a frame-path handler
+    Ws2812Handler::Config cfg = {};
+    cfg.gpio_pin = static_cast<gpio_num_t>(PIN_WS2812_DATA);
+    cfg.num_leds = WS2812_NUM_LEDS;
+    cfg.brightness = 50;
+    cfg.use_frame_buffers = true;
+    auto frames = std::make_unique<Ws2812Handler>(cfg);
+
+    if (frames->Initialize() != ESP_OK) {
+        ESP_LOGE(TAG, "Frame path init failed");
+        return false;
+    }
+    const bool no_strip = frames->GetStrip() == nullptr && frames->GetAnimator() == nullptr;
+    const bool size_ok = frames->GetFrameBytes() == static_cast<size_t>(WS2812_NUM_LEDS) * 3;
+    const bool range_ok = !frames->SetFramePixel(WS2812_NUM_LEDS, 0xFFFFFF);
+
+    // Red dot chasing along the strip
+    constexpr uint32_t kFrames = 60;
+    bool pass = no_strip && size_ok && range_ok;
+    const int64_t start = esp_timer_get_time();
+    for (uint32_t n = 0; n < kFrames && pass; ++n) {
+        frames->ClearFrame();
+        pass &= frames->SetFramePixel(n % WS2812_NUM_LEDS, 0xFF0000);
+        pass &= frames->PresentFrame() == ESP_OK;
+    }
+    pass &= frames->WaitFrameDone() == ESP_OK;
+    const int64_t elapsed_us = esp_timer_get_time() - start;
+
+    Ws2812FrameStats stats{};
+    pass &= frames->GetFrameStats(stats);
+    frames->DumpDiagnostics();
+    pass &= frames->Deinitialize() && !frames->IsInitialized();
+
+    ESP_LOGI(TAG, "Frame path: %lu frames in %lld us, wire ~%lu us/frame, max wait %lu us, errors %lu",
+             static_cast<unsigned long>(kFrames), static_cast<long long>(elapsed_us),
+             static_cast<unsigned long>(stats.wire_time_us), static_cast<unsigned long>(stats.max_wait_us),
+             static_cast<unsigned long>(stats.transmit_errors));
+    // Initialization sends one blank frame before the rendered ones
+    return pass && stats.frames == kFrames + 1 && stats.transmit_errors == 0;
+}
+
 // ═══════════════════════ ENTRY POINT ═══════════════════════
 
 extern "C" void app_main(void) {
@@ -327,6 +458,13 @@ extern "C" void app_main(void) {
         RUN_TEST_IN_TASK("before_init", test_operations_before_init, 16384, 10); flip_test_progress_indicator();
         RUN_TEST_IN_TASK("deinit", test_deinitialize, 8192, 5); flip_test_progress_indicator();
     );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_SYMBOL_ENCODER_TESTS, "SYMBOL ENCODER",
+        RUN_TEST_IN_TASK("lut", test_encoder_lut, 16384, 5); flip_test_progress_indicator();
+        RUN_TEST_IN_TASK("bench", test_encoder_benchmark, 16384, 5); flip_test_progress_indicator();
+    );
+    RUN_TEST_SECTION_IF_ENABLED(ENABLE_FRAME_BUFFER_TESTS, "FRAME BUFFERS",
+        RUN_TEST_IN_TASK("frames", test_frame_buffers, 16384, 10); flip_test_progress_indicator();
+    );
 
     print_test_summary(g_test_results, "WS2812 HANDLER COMPREHENSIVE", TAG);
     while (true) { vTaskDelay(pdMS_TO_TICKS(10000)); }
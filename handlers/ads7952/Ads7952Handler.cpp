@@ -16,6 +16,7 @@
 #include <cstring>
 #include <algorithm>
 #include "handlers/logger/Logger.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/OsUtility.h"
 #include "esp_log.h"
 
 //======================================================//
@@ -52,6 +53,20 @@ void Ads7952SpiAdapter::transfer(const uint8_t* tx, uint8_t* rx, std::size_t len
 
 static constexpr const char* TAG = "Ads7952Handler";
 
+namespace {
+
+/// Number of channels in a scan mask.
+inline uint8_t ChannelsInMask(uint16_t mask) noexcept {
+    uint8_t n = 0;
+    for (; mask != 0; mask &= static_cast<uint16_t>(mask - 1U)) ++n;
+    return n;
+}
+
+/// Frames of slack a burst may spend on stale or mis-tagged conversions.
+constexpr uint32_t kBurstFrameSlack = 4;
+
+}  // namespace
+
 Ads7952Handler::Ads7952Handler(BaseSpi& spi_interface,
                                const Ads7952HandlerConfig& config) noexcept
     : BaseAdc(),
@@ -140,6 +155,12 @@ bool Ads7952Handler::Deinitialize() noexcept {
     initialized_ = false;
     total_reads_ = 0;
     error_count_ = 0;
+    programmed_auto1_mask_ = 0;
+    streaming_ = false;
+    burst_samples_ = 0;
+    burst_samples_per_second_ = 0.0f;
+    latest_valid_ = false;
+    ring_count_ = 0;
 
     Logger::GetInstance().Info(TAG, "[Dev%u] Deinitialized", config_.device_index);
     return true;
@@ -167,20 +188,16 @@ hf_adc_err_t Ads7952Handler::ReadChannelV(hf_channel_id_t channel, float& voltag
 
     MutexLockGuard lock(handler_mutex_);
     if (!EnsureInitializedLocked()) return hf_adc_err_t::ADC_ERR_NOT_INITIALIZED;
+    if (streaming_) {
+        return ReadStreamChannelLocked(static_cast<uint8_t>(channel), samples, nullptr, &voltage);
+    }
 
-    float sum = 0.0f;
     const uint8_t n = (samples > 0) ? samples : 1;
+    uint32_t sum = 0;
+    const hf_adc_err_t err = BurstChannelLocked(static_cast<uint8_t>(channel), n, sum);
+    if (err != hf_adc_err_t::ADC_SUCCESS) return err;
 
-    for (uint8_t i = 0; i < n; ++i) {
-        auto result = ReadChannelLocked(static_cast<uint8_t>(channel));
-        if (!result.ok()) {
-            ++error_count_;
-            return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
-        }
-        sum += result.voltage;
-    }
-
-    voltage = sum / static_cast<float>(n);
+    voltage = CountToVoltsLocked(1) * static_cast<float>(sum) / static_cast<float>(n);
     ++total_reads_;
     statistics_.totalConversions++;
     return hf_adc_err_t::ADC_SUCCESS;
@@ -192,18 +209,14 @@ hf_adc_err_t Ads7952Handler::ReadChannelCount(hf_channel_id_t channel, hf_u32_t&
 
     MutexLockGuard lock(handler_mutex_);
     if (!EnsureInitializedLocked()) return hf_adc_err_t::ADC_ERR_NOT_INITIALIZED;
+    if (streaming_) {
+        return ReadStreamChannelLocked(static_cast<uint8_t>(channel), samples, &count, nullptr);
+    }
 
-    uint32_t sum = 0;
     const uint8_t n = (samples > 0) ? samples : 1;
-
-    for (uint8_t i = 0; i < n; ++i) {
-        auto result = ReadChannelLocked(static_cast<uint8_t>(channel));
-        if (!result.ok()) {
-            ++error_count_;
-            return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
-        }
-        sum += result.count;
-    }
+    uint32_t sum = 0;
+    const hf_adc_err_t err = BurstChannelLocked(static_cast<uint8_t>(channel), n, sum);
+    if (err != hf_adc_err_t::ADC_SUCCESS) return err;
 
     count = sum / n;
     ++total_reads_;
@@ -217,23 +230,17 @@ hf_adc_err_t Ads7952Handler::ReadChannel(hf_channel_id_t channel, hf_u32_t& coun
 
     MutexLockGuard lock(handler_mutex_);
     if (!EnsureInitializedLocked()) return hf_adc_err_t::ADC_ERR_NOT_INITIALIZED;
+    if (streaming_) {
+        return ReadStreamChannelLocked(static_cast<uint8_t>(channel), samples, &count, &voltage);
+    }
 
-    uint32_t count_sum = 0;
-    float voltage_sum = 0.0f;
     const uint8_t n = (samples > 0) ? samples : 1;
+    uint32_t sum = 0;
+    const hf_adc_err_t err = BurstChannelLocked(static_cast<uint8_t>(channel), n, sum);
+    if (err != hf_adc_err_t::ADC_SUCCESS) return err;
 
-    for (uint8_t i = 0; i < n; ++i) {
-        auto result = ReadChannelLocked(static_cast<uint8_t>(channel));
-        if (!result.ok()) {
-            ++error_count_;
-            return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
-        }
-        count_sum += result.count;
-        voltage_sum += result.voltage;
-    }
-
-    count = count_sum / n;
-    voltage = voltage_sum / static_cast<float>(n);
+    count = sum / n;
+    voltage = CountToVoltsLocked(1) * static_cast<float>(sum) / static_cast<float>(n);
     ++total_reads_;
     statistics_.totalConversions++;
     return hf_adc_err_t::ADC_SUCCESS;
@@ -255,15 +262,28 @@ hf_adc_err_t Ads7952Handler::ReadMultipleChannels(const hf_channel_id_t* channel
         mask |= static_cast<uint16_t>(1U << channels[i]);
     }
 
+    if (streaming_) {
+        // The sequencer is already running: serve the request from one fresh scan.
+        if ((mask & ~stream_mask_) != 0) return hf_adc_err_t::ADC_ERR_INVALID_CHANNEL;
+        if (PollStreamLocked(1) != 1) return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
+        for (uint8_t i = 0; i < num_channels; ++i) {
+            const uint16_t raw = latest_scan_.count[channels[i]];
+            if (counts)   counts[i]   = raw;
+            if (voltages) voltages[i] = CountToVoltsLocked(raw);
+        }
+        ++total_reads_;
+        statistics_.totalConversions++;
+        return hf_adc_err_t::ADC_SUCCESS;
+    }
+
     // Use Auto-1 mode for efficient multi-channel reads
-    adc_driver_->ProgramAuto1Channels(mask);
+    ProgramAuto1MaskLocked(mask);
     adc_driver_->EnterAuto1Mode(true);
 
     auto all = adc_driver_->ReadAllChannels();
     if (!all.ok()) {
         ++error_count_;
-        // Restore manual mode
-        adc_driver_->EnterManualMode(0);
+        (void)RestoreInitialModeLocked();
         return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
     }
 
@@ -279,10 +299,7 @@ hf_adc_err_t Ads7952Handler::ReadMultipleChannels(const hf_channel_id_t* channel
         }
     }
 
-    // Restore previous mode
-    if (config_.initial_mode == ads7952::Mode::Manual) {
-        adc_driver_->EnterManualMode(0);
-    }
+    (void)RestoreInitialModeLocked();
 
     ++total_reads_;
     statistics_.totalConversions++;
@@ -297,14 +314,19 @@ bool Ads7952Handler::ReadAllChannels(ads7952::ChannelReadings& readings) noexcep
     MutexLockGuard lock(handler_mutex_);
     if (!EnsureInitializedLocked()) return false;
 
-    // Save current mode and switch to Auto-1 with all channels
-    adc_driver_->ProgramAuto1Channels(ads7952::kAllChannels);
-    adc_driver_->EnterAuto1Mode(true);
+    if (streaming_) {
+        // Driver reads clock the running sequencer; resynchronize our scan assembly after.
+        readings = adc_driver_->ReadAllChannels();
+        collected_mask_ = 0;
+    } else {
+        // Switch to Auto-1 with all channels
+        ProgramAuto1MaskLocked(ads7952::kAllChannels);
+        adc_driver_->EnterAuto1Mode(true);
 
-    readings = adc_driver_->ReadAllChannels();
+        readings = adc_driver_->ReadAllChannels();
 
-    // Restore manual mode
-    adc_driver_->EnterManualMode(0);
+        (void)RestoreInitialModeLocked();
+    }
 
     if (readings.ok()) {
         ++total_reads_;
@@ -314,6 +336,75 @@ bool Ads7952Handler::ReadAllChannels(ads7952::ChannelReadings& readings) noexcep
     return false;
 }
 
+hf_adc_err_t Ads7952Handler::ReadChannelBurst(hf_channel_id_t channel, uint16_t samples,
+                                               uint8_t decimation_bits, hf_u32_t& count,
+                                               float& voltage) noexcept {
+    return ReadMultipleChannelsBurst(&channel, 1, samples, decimation_bits, &count, &voltage);
+}
+
+hf_adc_err_t Ads7952Handler::ReadMultipleChannelsBurst(const hf_channel_id_t* channels,
+                                                        hf_u8_t num_channels, uint16_t samples,
+                                                        uint8_t decimation_bits, hf_u32_t* counts,
+                                                        float* voltages) noexcept {
+    if (!channels || num_channels == 0) return hf_adc_err_t::ADC_ERR_INVALID_CHANNEL;
+    if (samples == 0) samples = 1;
+    decimation_bits = std::min(decimation_bits, kAds7952MaxDecimationBits);
+
+    uint16_t mask = 0;
+    for (uint8_t i = 0; i < num_channels; ++i) {
+        if (channels[i] >= 12) return hf_adc_err_t::ADC_ERR_INVALID_CHANNEL;
+        mask |= static_cast<uint16_t>(1U << channels[i]);
+    }
+
+    MutexLockGuard lock(handler_mutex_);
+    if (!EnsureInitializedLocked()) return hf_adc_err_t::ADC_ERR_NOT_INITIALIZED;
+
+    uint32_t sums[12] = {};
+    const uint8_t distinct = ChannelsInMask(mask);
+    if (streaming_) {
+        // Ride the running sequence; drop the partially assembled stream scan.
+        if ((mask & ~stream_mask_) != 0) return hf_adc_err_t::ADC_ERR_INVALID_CHANNEL;
+        const hf_u64_t start_us = RtosTime::GetCurrentTimeUs();
+        (void)DiscardStaleFrameLocked(false);
+        const bool ok = AccumulateFramesLocked(stream_mask_, mask, samples, sums);
+        collected_mask_ = 0;
+        if (!ok) {
+            ++error_count_;
+            return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
+        }
+        RecordBurstLocked(static_cast<uint32_t>(samples) * distinct, start_us);
+    } else if (distinct == 1) {
+        const auto ch = static_cast<uint8_t>(channels[0]);
+        const hf_adc_err_t err = BurstChannelLocked(ch, samples, sums[ch]);
+        if (err != hf_adc_err_t::ADC_SUCCESS) return err;
+    } else {
+        ProgramAuto1MaskLocked(mask);
+        adc_driver_->EnterAuto1Mode(true);
+        const hf_u64_t start_us = RtosTime::GetCurrentTimeUs();
+        const bool ok = AccumulateFramesLocked(mask, mask, samples, sums);
+        (void)RestoreInitialModeLocked();
+        if (!ok) {
+            ++error_count_;
+            return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
+        }
+        RecordBurstLocked(static_cast<uint32_t>(samples) * distinct, start_us);
+    }
+
+    const float volts_per_count = CountToVoltsLocked(1);
+    for (uint8_t i = 0; i < num_channels; ++i) {
+        const uint32_t sum = sums[channels[i]];
+        if (counts) {
+            counts[i] = static_cast<hf_u32_t>((static_cast<uint64_t>(sum) << decimation_bits) / samples);
+        }
+        if (voltages) {
+            voltages[i] = volts_per_count * static_cast<float>(sum) / static_cast<float>(samples);
+        }
+    }
+    ++total_reads_;
+    statistics_.totalConversions++;
+    return hf_adc_err_t::ADC_SUCCESS;
+}
+
 bool Ads7952Handler::ProgramAlarm(uint8_t channel, ads7952::AlarmBound bound,
                                    uint16_t threshold_12bit) noexcept {
     MutexLockGuard lock(handler_mutex_);
@@ -342,6 +433,109 @@ float Ads7952Handler::GetActiveVref() const noexcept {
     return adc_driver_->GetActiveVref();
 }
 
+//======================================================//
+// STREAMING (persistent Auto-1 / Auto-2)
+//======================================================//
+
+bool Ads7952Handler::StartStreaming(ads7952::Mode mode) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!EnsureInitializedLocked()) return false;
+
+    uint16_t mask = 0;
+    bool ok = false;
+    switch (mode) {
+        case ads7952::Mode::Auto1:
+            mask = config_.auto1_channel_mask & ads7952::kAllChannels;
+            if (mask == 0) return false;
+            ok = ProgramAuto1MaskLocked(mask) && adc_driver_->EnterAuto1Mode(true);
+            break;
+        case ads7952::Mode::Auto2: {
+            const uint8_t last = std::min<uint8_t>(config_.auto2_last_channel, 11);
+            mask = static_cast<uint16_t>((1U << (last + 1U)) - 1U);
+            ok = adc_driver_->ProgramAuto2LastChannel(last) && adc_driver_->EnterAuto2Mode(true);
+            break;
+        }
+        case ads7952::Mode::Manual:
+            return false;
+    }
+    if (!ok) {
+        ++error_count_;
+        return false;
+    }
+
+    stream_mode_ = mode;
+    stream_mask_ = mask;
+    stream_last_channel_ = 0;
+    for (uint8_t ch = 0; ch < 12; ++ch) {
+        if (mask & (1U << ch)) stream_last_channel_ = ch;
+    }
+    collected_mask_ = 0;
+    pending_scan_ = Ads7952Scan{};
+    latest_valid_ = false;
+    ring_head_ = 0;
+    ring_count_ = 0;
+    stream_scans_ = 0;
+    stream_frames_ = 0;
+    stream_overruns_ = 0;
+    stream_frame_errors_ = 0;
+    first_scan_us_ = 0;
+    last_frame_us_ = RtosTime::GetCurrentTimeUs();
+    streaming_ = true;
+
+    Logger::GetInstance().Info(TAG, "[Dev%u] Streaming %s, mask 0x%03X", config_.device_index,
+                               mode == ads7952::Mode::Auto1 ? "Auto-1" : "Auto-2", mask);
+    return true;
+}
+
+bool Ads7952Handler::StopStreaming() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!streaming_) return true;
+    streaming_ = false;
+    collected_mask_ = 0;
+    if (!adc_driver_) return true;
+    return RestoreInitialModeLocked();
+}
+
+bool Ads7952Handler::IsStreaming() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return streaming_;
+}
+
+uint8_t Ads7952Handler::PollStream(uint8_t max_scans) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return PollStreamLocked(max_scans);
+}
+
+bool Ads7952Handler::PopScan(Ads7952Scan& scan) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (ring_count_ == 0) return false;
+    scan = stream_ring_[ring_head_];
+    ring_head_ = (ring_head_ + 1U) % kAds7952StreamRingDepth;
+    --ring_count_;
+    return true;
+}
+
+bool Ads7952Handler::GetLatestScan(Ads7952Scan& scan) const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!latest_valid_) return false;
+    scan = latest_scan_;
+    return true;
+}
+
+bool Ads7952Handler::GetStreamStats(Ads7952StreamStats& stats) const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    stats.active = streaming_;
+    stats.mode = streaming_ ? stream_mode_ : ads7952::Mode::Manual;
+    stats.channel_mask = stream_mask_;
+    stats.scans = stream_scans_;
+    stats.frames = stream_frames_;
+    stats.overruns = stream_overruns_;
+    stats.frame_errors = stream_frame_errors_;
+    stats.buffered = static_cast<uint32_t>(ring_count_);
+    stats.scans_per_second = StreamScansPerSecondLocked();
+    return true;
+}
+
 //======================================================//
 // DRIVER ACCESS
 //======================================================//
@@ -349,6 +543,8 @@ float Ads7952Handler::GetActiveVref() const noexcept {
 ads7952::ADS7952<Ads7952SpiAdapter>* Ads7952Handler::GetDriver() noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!EnsureInitializedLocked()) return nullptr;
+    // The caller may reprogram Auto-1: the next burst must rewrite the mask.
+    programmed_auto1_mask_ = 0;
     return adc_driver_.get();
 }
 
@@ -376,6 +572,12 @@ bool Ads7952Handler::GetHandlerDiagnostics(Ads7952Diagnostics& diag) const noexc
     diag.total_reads = total_reads_;
     diag.error_count = error_count_;
     diag.device_index = config_.device_index;
+    diag.streaming = streaming_;
+    diag.stream_scans = stream_scans_;
+    diag.stream_overruns = stream_overruns_;
+    diag.stream_scans_per_second = StreamScansPerSecondLocked();
+    diag.burst_samples = burst_samples_;
+    diag.burst_samples_per_second = burst_samples_per_second_;
     return true;
 }
 
@@ -416,6 +618,23 @@ void Ads7952Handler::DumpDiagnostics() const noexcept {
         log.Info(TAG, "  Error Rate: %.2f%%", static_cast<double>(err_rate));
     }
 
+    log.Info(TAG, "Streaming:");
+    log.Info(TAG, "  Active: %s", streaming_ ? "YES" : "NO");
+    if (streaming_) {
+        log.Info(TAG, "  Mode: %s  Mask: 0x%03X",
+                 stream_mode_ == ads7952::Mode::Auto1 ? "Auto-1" : "Auto-2", stream_mask_);
+    }
+    log.Info(TAG, "  Scans: %lu  Frames: %lu  Buffered: %u/%u",
+             static_cast<unsigned long>(stream_scans_), static_cast<unsigned long>(stream_frames_),
+             static_cast<unsigned>(ring_count_), static_cast<unsigned>(kAds7952StreamRingDepth));
+    log.Info(TAG, "  Overruns: %lu  Frame Errors: %lu  Rate: %.1f scans/s",
+             static_cast<unsigned long>(stream_overruns_), static_cast<unsigned long>(stream_frame_errors_),
+             static_cast<double>(StreamScansPerSecondLocked()));
+
+    log.Info(TAG, "Burst Oversampling:");
+    log.Info(TAG, "  Conversions: %lu  Last Rate: %.0f samples/s",
+             static_cast<unsigned long>(burst_samples_), static_cast<double>(burst_samples_per_second_));
+
     log.Info(TAG, "Memory:");
     size_t mem = sizeof(*this);
     if (adc_driver_) mem += sizeof(ads7952::ADS7952<Ads7952SpiAdapter>);
@@ -446,7 +665,8 @@ bool Ads7952Handler::ApplyConfiguration() noexcept {
     success &= adc_driver_->SetRange(config_.range);
 
     // Program Auto-1 channel mask
-    success &= adc_driver_->ProgramAuto1Channels(config_.auto1_channel_mask);
+    programmed_auto1_mask_ = 0;
+    success &= ProgramAuto1MaskLocked(config_.auto1_channel_mask);
 
     // Program Auto-2 last channel
     success &= adc_driver_->ProgramAuto2LastChannel(config_.auto2_last_channel);
@@ -474,6 +694,186 @@ ads7952::ReadResult Ads7952Handler::ReadChannelLocked(uint8_t channel) noexcept
     return adc_driver_->ReadChannel(channel);
 }
 
+bool Ads7952Handler::RestoreInitialModeLocked() noexcept {
+    // Temporary Auto-1 reads reprogram the mask; put back the configured sequence.
+    switch (config_.initial_mode) {
+        case ads7952::Mode::Manual:
+            return adc_driver_->EnterManualMode(0);
+        case ads7952::Mode::Auto1:
+            return ProgramAuto1MaskLocked(config_.auto1_channel_mask) &&
+                   adc_driver_->EnterAuto1Mode(true);
+        case ads7952::Mode::Auto2:
+            return adc_driver_->ProgramAuto2LastChannel(config_.auto2_last_channel) &&
+                   adc_driver_->EnterAuto2Mode(true);
+    }
+    return true;
+}
+
+bool Ads7952Handler::ProgramAuto1MaskLocked(uint16_t mask) noexcept {
+    // The program register survives mode changes; rewriting an identical mask
+    // only costs two extra frames per read.
+    if (mask != 0 && mask == programmed_auto1_mask_) return true;
+    if (!adc_driver_->ProgramAuto1Channels(mask)) {
+        programmed_auto1_mask_ = 0;
+        return false;
+    }
+    programmed_auto1_mask_ = mask;
+    return true;
+}
+
+uint16_t Ads7952Handler::ClockContinueFrameLocked() noexcept {
+    // DI15..DI12 = 0000: continue in the selected mode (Manual keeps the
+    // selected channel). The returned frame carries the previous conversion,
+    // DO15..DO12 its channel address.
+    const uint8_t tx[2] = {0x00, 0x00};
+    uint8_t rx[2] = {0, 0};
+    spi_adapter_->transfer(tx, rx, sizeof(tx));
+    last_frame_us_ = RtosTime::GetCurrentTimeUs();
+    return static_cast<uint16_t>((rx[0] << 8) | rx[1]);
+}
+
+bool Ads7952Handler::DiscardStaleFrameLocked(bool always) noexcept {
+    if (!always && RtosTime::GetCurrentTimeUs() - last_frame_us_ <= kAds7952StreamStaleUs) {
+        return false;
+    }
+    (void)ClockContinueFrameLocked();
+    ++stream_frames_;
+    collected_mask_ = 0;
+    return true;
+}
+
+bool Ads7952Handler::AccumulateFramesLocked(uint16_t sequence_mask, uint16_t wanted_mask,
+                                            uint16_t samples, uint32_t* sums) noexcept {
+    if (!spi_adapter_) return false;
+
+    uint16_t got[12] = {};
+    uint16_t pending = wanted_mask;
+    const uint32_t budget = (static_cast<uint32_t>(samples) + 1U) * ChannelsInMask(sequence_mask) +
+                            kBurstFrameSlack;
+
+    for (uint32_t f = 0; f < budget && pending != 0; ++f) {
+        const uint16_t frame = ClockContinueFrameLocked();
+        const uint8_t ch = static_cast<uint8_t>(frame >> 12);
+        if (ch >= 12 || (pending & (1U << ch)) == 0) continue;
+
+        sums[ch] += frame & 0x0FFFU;
+        if (++got[ch] == samples) pending &= static_cast<uint16_t>(~(1U << ch));
+    }
+    return pending == 0;
+}
+
+void Ads7952Handler::RecordBurstLocked(uint32_t conversions, hf_u64_t start_us) noexcept {
+    burst_samples_ += conversions;
+    const hf_u64_t elapsed_us = RtosTime::GetCurrentTimeUs() - start_us;
+    if (conversions > 1 && elapsed_us > 0) {
+        burst_samples_per_second_ = static_cast<float>(conversions) * 1.0e6f / static_cast<float>(elapsed_us);
+    }
+}
+
+hf_adc_err_t Ads7952Handler::BurstChannelLocked(uint8_t channel, uint16_t samples, uint32_t& sum) noexcept {
+    const hf_u64_t start_us = RtosTime::GetCurrentTimeUs();
+
+    // The driver read selects the channel and yields the first conversion;
+    // continue frames then return the same channel back to back.
+    const auto first = ReadChannelLocked(channel);
+    if (!first.ok()) {
+        ++error_count_;
+        return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
+    }
+
+    uint32_t sums[12] = {};
+    sums[channel] = first.count;
+    const uint16_t mask = static_cast<uint16_t>(1U << channel);
+    if (samples > 1 && !AccumulateFramesLocked(mask, mask, static_cast<uint16_t>(samples - 1U), sums)) {
+        ++error_count_;
+        return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
+    }
+
+    sum = sums[channel];
+    RecordBurstLocked(samples, start_us);
+    return hf_adc_err_t::ADC_SUCCESS;
+}
+
+uint8_t Ads7952Handler::PollStreamLocked(uint8_t max_scans) noexcept {
+    if (!streaming_ || !spi_adapter_ || max_scans == 0) return 0;
+
+    // One scan of slack covers a partial scan left by StartStreaming(), a
+    // resync or the discarded stale frame.
+    const uint32_t frame_budget = (static_cast<uint32_t>(max_scans) + 1U) * ChannelsInMask(stream_mask_) + 2U;
+    uint8_t completed = 0;
+    (void)DiscardStaleFrameLocked(false);
+
+    for (uint32_t f = 0; f < frame_budget && completed < max_scans; ++f) {
+        const uint16_t frame = ClockContinueFrameLocked();
+        ++stream_frames_;
+        const uint8_t ch = static_cast<uint8_t>(frame >> 12);
+        if (ch >= 12 || (stream_mask_ & (1U << ch)) == 0) {
+            ++stream_frame_errors_;
+            collected_mask_ = 0;
+            continue;
+        }
+
+        pending_scan_.count[ch] = static_cast<uint16_t>(frame & 0x0FFFU);
+        collected_mask_ |= static_cast<uint16_t>(1U << ch);
+        if (ch != stream_last_channel_) continue;
+
+        // Last channel of the sequence: publish only complete scans.
+        if (collected_mask_ == stream_mask_) {
+            pending_scan_.timestamp_us = RtosTime::GetCurrentTimeUs();
+            pending_scan_.sequence = stream_scans_++;
+            pending_scan_.channel_mask = stream_mask_;
+            if (stream_scans_ == 1) first_scan_us_ = pending_scan_.timestamp_us;
+
+            if (ring_count_ == kAds7952StreamRingDepth) {
+                ring_head_ = (ring_head_ + 1U) % kAds7952StreamRingDepth;
+                --ring_count_;
+                ++stream_overruns_;
+            }
+            stream_ring_[(ring_head_ + ring_count_) % kAds7952StreamRingDepth] = pending_scan_;
+            ++ring_count_;
+            latest_scan_ = pending_scan_;
+            latest_valid_ = true;
+            ++completed;
+        }
+        collected_mask_ = 0;
+    }
+
+    if (completed < max_scans) ++error_count_;
+    return completed;
+}
+
+hf_adc_err_t Ads7952Handler::ReadStreamChannelLocked(uint8_t channel, uint8_t samples,
+                                                     hf_u32_t* count, float* voltage) noexcept {
+    if (channel >= 12 || (stream_mask_ & (1U << channel)) == 0) {
+        return hf_adc_err_t::ADC_ERR_INVALID_CHANNEL;
+    }
+    if (samples == 0) samples = 1;
+
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < samples; ++i) {
+        if (PollStreamLocked(1) != 1) return hf_adc_err_t::ADC_ERR_CHANNEL_READ_ERR;
+        sum += latest_scan_.count[channel];
+    }
+
+    const auto avg = static_cast<uint16_t>(sum / samples);
+    if (count) *count = avg;
+    if (voltage) *voltage = CountToVoltsLocked(avg);
+    ++total_reads_;
+    statistics_.totalConversions++;
+    return hf_adc_err_t::ADC_SUCCESS;
+}
+
+float Ads7952Handler::CountToVoltsLocked(uint16_t count) const noexcept {
+    const float vref = adc_driver_ ? adc_driver_->GetActiveVref() : config_.vref;
+    return static_cast<float>(count) * vref / 4096.0f;
+}
+
+float Ads7952Handler::StreamScansPerSecondLocked() const noexcept {
+    if (stream_scans_ < 2 || latest_scan_.timestamp_us <= first_scan_us_) return 0.0f;
+    const auto elapsed_us = static_cast<float>(latest_scan_.timestamp_us - first_scan_us_);
+    return static_cast<float>(stream_scans_ - 1U) * 1.0e6f / elapsed_us;
+}
+
 //======================================================//
 // FACTORY METHOD
 //======================================================//
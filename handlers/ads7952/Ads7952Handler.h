@@ -27,6 +27,8 @@
 #ifndef COMPONENT_HANDLER_ADS7952_HANDLER_H_
 #define COMPONENT_HANDLER_ADS7952_HANDLER_H_
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <type_traits>
@@ -36,6 +38,9 @@
 #include "base/BaseAdc.h"
 #include "RtosMutex.h"
 
+// Forward declaration (multi-device coordinator, see Ads7952ScanGroup.h).
+class Ads7952ScanGroup;
+
 //======================================================//
 // ADS7952 SPI BRIDGE ADAPTER (CRTP — zero virtual overhead)
 //======================================================//
@@ -119,6 +124,50 @@ struct Ads7952Diagnostics {
     uint32_t total_reads;             ///< Total successful read operations
     uint32_t error_count;             ///< Total failed read operations
     uint8_t device_index;             ///< Logical device index
+    bool streaming;                   ///< Persistent Auto-1/Auto-2 streaming active
+    uint32_t stream_scans;            ///< Completed streaming scans
+    uint32_t stream_overruns;         ///< Streaming scans dropped (ring full)
+    float stream_scans_per_second;    ///< Sustained streaming scan rate
+    uint32_t burst_samples;           ///< Conversions collected by oversampling bursts
+    float burst_samples_per_second;   ///< Conversion rate achieved by the latest burst
+};
+
+//======================================================//
+// ADS7952 STREAMING
+//======================================================//
+
+/// Depth of the streaming scan ring buffer (power of two).
+inline constexpr std::size_t kAds7952StreamRingDepth = 16;
+
+/// Maximum extra resolution bits produced by burst decimation (12 + 4 = 16-bit results).
+inline constexpr uint8_t kAds7952MaxDecimationBits = 4;
+
+/// Stream pause (µs) after which the first frame's conversion is treated as stale and discarded.
+inline constexpr uint32_t kAds7952StreamStaleUs = 1000;
+
+/**
+ * @brief One completed Auto-1/Auto-2 scan captured while streaming.
+ */
+struct Ads7952Scan {
+    hf_u64_t timestamp_us;            ///< Time the scan's last frame was clocked (µs)
+    uint32_t sequence;                ///< Scan sequence number (gaps = dropped scans)
+    uint16_t channel_mask;            ///< Channels present in @c count (bit N = CH N)
+    uint16_t count[12];               ///< Raw 12-bit counts (valid where the mask bit is set)
+};
+
+/**
+ * @brief Streaming throughput and error counters.
+ */
+struct Ads7952StreamStats {
+    bool active;                      ///< Streaming mode engaged
+    ads7952::Mode mode;               ///< Auto1 or Auto2 while active
+    uint16_t channel_mask;            ///< Channels in each scan
+    uint32_t scans;                   ///< Completed scans since StartStreaming()
+    uint32_t frames;                  ///< SPI frames clocked since StartStreaming()
+    uint32_t overruns;                ///< Scans overwritten before being consumed
+    uint32_t frame_errors;            ///< Frames tagged with a channel outside the scan
+    uint32_t buffered;                ///< Scans waiting in the ring
+    float scans_per_second;           ///< Sustained scan rate since the first scan
 };
 
 //======================================================//
@@ -207,7 +256,7 @@ public:
      * @brief Read a channel and return voltage.
      * @param channel Channel ID (0–11)
      * @param voltage Output: converted voltage
-     * @param samples Number of samples to average (default 1)
+     * @param samples Number of samples to average (default 1), taken as one burst
      * @param timeout_ms Timeout in ms (0 = default)
      * @return ADC error code
      */
@@ -218,7 +267,7 @@ public:
      * @brief Read a channel and return raw count.
      * @param channel Channel ID (0–11)
      * @param count Output: raw 12-bit ADC count (0–4095)
-     * @param samples Number of samples to average (default 1)
+     * @param samples Number of samples to average (default 1), taken as one burst
      * @param timeout_ms Timeout in ms (0 = default)
      * @return ADC error code
      */
@@ -230,7 +279,7 @@ public:
      * @param channel Channel ID (0–11)
      * @param count Output: raw 12-bit count
      * @param voltage Output: converted voltage
-     * @param samples Number of samples to average (default 1)
+     * @param samples Number of samples to average (default 1), taken as one burst
      * @param timeout_ms Timeout in ms (0 = default)
      * @return ADC error code
      */
@@ -259,6 +308,43 @@ public:
      */
     bool ReadAllChannels(ads7952::ChannelReadings& readings) noexcept;
 
+    /**
+     * @brief Oversample one channel in a single burst of back-to-back frames.
+     *
+     * The channel is selected once; the remaining frames only send "continue"
+     * so every frame returns a new conversion of the same channel. With
+     * @p decimation_bits = k the result is the average scaled by 2^k, i.e. a
+     * (12 + k)-bit count; use @p samples >= 4^k for a real resolution gain.
+     *
+     * @param channel Channel ID (0–11)
+     * @param samples Conversions to accumulate (0 is treated as 1)
+     * @param decimation_bits Extra result bits (clamped to kAds7952MaxDecimationBits)
+     * @param count Output: averaged count with (12 + decimation_bits) bits
+     * @param voltage Output: averaged voltage
+     * @return ADC error code
+     */
+    hf_adc_err_t ReadChannelBurst(hf_channel_id_t channel, uint16_t samples, uint8_t decimation_bits,
+                                  hf_u32_t& count, float& voltage) noexcept;
+
+    /**
+     * @brief Oversample several channels with back-to-back Auto-1 sweeps.
+     *
+     * Same result format as ReadChannelBurst(). While streaming, the running
+     * sequence is used (the channels must be part of it) and scans clocked by
+     * the burst are not pushed into the stream ring.
+     *
+     * @param channels Array of channel IDs
+     * @param num_channels Number of channels
+     * @param samples Conversions to accumulate per channel (0 is treated as 1)
+     * @param decimation_bits Extra result bits (clamped to kAds7952MaxDecimationBits)
+     * @param counts Output array (may be nullptr)
+     * @param voltages Output array (may be nullptr)
+     * @return ADC error code
+     */
+    hf_adc_err_t ReadMultipleChannelsBurst(const hf_channel_id_t* channels, hf_u8_t num_channels,
+                                           uint16_t samples, uint8_t decimation_bits,
+                                           hf_u32_t* counts, float* voltages) noexcept;
+
     /**
      * @brief Program alarm threshold for a channel (in 12-bit counts).
      * @param channel Channel number (0–11)
@@ -290,6 +376,71 @@ public:
      */
     float GetActiveVref() const noexcept;
 
+    //======================================================//
+    // STREAMING (persistent Auto-1 / Auto-2)
+    //======================================================//
+
+    /**
+     * @brief Leave the device sequencing in Auto-1 or Auto-2 and stream scans.
+     *
+     * The mode and channel set are programmed once. Every subsequent SPI
+     * frame sends "continue in selected mode", returns one conversion and
+     * clocks the next, so a 12-channel scan costs exactly 12 frames with no
+     * reprogramming. Auto-1 scans config.auto1_channel_mask; Auto-2 scans
+     * CH0..config.auto2_last_channel.
+     *
+     * While streaming, BaseAdc reads are served from fresh scans instead of
+     * switching the device back to Manual mode.
+     *
+     * @param mode ads7952::Mode::Auto1 or ads7952::Mode::Auto2
+     * @return true if the sequencer was programmed
+     */
+    bool StartStreaming(ads7952::Mode mode) noexcept;
+
+    /**
+     * @brief Stop streaming and restore the configured initial mode.
+     * @return true if successful (also when not streaming)
+     */
+    bool StopStreaming() noexcept;
+
+    /** @brief Check whether streaming mode is active. */
+    bool IsStreaming() const noexcept;
+
+    /**
+     * @brief Clock frames until @p max_scans scans complete.
+     *
+     * Completed scans are timestamped and pushed into the ring buffer; when
+     * the ring is full the oldest scan is overwritten and counted as an overrun.
+     * Each frame returns the conversion sampled during the previous frame, so
+     * after a pause longer than kAds7952StreamStaleUs the first frame (and any
+     * scan left partly assembled) is discarded.
+     *
+     * @param max_scans Scans to acquire (1 = one full scan)
+     * @return Number of scans completed (0 on SPI/sequencing failure or when not streaming)
+     */
+    uint8_t PollStream(uint8_t max_scans = 1) noexcept;
+
+    /**
+     * @brief Pop the oldest buffered scan.
+     * @param scan Output scan
+     * @return true if a scan was available
+     */
+    bool PopScan(Ads7952Scan& scan) noexcept;
+
+    /**
+     * @brief Copy the most recent scan without consuming it.
+     * @param scan Output scan
+     * @return true if at least one scan completed since StartStreaming()
+     */
+    bool GetLatestScan(Ads7952Scan& scan) const noexcept;
+
+    /**
+     * @brief Get streaming throughput and error counters.
+     * @param stats Output statistics
+     * @return true always
+     */
+    bool GetStreamStats(Ads7952StreamStats& stats) const noexcept;
+
     //======================================================//
     // DRIVER ACCESS
     //======================================================//
@@ -298,6 +449,8 @@ public:
      * @brief Get raw pointer to the ADS7952 driver for advanced operations.
      * @return Pointer to driver or nullptr if not initialized
      * @warning Raw pointer — NOT mutex-protected. Prefer visitDriver().
+     * @note Both accessors drop the cached Auto-1 mask, so the next
+     *       ReadMultipleChannels() reprograms the channel set.
      */
     ads7952::ADS7952<Ads7952SpiAdapter>* GetDriver() noexcept;
     const ads7952::ADS7952<Ads7952SpiAdapter>* GetDriver() const noexcept;
@@ -318,6 +471,7 @@ public:
                 return ReturnType{};
             }
         }
+        programmed_auto1_mask_ = 0;  // fn may reprogram Auto-1
         return fn(*adc_driver_);
     }
 
@@ -338,6 +492,8 @@ public:
     uint8_t GetDeviceIndex() const noexcept { return config_.device_index; }
 
 private:
+    friend class Ads7952ScanGroup;
+
     //======================================================//
     // PRIVATE MEMBERS
     //======================================================//
@@ -353,6 +509,32 @@ private:
     mutable uint32_t total_reads_{0};                 ///< Successful read count
     mutable uint32_t error_count_{0};                 ///< Failed read count
 
+    // Auto-1 sequencer state (avoids reprogramming an unchanged mask)
+    uint16_t programmed_auto1_mask_{0};               ///< Mask last written to the device (0 = unknown)
+
+    // Streaming state
+    bool streaming_{false};                           ///< Persistent auto mode engaged
+    ads7952::Mode stream_mode_{ads7952::Mode::Manual}; ///< Auto1 or Auto2 while streaming
+    uint16_t stream_mask_{0};                         ///< Channels in each scan
+    uint8_t stream_last_channel_{0};                  ///< Highest channel (ends a scan)
+    uint16_t collected_mask_{0};                      ///< Channels received for the pending scan
+    Ads7952Scan pending_scan_{};                      ///< Scan being assembled
+    Ads7952Scan latest_scan_{};                       ///< Most recent completed scan
+    bool latest_valid_{false};                        ///< latest_scan_ holds a scan
+    std::array<Ads7952Scan, kAds7952StreamRingDepth> stream_ring_{};  ///< Completed scans
+    std::size_t ring_head_{0};                        ///< Oldest buffered scan
+    std::size_t ring_count_{0};                       ///< Buffered scans
+    uint32_t stream_scans_{0};                        ///< Completed scans
+    uint32_t stream_frames_{0};                       ///< Frames clocked
+    uint32_t stream_overruns_{0};                     ///< Overwritten scans
+    uint32_t stream_frame_errors_{0};                 ///< Frames with unexpected channel tags
+    hf_u64_t last_frame_us_{0};                       ///< When the latest continue frame was clocked
+    hf_u64_t first_scan_us_{0};                       ///< Timestamp of the first scan
+
+    // Burst oversampling statistics
+    uint32_t burst_samples_{0};                       ///< Conversions collected by bursts
+    float burst_samples_per_second_{0.0f};            ///< Rate achieved by the latest burst
+
     //======================================================//
     // PRIVATE HELPERS
     //======================================================//
@@ -365,6 +547,60 @@ private:
 
     /** @brief Perform a single-channel read under lock (no mutex acquire). */
     ads7952::ReadResult ReadChannelLocked(uint8_t channel) noexcept;
+
+    /** @brief Return to config_.initial_mode with its configured channel set (mutex held). */
+    bool RestoreInitialModeLocked() noexcept;
+
+    /** @brief Program the Auto-1 mask only if it differs from the device's. */
+    bool ProgramAuto1MaskLocked(uint16_t mask) noexcept;
+
+    /** @brief Clock one "continue in selected mode" frame and return the 16-bit result. */
+    uint16_t ClockContinueFrameLocked() noexcept;
+
+    /**
+     * @brief Discard the conversion held over from the previous frame (streaming, mutex held).
+     *
+     * The frame is clocked when @p always is set or the stream has been idle
+     * for more than kAds7952StreamStaleUs; the partly assembled scan is dropped
+     * with it.
+     *
+     * @return true if a frame was discarded
+     */
+    bool DiscardStaleFrameLocked(bool always) noexcept;
+
+    /**
+     * @brief Clock continue frames until every channel in @p wanted_mask has @p samples conversions.
+     * @param sequence_mask Channels the device is currently sequencing
+     * @param wanted_mask Channels to accumulate (subset of @p sequence_mask)
+     * @param samples Conversions per wanted channel
+     * @param sums In/out per-channel count sums (indexed by channel)
+     * @return true if all conversions were collected within the frame budget
+     */
+    bool AccumulateFramesLocked(uint16_t sequence_mask, uint16_t wanted_mask, uint16_t samples,
+                                uint32_t* sums) noexcept;
+
+    /** @brief Record burst throughput for diagnostics. */
+    void RecordBurstLocked(uint32_t conversions, hf_u64_t start_us) noexcept;
+
+    /** @brief Single-channel burst: sum of @p samples conversions (mutex held). */
+    hf_adc_err_t BurstChannelLocked(uint8_t channel, uint16_t samples, uint32_t& sum) noexcept;
+
+    /** @brief Clock frames until max_scans scans complete (mutex held). */
+    uint8_t PollStreamLocked(uint8_t max_scans) noexcept;
+
+    /**
+     * @brief Single-channel read while streaming: average @p samples fresh scans (mutex held).
+     * @param count Output average count (may be nullptr)
+     * @param voltage Output average voltage (may be nullptr)
+     */
+    hf_adc_err_t ReadStreamChannelLocked(uint8_t channel, uint8_t samples,
+                                         hf_u32_t* count, float* voltage) noexcept;
+
+    /** @brief Count → volts with the active reference. */
+    float CountToVoltsLocked(uint16_t count) const noexcept;
+
+    /** @brief Sustained streaming scan rate since the first scan (mutex held). */
+    float StreamScansPerSecondLocked() const noexcept;
 };
 
 //======================================================//
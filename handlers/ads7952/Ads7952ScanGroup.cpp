@@ -0,0 +1,227 @@
+/**
+ * @file Ads7952ScanGroup.cpp
+ * @brief Implementation of the multi-device ADS7952 scan coordinator.
+ *
+ * @see Ads7952ScanGroup.h for architectural overview and Doxygen documentation.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#include "Ads7952ScanGroup.h"
+#include "handlers/logger/Logger.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/OsUtility.h"
+
+static constexpr const char* TAG = "Ads7952ScanGroup";
+
+//======================================================//
+// MEMBERSHIP
+//======================================================//
+
+Ads7952ScanGroup::~Ads7952ScanGroup() noexcept {
+    Stop();
+}
+
+bool Ads7952ScanGroup::AddDevice(Ads7952Handler& handler) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (running_ || device_count_ >= kAds7952MaxGroupDevices) return false;
+    for (uint8_t i = 0; i < device_count_; ++i) {
+        if (devices_[i] == &handler) return false;
+    }
+    devices_[device_count_++] = &handler;
+    return true;
+}
+
+uint8_t Ads7952ScanGroup::GetDeviceCount() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return device_count_;
+}
+
+//======================================================//
+// SCANNING
+//======================================================//
+
+bool Ads7952ScanGroup::Start(ads7952::Mode mode) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (running_) return true;
+    if (device_count_ == 0) return false;
+
+    for (uint8_t i = 0; i < device_count_; ++i) {
+        if (!devices_[i]->StartStreaming(mode)) {
+            Logger::GetInstance().Error(TAG, "Device %u failed to start streaming",
+                                        static_cast<unsigned>(devices_[i]->GetDeviceIndex()));
+            for (uint8_t j = 0; j < i; ++j) {
+                devices_[j]->StopStreaming();
+            }
+            return false;
+        }
+    }
+
+    running_ = true;
+    sequence_ = 0;
+    stats_ = Ads7952GroupStats{};
+    first_snapshot_us_ = 0;
+    last_snapshot_us_ = 0;
+    return true;
+}
+
+bool Ads7952ScanGroup::Stop() noexcept {
+    MutexLockGuard lock(mutex_);
+    if (!running_) return true;
+    running_ = false;
+
+    bool ok = true;
+    for (uint8_t i = 0; i < device_count_; ++i) {
+        ok &= devices_[i]->StopStreaming();
+    }
+    return ok;
+}
+
+bool Ads7952ScanGroup::IsRunning() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return running_;
+}
+
+bool Ads7952ScanGroup::Snapshot(Ads7952GroupSnapshot& snapshot) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (!running_) return false;
+    return LockAndSweep(0, snapshot);
+}
+
+bool Ads7952ScanGroup::LockAndSweep(uint8_t index, Ads7952GroupSnapshot& snapshot) noexcept {
+    if (index == device_count_) {
+        return SweepLocked(snapshot);
+    }
+    // Members stay locked for the whole sweep so no other frame lands between ours.
+    MutexLockGuard lock(devices_[index]->handler_mutex_);
+    return LockAndSweep(static_cast<uint8_t>(index + 1U), snapshot);
+}
+
+bool Ads7952ScanGroup::SweepLocked(Ads7952GroupSnapshot& snapshot) noexcept {
+    std::array<uint16_t, kAds7952MaxGroupDevices> remaining{};
+    std::array<uint32_t, kAds7952MaxGroupDevices> budget{};
+
+    snapshot.device_count = device_count_;
+    for (uint8_t d = 0; d < device_count_; ++d) {
+        Ads7952Handler& dev = *devices_[d];
+        if (!dev.streaming_ || !dev.spi_adapter_) {
+            ++stats_.failures;
+            return false;
+        }
+        remaining[d] = dev.stream_mask_;
+        uint32_t channels = 0;
+        for (uint16_t m = dev.stream_mask_; m != 0; m &= static_cast<uint16_t>(m - 1U)) ++channels;
+        budget[d] = 2U * channels + kSweepFrameSlack;
+
+        snapshot.device_index[d] = dev.GetDeviceIndex();
+        snapshot.channel_mask[d] = dev.stream_mask_;
+        // The sweep consumes the sequence; the member's own scan assembly restarts.
+        dev.collected_mask_ = 0;
+    }
+
+    const hf_u64_t start_us = RtosTime::GetCurrentTimeUs();
+    uint32_t conversions = 0;
+    bool pending = true;
+
+    // A member's first frame returns the conversion sampled at its previous
+    // frame, which may be arbitrarily old: discard it so the snapshot only
+    // holds samples from this sweep.
+    for (uint8_t d = 0; d < device_count_; ++d) {
+        (void)devices_[d]->DiscardStaleFrameLocked(true);
+        --budget[d];
+        ++stats_.frames;
+    }
+
+    // One frame per member per pass: while one device is being clocked the
+    // others' sample-and-hold inputs are settling on their next channel.
+    while (pending) {
+        pending = false;
+        for (uint8_t d = 0; d < device_count_; ++d) {
+            if (remaining[d] == 0) continue;
+            if (budget[d] == 0) {
+                ++stats_.failures;
+                return false;
+            }
+            --budget[d];
+
+            Ads7952Handler& dev = *devices_[d];
+            const uint16_t frame = dev.ClockContinueFrameLocked();
+            ++dev.stream_frames_;
+            ++stats_.frames;
+
+            const auto ch = static_cast<uint8_t>(frame >> 12);
+            if (ch >= 12 || (dev.stream_mask_ & (1U << ch)) == 0) {
+                ++dev.stream_frame_errors_;
+                ++stats_.frame_errors;
+            } else {
+                snapshot.count[d][ch] = static_cast<uint16_t>(frame & 0x0FFFU);
+                if (remaining[d] & (1U << ch)) ++conversions;
+                remaining[d] &= static_cast<uint16_t>(~(1U << ch));
+            }
+            pending |= (remaining[d] != 0);
+        }
+    }
+
+    const hf_u64_t end_us = RtosTime::GetCurrentTimeUs();
+    const auto sweep_us = static_cast<uint32_t>(end_us - start_us);
+
+    snapshot.timestamp_us = end_us;
+    snapshot.sequence = sequence_++;
+    snapshot.sweep_us = sweep_us;
+
+    if (stats_.snapshots == 0) first_snapshot_us_ = end_us;
+    last_snapshot_us_ = end_us;
+    ++stats_.snapshots;
+    stats_.last_sweep_us = sweep_us;
+    if (sweep_us > stats_.max_sweep_us) stats_.max_sweep_us = sweep_us;
+    if (sweep_us > 0) {
+        stats_.conversions_per_second = static_cast<float>(conversions) * 1.0e6f / static_cast<float>(sweep_us);
+    }
+    return true;
+}
+
+//======================================================//
+// STATISTICS
+//======================================================//
+
+Ads7952GroupStats Ads7952ScanGroup::GetStats() const noexcept {
+    MutexLockGuard lock(mutex_);
+    Ads7952GroupStats stats = stats_;
+    if (stats_.snapshots > 1 && last_snapshot_us_ > first_snapshot_us_) {
+        stats.snapshots_per_second = static_cast<float>(stats_.snapshots - 1U) * 1.0e6f /
+                                     static_cast<float>(last_snapshot_us_ - first_snapshot_us_);
+    }
+    return stats;
+}
+
+void Ads7952ScanGroup::ResetStats() noexcept {
+    MutexLockGuard lock(mutex_);
+    stats_ = Ads7952GroupStats{};
+    first_snapshot_us_ = 0;
+    last_snapshot_us_ = 0;
+}
+
+void Ads7952ScanGroup::DumpDiagnostics() const noexcept {
+    auto& log = Logger::GetInstance();
+    log.Info(TAG, "=== ADS7952 SCAN GROUP DIAGNOSTICS ===");
+
+    const Ads7952GroupStats stats = GetStats();
+
+    MutexLockGuard lock(mutex_);
+    log.Info(TAG, "  Devices: %u/%u  Running: %s", static_cast<unsigned>(device_count_),
+             static_cast<unsigned>(kAds7952MaxGroupDevices), running_ ? "YES" : "NO");
+    for (uint8_t d = 0; d < device_count_; ++d) {
+        log.Info(TAG, "  [%u] %s", static_cast<unsigned>(d), devices_[d]->GetDescription());
+    }
+    log.Info(TAG, "  Snapshots: %lu  Failures: %lu  Rate: %.1f/s",
+             static_cast<unsigned long>(stats.snapshots), static_cast<unsigned long>(stats.failures),
+             static_cast<double>(stats.snapshots_per_second));
+    log.Info(TAG, "  Frames: %lu  Frame Errors: %lu  Sweep(us) last=%lu max=%lu",
+             static_cast<unsigned long>(stats.frames), static_cast<unsigned long>(stats.frame_errors),
+             static_cast<unsigned long>(stats.last_sweep_us), static_cast<unsigned long>(stats.max_sweep_us));
+    log.Info(TAG, "  Aggregate Conversion Rate: %.0f samples/s",
+             static_cast<double>(stats.conversions_per_second));
+
+    log.Info(TAG, "=== END ADS7952 SCAN GROUP DIAGNOSTICS ===");
+}
@@ -0,0 +1,199 @@
+/**
+ * @file Ads7952ScanGroup.h
+ * @brief Interleaved scanning of several ADS7952 devices sharing one SPI bus.
+ *
+ * @details
+ * ## Purpose
+ *
+ * Boards with more than one ADS7952 put them on the same SPI bus with
+ * separate chip-selects (Ads7952HandlerConfig::device_index). Scanned one
+ * handler at a time, each device idles while the others are read, and each
+ * scan pays its own locking, mode setup and back-to-back frames to the same
+ * device.
+ *
+ * The scan group keeps every member in streaming mode (Auto-1 or Auto-2)
+ * and clocks frames round-robin across the devices:
+ *
+ * @code
+ *  bus:  A:CH0  B:CH0  C:CH0  A:CH1  B:CH1  C:CH1  ...
+ *        │      └─ A's next sample settles while B and C are clocked
+ *        └─ each frame returns one conversion and starts the next
+ * @endcode
+ *
+ * Every frame on the bus carries a conversion, so the aggregate conversion
+ * rate approaches the bus frame rate, and the same channel on different
+ * devices is sampled within a few frames of each other. One Snapshot() call
+ * returns all channels of all devices from the same sweep.
+ *
+ * ## Usage
+ *
+ * @code
+ * auto adc_a = CreateAds7952Handler(spi_dev_a, cfg_a);   // device_index 0
+ * auto adc_b = CreateAds7952Handler(spi_dev_b, cfg_b);   // device_index 1
+ *
+ * Ads7952ScanGroup group;
+ * group.AddDevice(*adc_a);
+ * group.AddDevice(*adc_b);
+ * group.Start(ads7952::Mode::Auto1);
+ *
+ * Ads7952GroupSnapshot snap{};
+ * if (group.Snapshot(snap)) {
+ *     uint16_t b_ch3 = snap.count[1][3];
+ * }
+ * @endcode
+ *
+ * ## Lifetime Requirements
+ *
+ * Every member handler must outlive the group. A snapshot holds every
+ * member's handler mutex (taken in registration order), so a handler should
+ * belong to at most one group.
+ *
+ * @see Ads7952Handler  Per-device handler driven by this class.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#ifndef COMPONENT_HANDLER_ADS7952_SCAN_GROUP_H_
+#define COMPONENT_HANDLER_ADS7952_SCAN_GROUP_H_
+
+#include <array>
+#include <cstdint>
+#include "Ads7952Handler.h"
+#include "RtosMutex.h"
+
+/// Maximum ADS7952 devices in one scan group.
+inline constexpr uint8_t kAds7952MaxGroupDevices = 4;
+
+/**
+ * @brief All channels of all group members from one interleaved sweep.
+ */
+struct Ads7952GroupSnapshot {
+    hf_u64_t timestamp_us;                                ///< Time the sweep completed (µs)
+    uint32_t sequence;                                    ///< Snapshot sequence number
+    uint32_t sweep_us;                                    ///< Duration of the sweep (µs)
+    uint8_t device_count;                                 ///< Valid entries below
+    uint8_t device_index[kAds7952MaxGroupDevices];        ///< Ads7952HandlerConfig::device_index per entry
+    uint16_t channel_mask[kAds7952MaxGroupDevices];       ///< Channels present per device
+    uint16_t count[kAds7952MaxGroupDevices][12];          ///< Raw 12-bit counts [device][channel]
+};
+
+/**
+ * @brief Throughput and error counters of a scan group.
+ */
+struct Ads7952GroupStats {
+    uint32_t snapshots = 0;                ///< Completed snapshots
+    uint32_t failures = 0;                 ///< Snapshots abandoned (member not streaming or out of budget)
+    uint32_t frames = 0;                   ///< SPI frames clocked across all members
+    uint32_t frame_errors = 0;             ///< Frames tagged with a channel outside the sequence
+    uint32_t last_sweep_us = 0;            ///< Duration of the latest sweep
+    uint32_t max_sweep_us = 0;             ///< Worst sweep duration
+    float conversions_per_second = 0.0f;   ///< Aggregate conversion rate of the latest sweep
+    float snapshots_per_second = 0.0f;     ///< Sustained snapshot rate since the first snapshot
+};
+
+/**
+ * @class Ads7952ScanGroup
+ * @brief Round-robin scan coordinator for ADS7952 handlers on one SPI bus.
+ *
+ * @note Thread-safe. While the group runs, the members stay in streaming
+ *       mode; their own BaseAdc reads keep working and are served from the
+ *       running sequence.
+ */
+class Ads7952ScanGroup {
+public:
+    /** @brief Frames a member may spend beyond one sequence before a sweep is abandoned. */
+    static constexpr uint8_t kSweepFrameSlack = 4;
+
+    Ads7952ScanGroup() noexcept = default;
+
+    /** @brief Destructor. Stops streaming on every member if running. */
+    ~Ads7952ScanGroup() noexcept;
+
+    /// Non-copyable.
+    Ads7952ScanGroup(const Ads7952ScanGroup&) = delete;
+    /// Non-copyable.
+    Ads7952ScanGroup& operator=(const Ads7952ScanGroup&) = delete;
+
+    /// @name Membership
+    /// @{
+
+    /**
+     * @brief Add a device (only while stopped).
+     * @param handler Handler of one ADS7952 on the shared bus.
+     * @return false if running, full (kAds7952MaxGroupDevices) or already a member.
+     */
+    bool AddDevice(Ads7952Handler& handler) noexcept;
+
+    /** @brief Number of member devices. */
+    uint8_t GetDeviceCount() const noexcept;
+
+    /// @}
+
+    /// @name Scanning
+    /// @{
+
+    /**
+     * @brief Put every member into streaming mode.
+     * @param mode ads7952::Mode::Auto1 (each member's auto1_channel_mask) or
+     *             ads7952::Mode::Auto2 (CH0..auto2_last_channel).
+     * @return true if every member started; on failure started members are stopped.
+     */
+    bool Start(ads7952::Mode mode = ads7952::Mode::Auto1) noexcept;
+
+    /**
+     * @brief Stop streaming on every member (restores their configured mode).
+     * @return true if every member stopped cleanly.
+     */
+    bool Stop() noexcept;
+
+    /** @brief Check whether the group is running. */
+    bool IsRunning() const noexcept;
+
+    /**
+     * @brief Run one interleaved sweep and return every channel of every member.
+     *
+     * Each member first clocks one discarded frame (its result was sampled
+     * before the sweep), then frames go round-robin until every channel of
+     * every member has a conversion from this sweep.
+     *
+     * @param snapshot Output snapshot.
+     * @return true if every member delivered all of its channels.
+     */
+    bool Snapshot(Ads7952GroupSnapshot& snapshot) noexcept;
+
+    /// @}
+
+    /// @name Statistics
+    /// @{
+
+    /** @brief Get a copy of the group statistics. */
+    Ads7952GroupStats GetStats() const noexcept;
+
+    /** @brief Reset group statistics. */
+    void ResetStats() noexcept;
+
+    /** @brief Log membership and statistics at INFO level. */
+    void DumpDiagnostics() const noexcept;
+
+    /// @}
+
+private:
+    /** @brief Take member @p index's handler mutex, then recurse; sweeps with all held. */
+    bool LockAndSweep(uint8_t index, Ads7952GroupSnapshot& snapshot) noexcept;
+
+    /** @brief Interleaved sweep (group and all member mutexes held). */
+    bool SweepLocked(Ads7952GroupSnapshot& snapshot) noexcept;
+
+    std::array<Ads7952Handler*, kAds7952MaxGroupDevices> devices_{};  ///< Members (not owned)
+    uint8_t device_count_ = 0;                                        ///< Member count
+    bool running_ = false;                                            ///< Members streaming
+    uint32_t sequence_ = 0;                                           ///< Next snapshot sequence
+    hf_u64_t first_snapshot_us_ = 0;                                  ///< Time of the first snapshot
+    hf_u64_t last_snapshot_us_ = 0;                                   ///< Time of the latest snapshot
+    Ads7952GroupStats stats_{};                                       ///< Statistics
+    mutable RtosMutex mutex_;                                         ///< Protects all state
+};
+
+#endif  // COMPONENT_HANDLER_ADS7952_SCAN_GROUP_H_
@@ -0,0 +1,214 @@
+/**
+ * @file As5047uAngleTracker.h
+ * @brief Multi-turn angle unwrapping and PLL velocity observer for AS5047U samples.
+ *
+ * @details
+ * The AS5047U velocity register is a short finite difference and is noisy at
+ * low speed. Commutation and position loops instead run a second-order
+ * tracking loop (type-II PLL) on the 14-bit angle:
+ *
+ * @code
+ *  predicted = position + velocity * dt
+ *  e         = measured - predicted            (unwrapped counts)
+ *  position  = predicted + 2 * zeta * wn * dtc * e
+ *  velocity  = velocity  + wn^2 * dtc * e
+ * @endcode
+ *
+ * The loop has zero steady-state error at constant speed, and its bandwidth
+ * (wn / 2pi) sets the trade-off between noise and lag. Quantisation noise on the
+ * angle is filtered instead of being differentiated.
+ *
+ * The prediction spans the full interval dt, but the correction step dtc is
+ * capped at the nominal sample period: a discrete loop tuned for that period
+ * amplifies noise on longer steps and goes unstable once wn * dt approaches 1,
+ * so stream task yields and stalls must not lengthen it. A gap longer than
+ * kReseedPeriods periods re-seeds the observer position on the measurement
+ * (velocity and turn count are kept).
+ *
+ * Each new angle is unwrapped against the predicted one (shortest path from
+ * position + velocity * dt), so the multi-turn position is exact as long as
+ * the shaft deviates less than half a turn from the predicted motion between
+ * samples. The velocity estimate is clamped to half a turn per nominal period.
+ *
+ * Positions are kept as Q16.16 counts in 64-bit integers so that resolution
+ * does not degrade with the number of turns; only small per-sample terms
+ * use single-precision floats.
+ *
+ * The class is hardware-free: feed it angles and sample intervals from any
+ * source (As5047uHandler streaming, a simulated encoder, a log replay).
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#ifndef COMPONENT_HANDLER_AS5047U_ANGLE_TRACKER_H_
+#define COMPONENT_HANDLER_AS5047U_ANGLE_TRACKER_H_
+
+#include <cstdint>
+
+/**
+ * @brief Type-II PLL angle/velocity observer with multi-turn unwrapping.
+ *
+ * @note Not thread-safe; one task updates it (the handler publishes copies).
+ */
+class As5047uAngleTracker {
+public:
+    /** @brief Counts per mechanical revolution (14-bit angle). */
+    static constexpr int32_t kCountsPerRev = 16384;
+
+    /** @brief Radians per count. */
+    static constexpr float kRadPerCount = 6.28318530718f / static_cast<float>(kCountsPerRev);
+
+    /** @brief Gap (in nominal periods) beyond which the observer position is re-seeded. */
+    static constexpr float kReseedPeriods = 4.0f;
+
+    /** @brief Longest interval (s) the motion is extrapolated over for unwrapping. */
+    static constexpr float kMaxPredictionS = 1.0f;
+
+    /**
+     * @brief Set the observer bandwidth and nominal sample period.
+     * @param bandwidth_hz Natural frequency wn / 2pi (> 0)
+     * @param damping Damping ratio zeta (1.0 = critically damped)
+     * @param sample_period_s Nominal interval between samples (> 0); caps the correction step
+     */
+    void Configure(float bandwidth_hz, float damping = 1.0f, float sample_period_s = 1.0e-4f) noexcept {
+        const float wn = 6.28318530718f * bandwidth_hz;
+        kp_ = 2.0f * damping * wn;
+        ki_ = wn * wn;
+        sample_period_s_ = sample_period_s > 0.0f ? sample_period_s : 1.0e-4f;
+        max_velocity_cps_ = static_cast<float>(kCountsPerRev / 2) / sample_period_s_;
+    }
+
+    /** @brief Forget all state; the next Update() re-seeds position and zeroes velocity. */
+    void Reset() noexcept {
+        seeded_ = false;
+        last_angle_ = 0;
+        position_counts_ = 0;
+        estimate_q16_ = 0;
+        velocity_cps_ = 0.0f;
+        last_error_counts_ = 0.0f;
+    }
+
+    /**
+     * @brief Restart the turn counter at @p turns while keeping the velocity estimate.
+     * @param turns Turn count to assign to the current angle
+     */
+    void SetTurns(int32_t turns) noexcept {
+        if (!seeded_) {
+            return;
+        }
+        const int64_t offset = (static_cast<int64_t>(turns) * kCountsPerRev + last_angle_) - position_counts_;
+        position_counts_ += offset;
+        estimate_q16_ += offset * 65536;
+    }
+
+    /**
+     * @brief Feed one angle sample.
+     * @param angle 14-bit angle (0..16383)
+     * @param dt_s Time since the previous accepted sample in seconds (ignored for the first;
+     *             any length, the correction step is capped at the nominal period)
+     */
+    void Update(uint16_t angle, float dt_s) noexcept {
+        const auto a = static_cast<int32_t>(angle & (kCountsPerRev - 1));
+        if (!seeded_) {
+            seeded_ = true;
+            last_angle_ = a;
+            position_counts_ = a;
+            estimate_q16_ = static_cast<int64_t>(a) * 65536;
+            velocity_cps_ = 0.0f;
+            last_error_counts_ = 0.0f;
+            return;
+        }
+
+        // Expected motion since the previous sample; |velocity| is clamped and
+        // the span capped, so the conversion cannot overflow.
+        const float step_s = dt_s > 0.0f ? dt_s : 0.0f;
+        const float span_s = step_s < kMaxPredictionS ? step_s : kMaxPredictionS;
+        const auto predicted_delta_q16 = static_cast<int64_t>(velocity_cps_ * span_s * 65536.0f);
+
+        // Shortest-path unwrap around the expected angle into the multi-turn count
+        const int64_t expected_delta = predicted_delta_q16 >> 16;
+        auto residual = static_cast<int32_t>((a - last_angle_ - expected_delta) % kCountsPerRev);
+        if (residual >= kCountsPerRev / 2) {
+            residual -= kCountsPerRev;
+        } else if (residual < -kCountsPerRev / 2) {
+            residual += kCountsPerRev;
+        }
+        last_angle_ = a;
+        position_counts_ += expected_delta + residual;
+
+        if (step_s == 0.0f) {
+            return;
+        }
+        if (step_s > kReseedPeriods * sample_period_s_) {
+            // Too long for the loop to bridge: restart from the measurement
+            estimate_q16_ = position_counts_ * 65536;
+            last_error_counts_ = 0.0f;
+            return;
+        }
+
+        const float correction_s = step_s < sample_period_s_ ? step_s : sample_period_s_;
+        const int64_t predicted_q16 = estimate_q16_ + predicted_delta_q16;
+        const float error = static_cast<float>(position_counts_ * 65536 - predicted_q16) * (1.0f / 65536.0f);
+        estimate_q16_ = predicted_q16 + static_cast<int64_t>(kp_ * correction_s * error * 65536.0f);
+        velocity_cps_ += ki_ * correction_s * error;
+        if (velocity_cps_ > max_velocity_cps_) {
+            velocity_cps_ = max_velocity_cps_;
+        } else if (velocity_cps_ < -max_velocity_cps_) {
+            velocity_cps_ = -max_velocity_cps_;
+        }
+        last_error_counts_ = error;
+    }
+
+    /** @brief Whether at least one sample has been fed since Reset(). */
+    [[nodiscard]] bool IsSeeded() const noexcept { return seeded_; }
+
+    /** @brief Measured multi-turn position in counts (turns * 16384 + angle). */
+    [[nodiscard]] int64_t GetPositionCounts() const noexcept { return position_counts_; }
+
+    /** @brief Whole turns of the measured position (floor). */
+    [[nodiscard]] int32_t GetTurns() const noexcept {
+        return static_cast<int32_t>(position_counts_ >> 14);
+    }
+
+    /** @brief Last fed angle (0..16383). */
+    [[nodiscard]] uint16_t GetAngle() const noexcept { return static_cast<uint16_t>(last_angle_); }
+
+    /** @brief Observer position in counts, multi-turn, with fractional counts. */
+    [[nodiscard]] int64_t GetEstimateQ16() const noexcept { return estimate_q16_; }
+
+    /** @brief Observer angle within the turn, radians [0, 2pi). */
+    [[nodiscard]] float GetEstimatedAngleRad() const noexcept {
+        const int64_t in_turn = estimate_q16_ & ((static_cast<int64_t>(kCountsPerRev) << 16) - 1);
+        return static_cast<float>(in_turn) * (kRadPerCount / 65536.0f);
+    }
+
+    /** @brief Observer velocity in counts per second. */
+    [[nodiscard]] float GetVelocityCountsPerSec() const noexcept { return velocity_cps_; }
+
+    /** @brief Observer velocity in radians per second. */
+    [[nodiscard]] float GetVelocityRadPerSec() const noexcept { return velocity_cps_ * kRadPerCount; }
+
+    /** @brief Observer velocity in revolutions per minute. */
+    [[nodiscard]] float GetVelocityRpm() const noexcept {
+        return velocity_cps_ * (60.0f / static_cast<float>(kCountsPerRev));
+    }
+
+    /** @brief Innovation of the last update in counts (tracking error). */
+    [[nodiscard]] float GetTrackingErrorCounts() const noexcept { return last_error_counts_; }
+
+private:
+    float kp_ = 0.0f;                ///< 2 * zeta * wn
+    float ki_ = 0.0f;                ///< wn^2
+    float sample_period_s_ = 1.0e-4f; ///< Nominal sample period (correction step cap)
+    float max_velocity_cps_ = static_cast<float>(kCountsPerRev / 2) / 1.0e-4f; ///< Velocity clamp
+    bool seeded_ = false;            ///< First sample received
+    int32_t last_angle_ = 0;         ///< Previous 14-bit angle
+    int64_t position_counts_ = 0;    ///< Unwrapped measured position
+    int64_t estimate_q16_ = 0;       ///< Observer position, Q16.16 counts
+    float velocity_cps_ = 0.0f;      ///< Observer velocity, counts/s
+    float last_error_counts_ = 0.0f; ///< Last innovation
+};
+
+#endif  // COMPONENT_HANDLER_AS5047U_ANGLE_TRACKER_H_
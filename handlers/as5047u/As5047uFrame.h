@@ -0,0 +1,421 @@
+/**
+ * @file As5047uFrame.h
+ * @brief AS5047U SPI frame codec and pipelined multi-register read.
+ *
+ * @details
+ * The AS5047U answers every SPI frame with the result of the *previous*
+ * command. Reading N registers therefore needs only N + 1 frames when the
+ * reads are chained back to back:
+ *
+ * @code
+ *  MOSI:  RD r0   RD r1   RD r2   NOP
+ *  MISO:  (stale) r0      r1      r2
+ * @endcode
+ *
+ * As5047uFrameCodec builds read commands and decodes responses for the
+ * 16-, 24- and 32-bit frame formats, and ReadPipelined() runs such a chain
+ * over any transfer callable, so it can be driven by As5047uSpiAdapter or
+ * by a simulated device.
+ *
+ * Frame layout (MSB first):
+ * - 16-bit: [15] 0, [14] R/W (1 = read), [13:0] address. Responses carry
+ *   [15] warning, [14] error, [13:0] data. No CRC.
+ * - 24-bit: the 16-bit word followed by CRC-8 over it.
+ * - 32-bit: a leading pad byte (0x00 on MOSI, ignored on MISO), then the
+ *   24-bit frame.
+ *
+ * CRC-8: polynomial 0x1D, initial value 0xC4, final XOR 0xFF.
+ *
+ * Compile-time layer:
+ * - The CRC uses a 256-entry table generated at compile time (two lookups
+ *   per word instead of 16 shift/XOR steps).
+ * - As5047uFrameTraits<Format> fixes frame length, pad offset and CRC
+ *   presence per format, so its builders and parsers carry no format branches.
+ * - As5047uPrecomputedRead holds the command frames of a fixed register set
+ *   for all three formats, built at compile time by PrecomputeRead(). Reading
+ *   that set sends them as-is; only the responses are decoded at run time.
+ *
+ * The runtime-format entry points (BuildReadFrame(), ParseResponse(),
+ * ReadPipelined(), ...) switch on the format once per call and then run the
+ * templated code.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#ifndef COMPONENT_HANDLER_AS5047U_FRAME_H_
+#define COMPONENT_HANDLER_AS5047U_FRAME_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "core/hf-core-drivers/external/hf-as5047u-driver/inc/as5047u.hpp"
+
+/**
+ * @brief Outcome of one pipelined read chain.
+ */
+struct As5047uPipelineStatus {
+    uint32_t frames;       ///< SPI frames clocked
+    bool crc_ok;           ///< Every response carrying a result passed CRC (always true for 16-bit)
+    bool warning;          ///< Warning bit set in any response
+    bool error;            ///< Error bit set in any response (ERRFL has flags)
+};
+
+/** @brief Longest AS5047U frame in bytes (32-bit format); also the row size of frame buffers. */
+inline constexpr size_t kAs5047uMaxFrameBytes = 4;
+
+/** @brief One frame buffer row; bytes past the frame length are zero. */
+using As5047uFrameRow = std::array<uint8_t, kAs5047uMaxFrameBytes>;
+
+/** @brief CRC-8 lookup table (polynomial 0x1D, MSB first), generated at compile time. */
+inline constexpr std::array<uint8_t, 256> kAs5047uCrc8Table = [] {
+    std::array<uint8_t, 256> table{};
+    for (size_t i = 0; i < table.size(); ++i) {
+        auto crc = static_cast<uint8_t>(i);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x80U) ? static_cast<uint8_t>((crc << 1) ^ 0x1DU) : static_cast<uint8_t>(crc << 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+/**
+ * @brief Frame encoding fixed at compile time for one frame format.
+ * @tparam Format FrameFormat::SPI_16, SPI_24 or SPI_32
+ */
+template <FrameFormat Format>
+struct As5047uFrameTraits {
+    /** @brief Bytes on the wire. */
+    static constexpr size_t kBytes = Format == FrameFormat::SPI_32 ? 4 : (Format == FrameFormat::SPI_24 ? 3 : 2);
+
+    /** @brief Offset of the 16-bit word (1 for the 32-bit pad byte). */
+    static constexpr size_t kOffset = Format == FrameFormat::SPI_32 ? 1 : 0;
+
+    /** @brief Whether the frame carries a CRC byte. */
+    static constexpr bool kHasCrc = Format != FrameFormat::SPI_16;
+
+    /** @brief CRC-8 over a 16-bit word (table driven). */
+    static constexpr uint8_t Crc8(uint16_t word) noexcept {
+        uint8_t crc = kAs5047uCrc8Table[0xC4U ^ (word >> 8)];
+        crc = kAs5047uCrc8Table[crc ^ (word & 0xFFU)];
+        return static_cast<uint8_t>(crc ^ 0xFFU);
+    }
+
+    /** @brief Encode a read of @p address. */
+    static constexpr As5047uFrameRow BuildRead(uint16_t address) noexcept {
+        const auto word = static_cast<uint16_t>((1U << 14) | (address & 0x3FFFU));
+        As5047uFrameRow frame{};
+        frame[kOffset] = static_cast<uint8_t>(word >> 8);
+        frame[kOffset + 1] = static_cast<uint8_t>(word & 0xFFU);
+        if constexpr (kHasCrc) {
+            frame[kOffset + 2] = Crc8(word);
+        }
+        return frame;
+    }
+
+    /**
+     * @brief Decode a response frame.
+     * @return false on CRC mismatch (never for 16-bit)
+     */
+    static constexpr bool Parse(const uint8_t* in, uint16_t& data, bool& warning, bool& error) noexcept {
+        const auto word = static_cast<uint16_t>((in[kOffset] << 8) | in[kOffset + 1]);
+        data = static_cast<uint16_t>(word & 0x3FFFU);
+        warning = (word & 0x8000U) != 0;
+        error = (word & 0x4000U) != 0;
+        if constexpr (kHasCrc) {
+            return in[kOffset + 2] == Crc8(word);
+        } else {
+            return true;
+        }
+    }
+};
+
+/**
+ * @brief Call @p fn with the As5047uFrameTraits of a run-time @p format.
+ *
+ * The single switch that turns a configured format into compile-time code.
+ */
+template <typename Fn>
+constexpr auto As5047uDispatchFormat(FrameFormat format, Fn&& fn) noexcept {
+    switch (format) {
+        case FrameFormat::SPI_24: return fn(As5047uFrameTraits<FrameFormat::SPI_24>{});
+        case FrameFormat::SPI_32: return fn(As5047uFrameTraits<FrameFormat::SPI_32>{});
+        default: return fn(As5047uFrameTraits<FrameFormat::SPI_16>{});
+    }
+}
+
+/**
+ * @brief Command frames of a pipelined read of @p N fixed registers, for every frame format.
+ *
+ * Build with As5047uFrameCodec::PrecomputeRead() in a constexpr context.
+ */
+template <size_t N>
+struct As5047uPrecomputedRead {
+    static_assert(N > 0, "empty register set");
+
+    /** @brief Frames per read (N reads + trailing NOP). */
+    static constexpr size_t kFrames = N + 1;
+
+    using Frames = std::array<As5047uFrameRow, kFrames>;
+
+    std::array<uint16_t, N> registers{};  ///< Registers, in read order
+    Frames frames16{};                    ///< 16-bit frames
+    Frames frames24{};                    ///< 24-bit frames
+    Frames frames32{};                    ///< 32-bit frames
+
+    /** @brief Frames for @p format. */
+    constexpr const Frames& For(FrameFormat format) const noexcept {
+        switch (format) {
+            case FrameFormat::SPI_24: return frames24;
+            case FrameFormat::SPI_32: return frames32;
+            default: return frames16;
+        }
+    }
+};
+
+/**
+ * @brief AS5047U frame encoder / decoder.
+ */
+class As5047uFrameCodec {
+public:
+    /// @name Register addresses
+    /// @{
+    static constexpr uint16_t kRegNop = 0x0000;        ///< No operation
+    static constexpr uint16_t kRegErrfl = 0x0001;      ///< Error flags (clear on read)
+    static constexpr uint16_t kRegAgc = 0x3FF9;        ///< AGC value [7:0]
+    static constexpr uint16_t kRegVel = 0x3FFC;        ///< Velocity, 14-bit two's complement
+    static constexpr uint16_t kRegMag = 0x3FFD;        ///< CORDIC magnitude
+    static constexpr uint16_t kRegAngleUnc = 0x3FFE;   ///< Angle without DAEC
+    static constexpr uint16_t kRegAngleCom = 0x3FFF;   ///< Angle with DAEC
+    /// @}
+
+    /** @brief Longest frame in bytes (32-bit format). */
+    static constexpr size_t kMaxFrameBytes = kAs5047uMaxFrameBytes;
+
+    /** @brief Most registers one ReadPipelined() call accepts. */
+    static constexpr size_t kMaxPipelineRegisters = 8;
+
+    /** @brief Frame length in bytes for @p format. */
+    static constexpr size_t FrameBytes(FrameFormat format) noexcept {
+        return As5047uDispatchFormat(format, [](auto traits) { return decltype(traits)::kBytes; });
+    }
+
+    /** @brief CRC-8 (poly 0x1D, init 0xC4, xorout 0xFF) over a 16-bit word, MSB first. */
+    static constexpr uint8_t Crc8(uint16_t word) noexcept {
+        return As5047uFrameTraits<FrameFormat::SPI_24>::Crc8(word);
+    }
+
+    /** @brief Bit-by-bit CRC-8; reference for the lookup table. */
+    static constexpr uint8_t Crc8Bitwise(uint16_t word) noexcept {
+        uint8_t crc = 0xC4;
+        for (int byte = 1; byte >= 0; --byte) {
+            crc ^= static_cast<uint8_t>(word >> (8 * byte));
+            for (int bit = 0; bit < 8; ++bit) {
+                crc = (crc & 0x80U) ? static_cast<uint8_t>((crc << 1) ^ 0x1DU) : static_cast<uint8_t>(crc << 1);
+            }
+        }
+        return static_cast<uint8_t>(crc ^ 0xFFU);
+    }
+
+    /**
+     * @brief Encode a read command.
+     * @param format Frame format
+     * @param address 14-bit register address
+     * @param out At least FrameBytes(format) bytes
+     * @return Bytes written
+     */
+    static size_t BuildReadFrame(FrameFormat format, uint16_t address, uint8_t* out) noexcept {
+        return As5047uDispatchFormat(format, [&](auto traits) {
+            using Traits = decltype(traits);
+            const As5047uFrameRow frame = Traits::BuildRead(address);
+            for (size_t i = 0; i < Traits::kBytes; ++i) {
+                out[i] = frame[i];
+            }
+            return Traits::kBytes;
+        });
+    }
+
+    /**
+     * @brief Decode a response frame.
+     * @param format Frame format
+     * @param in FrameBytes(format) received bytes
+     * @param data 14-bit payload
+     * @param warning Warning bit
+     * @param error Error bit
+     * @return false on CRC mismatch (24/32-bit formats only)
+     */
+    static bool ParseResponse(FrameFormat format, const uint8_t* in, uint16_t& data,
+                              bool& warning, bool& error) noexcept {
+        return As5047uDispatchFormat(format, [&](auto traits) { return decltype(traits)::Parse(in, data, warning, error); });
+    }
+
+    /**
+     * @brief Build the command frames of a pipelined read at compile time.
+     *
+     * @code
+     * static constexpr auto kAngleAndVelocity = As5047uFrameCodec::PrecomputeRead(
+     *     std::array<uint16_t, 2>{As5047uFrameCodec::kRegAngleCom, As5047uFrameCodec::kRegVel});
+     * @endcode
+     *
+     * @param registers Register addresses, in read order (1..kMaxPipelineRegisters)
+     * @return Frames for every format, each N reads followed by a NOP
+     */
+    template <size_t N>
+    static constexpr As5047uPrecomputedRead<N> PrecomputeRead(const std::array<uint16_t, N>& registers) noexcept {
+        static_assert(N <= kMaxPipelineRegisters, "too many registers for one pipelined read");
+        As5047uPrecomputedRead<N> read{};
+        read.registers = registers;
+        for (size_t i = 0; i <= N; ++i) {
+            const uint16_t address = i < N ? registers[i] : kRegNop;
+            read.frames16[i] = As5047uFrameTraits<FrameFormat::SPI_16>::BuildRead(address);
+            read.frames24[i] = As5047uFrameTraits<FrameFormat::SPI_24>::BuildRead(address);
+            read.frames32[i] = As5047uFrameTraits<FrameFormat::SPI_32>::BuildRead(address);
+        }
+        return read;
+    }
+
+    /**
+     * @brief Encode a pipelined read as separate frames for a batch transfer.
+     *
+     * Frame i reads registers[i]; the last frame is a NOP that collects the
+     * final result.
+     *
+     * @param format Frame format
+     * @param registers Register addresses, in read order
+     * @param count Number of registers (1..kMaxPipelineRegisters)
+     * @param frames Output, count + 1 rows of kMaxFrameBytes
+     * @return Frames written (count + 1), or 0 if @p count is out of range
+     */
+    static size_t BuildPipelineFrames(FrameFormat format, const uint16_t* registers, size_t count,
+                                      uint8_t (*frames)[kMaxFrameBytes]) noexcept {
+        if (registers == nullptr || frames == nullptr || count == 0 || count > kMaxPipelineRegisters) {
+            return 0;
+        }
+        return As5047uDispatchFormat(format, [&](auto traits) {
+            for (size_t i = 0; i <= count; ++i) {
+                const As5047uFrameRow frame = decltype(traits)::BuildRead(i < count ? registers[i] : kRegNop);
+                for (size_t b = 0; b < kMaxFrameBytes; ++b) {
+                    frames[i][b] = frame[b];
+                }
+            }
+            return count + 1;
+        });
+    }
+
+    /**
+     * @brief Decode the responses of a batch built by BuildPipelineFrames().
+     * @param format Frame format
+     * @param frames count + 1 received frames (frame 0 is stale and skipped)
+     * @param count Number of registers
+     * @param values Output payloads, in read order
+     * @param status Frame count and response status bits
+     * @return true if every result frame passed CRC
+     */
+    static bool ParsePipelineResponses(FrameFormat format, const uint8_t (*frames)[kMaxFrameBytes], size_t count,
+                                       uint16_t* values, As5047uPipelineStatus& status) noexcept {
+        status = As5047uPipelineStatus{static_cast<uint32_t>(count + 1), true, false, false};
+        if (frames == nullptr || values == nullptr || count == 0 || count > kMaxPipelineRegisters) {
+            status.crc_ok = false;
+            return false;
+        }
+        return As5047uDispatchFormat(format, [&](auto traits) {
+            for (size_t i = 1; i <= count; ++i) {
+                bool warning = false;
+                bool error = false;
+                status.crc_ok &= decltype(traits)::Parse(frames[i], values[i - 1], warning, error);
+                status.warning |= warning;
+                status.error |= error;
+            }
+            return status.crc_ok;
+        });
+    }
+
+    /**
+     * @brief Read @p count registers in count + 1 chained frames.
+     *
+     * @tparam TransferFn Callable `void(const uint8_t* tx, uint8_t* rx, size_t len)`
+     *                    performing one chip-selected frame.
+     * @param format Frame format
+     * @param transfer Frame transfer
+     * @param registers Register addresses, in read order
+     * @param count Number of registers (1..kMaxPipelineRegisters)
+     * @param values Output payloads, same order as @p registers
+     * @param status Frame count and response status bits
+     * @return true if every result frame passed CRC
+     */
+    template <typename TransferFn>
+    static bool ReadPipelined(FrameFormat format, TransferFn&& transfer, const uint16_t* registers,
+                              size_t count, uint16_t* values, As5047uPipelineStatus& status) noexcept {
+        status = As5047uPipelineStatus{0, true, false, false};
+        if (registers == nullptr || values == nullptr || count == 0 || count > kMaxPipelineRegisters) {
+            status.crc_ok = false;
+            return false;
+        }
+        return As5047uDispatchFormat(format, [&](auto traits) {
+            using Traits = decltype(traits);
+            return RunChain<Traits>(transfer, count, [&](size_t i) {
+                return Traits::BuildRead(i < count ? registers[i] : kRegNop);
+            }, values, status);
+        });
+    }
+
+    /**
+     * @brief Read a precomputed register set in N + 1 chained frames.
+     *
+     * Same as ReadPipelined() above, but the command frames come from
+     * @p read, so nothing is encoded at run time.
+     *
+     * @param format Frame format
+     * @param transfer Frame transfer
+     * @param read Frames from PrecomputeRead()
+     * @param values Output payloads, N entries in the order of read.registers
+     * @param status Frame count and response status bits
+     * @return true if every result frame passed CRC
+     */
+    template <size_t N, typename TransferFn>
+    static bool ReadPipelined(FrameFormat format, TransferFn&& transfer, const As5047uPrecomputedRead<N>& read,
+                              uint16_t* values, As5047uPipelineStatus& status) noexcept {
+        status = As5047uPipelineStatus{0, true, false, false};
+        const auto& frames = read.For(format);
+        return As5047uDispatchFormat(format, [&](auto traits) {
+            return RunChain<decltype(traits)>(transfer, N, [&](size_t i) -> const As5047uFrameRow& {
+                return frames[i];
+            }, values, status);
+        });
+    }
+
+private:
+    /** @brief Clock count + 1 frames produced by @p frame_at and decode the results. */
+    template <typename Traits, typename TransferFn, typename FrameAt>
+    static bool RunChain(TransferFn& transfer, size_t count, FrameAt&& frame_at, uint16_t* values,
+                         As5047uPipelineStatus& status) noexcept {
+        uint8_t rx[kMaxFrameBytes];
+
+        // Frame i sends command i and receives the result of command i - 1;
+        // the response to frame 0 is stale, the trailing NOP collects the last result.
+        for (size_t i = 0; i <= count; ++i) {
+            const As5047uFrameRow& tx = frame_at(i);
+            transfer(static_cast<const uint8_t*>(tx.data()), static_cast<uint8_t*>(rx), Traits::kBytes);
+            ++status.frames;
+            if (i == 0) {
+                continue;
+            }
+            bool warning = false;
+            bool error = false;
+            status.crc_ok &= Traits::Parse(rx, values[i - 1], warning, error);
+            status.warning |= warning;
+            status.error |= error;
+        }
+        return status.crc_ok;
+    }
+};
+
+// The lookup table must reproduce the bit-by-bit definition.
+static_assert(As5047uFrameCodec::Crc8(0x0000) == As5047uFrameCodec::Crc8Bitwise(0x0000), "CRC-8 table mismatch");
+static_assert(As5047uFrameCodec::Crc8(0x4001) == As5047uFrameCodec::Crc8Bitwise(0x4001), "CRC-8 table mismatch");
+static_assert(As5047uFrameCodec::Crc8(0x7FFF) == As5047uFrameCodec::Crc8Bitwise(0x7FFF), "CRC-8 table mismatch");
+static_assert(As5047uFrameCodec::Crc8(0xFFFF) == As5047uFrameCodec::Crc8Bitwise(0xFFFF), "CRC-8 table mismatch");
+
+#endif  // COMPONENT_HANDLER_AS5047U_FRAME_H_
@@ -26,30 +26,207 @@
 #include <algorithm>
 #include <cmath>
 #include "handlers/logger/Logger.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/OsUtility.h"
+
+#if defined(ESP_PLATFORM)
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+namespace {
+
+// BaseThread creates tasks without affinity; the sampling task pins itself in
+// Setup(), which only SMP FreeRTOS allows for a running task.
+#if defined(ESP_PLATFORM) && defined(CONFIG_FREERTOS_SMP)
+constexpr int32_t kStreamPinnableCores = portNUM_PROCESSORS;
+#else
+constexpr int32_t kStreamPinnableCores = 0;
+#endif
+
+} // namespace
 
 //======================================================//
 // AS5047U SPI ADAPTER IMPLEMENTATION
 //======================================================//
 
-As5047uSpiAdapter::As5047uSpiAdapter(BaseSpi& spi_interface) noexcept
-    : spi_interface_(spi_interface) {}
+As5047uSpiAdapter::As5047uSpiAdapter(BaseSpi& spi_interface, uint32_t timeout_ms) noexcept
+    : spi_interface_(spi_interface),
+      timeout_ms_(timeout_ms != 0 ? timeout_ms : kDefaultTimeoutMs) {}
+
+As5047uSpiAdapter::~As5047uSpiAdapter() noexcept {
+    StopQueue();
+}
 
 void As5047uSpiAdapter::transfer(const uint8_t* tx, uint8_t* rx, std::size_t len) noexcept {
     // Handle null pointer cases gracefully
     if (len == 0) return;
-    
+
+    MutexLockGuard lock(bus_mutex_);
+    // AS5047U::spiBus::transfer doesn't return error codes; failures are counted and
+    // the 0xFF fill lets the driver's CRC / error-bit checks reject the frame.
+    (void)TransferFrameLocked(tx, rx, len, timeout_ms_.load(std::memory_order_relaxed));
+}
+
+hf_spi_err_t As5047uSpiAdapter::TransferChained(const uint8_t* tx, uint8_t* rx, std::size_t len,
+                                                uint32_t& transfer_count, bool& chained) noexcept {
+    MutexLockGuard lock(bus_mutex_);
+    chained = transfer_count_.load(std::memory_order_relaxed) == transfer_count;
+    const hf_spi_err_t result = TransferFrameLocked(tx, rx, len, timeout_ms_.load(std::memory_order_relaxed));
+    transfer_count = transfer_count_.load(std::memory_order_relaxed);
+    return result;
+}
+
+hf_spi_err_t As5047uSpiAdapter::TransferFrameLocked(const uint8_t* tx, uint8_t* rx, std::size_t len,
+                                                    uint32_t timeout_ms) noexcept {
+    transfer_count_.fetch_add(1, std::memory_order_relaxed);
+
     // Perform SPI transfer through BaseSpi interface
     // Note: BaseSpi implementations should handle CS assertion/deassertion
-    hf_spi_err_t result = spi_interface_.Transfer(
+    const hf_spi_err_t result = spi_interface_.Transfer(
         const_cast<uint8_t*>(tx),  // BaseSpi expects non-const tx buffer
         rx,
         static_cast<uint16_t>(len),
-        1000  // 1 second timeout
-    );
-    
-    // AS5047U::spiBus::transfer doesn't return error codes, so we handle errors internally
-    // The AS5047U driver will detect communication issues through CRC and frame validation
-    (void)result; // Suppress unused variable warning
+        timeout_ms);
+
+    if (result != hf_spi_err_t::SPI_SUCCESS) {
+        error_count_.fetch_add(1, std::memory_order_relaxed);
+        last_result_.store(result, std::memory_order_relaxed);
+        if (rx != nullptr) {
+            memset(rx, 0xFF, len);
+        }
+    }
+    return result;
+}
+
+bool As5047uSpiAdapter::StartQueue(uint32_t priority) noexcept {
+    if (queue_task_) {
+        return true;
+    }
+    if (!queue_.Allocate(kQueueDepth)) {
+        return false;
+    }
+    queue_task_ = std::make_unique<As5047uSpiQueueTask>(*this, priority);
+    if (!queue_task_->EnsureInitialized() || !queue_task_->Start()) {
+        queue_task_.reset();
+        return false;
+    }
+    return true;
+}
+
+bool As5047uSpiAdapter::StopQueue() noexcept {
+    if (!queue_task_) {
+        return true;
+    }
+
+    queue_task_->Stop();
+    queue_task_->Wake();
+    for (uint32_t waited_ms = 0; queue_task_->IsThreadRunning(); ++waited_ms) {
+        if (waited_ms >= kQueueStopTimeoutMs) {
+            Logger::GetInstance().Error("As5047uSpiAdapter", "Queue task did not stop");
+            // Leak rather than free a stack that may still be running.
+            (void)queue_task_.release();
+            return false;
+        }
+        os_delay_msec(1);
+    }
+    queue_task_.reset();
+
+    // The consumer is gone; fail whatever it did not reach so waiters are released.
+    As5047uSpiTransaction* transaction = nullptr;
+    while (queue_.Pop(transaction)) {
+        transaction->result = hf_spi_err_t::SPI_ERR_FAILURE;
+        Complete(*transaction);
+    }
+    return true;
+}
+
+bool As5047uSpiAdapter::Submit(As5047uSpiTransaction& transaction) noexcept {
+    if (!queue_task_ || transaction.frame_count == 0 ||
+        transaction.frame_count > As5047uSpiTransaction::kMaxFrames ||
+        transaction.frame_bytes == 0 || transaction.frame_bytes > As5047uFrameCodec::kMaxFrameBytes) {
+        return false;
+    }
+    if (transaction.state.load(std::memory_order_acquire) == As5047uTransactionState::Queued) {
+        return false;
+    }
+
+    transaction.frames_done = 0;
+    transaction.result = hf_spi_err_t::SPI_SUCCESS;
+    transaction.state.store(As5047uTransactionState::Queued, std::memory_order_relaxed);
+    if (!queue_.Push(&transaction)) {
+        transaction.state.store(As5047uTransactionState::Idle, std::memory_order_release);
+        return false;
+    }
+    queue_task_->Wake();
+    return true;
+}
+
+void As5047uSpiAdapter::DrainQueue() noexcept {
+    As5047uSpiTransaction* transaction = nullptr;
+    while (queue_.Pop(transaction)) {
+        RunTransaction(*transaction);
+    }
+}
+
+void As5047uSpiAdapter::RunTransaction(As5047uSpiTransaction& transaction) noexcept {
+    const uint32_t timeout_ms =
+        transaction.timeout_ms != 0 ? transaction.timeout_ms : timeout_ms_.load(std::memory_order_relaxed);
+    {
+        // One lock for the whole batch: no other frame may land inside a pipelined chain.
+        MutexLockGuard lock(bus_mutex_);
+        for (uint8_t i = 0; i < transaction.frame_count; ++i) {
+            const hf_spi_err_t result =
+                TransferFrameLocked(transaction.tx[i], transaction.rx[i], transaction.frame_bytes, timeout_ms);
+            if (result != hf_spi_err_t::SPI_SUCCESS) {
+                transaction.result = result;
+                break;
+            }
+            ++transaction.frames_done;
+        }
+    }
+    Complete(transaction);
+}
+
+void As5047uSpiAdapter::Complete(As5047uSpiTransaction& transaction) noexcept {
+    if (transaction.on_complete) {
+        transaction.on_complete(transaction);
+    }
+    // Last touch: once the state leaves Queued the owner may reuse or free the transaction.
+    SignalSemaphore* const done_signal = transaction.done_signal;
+    transaction.state.store(transaction.result == hf_spi_err_t::SPI_SUCCESS ? As5047uTransactionState::Done
+                                                                            : As5047uTransactionState::Failed,
+                            std::memory_order_release);
+    if (done_signal) {
+        (void)done_signal->Signal();
+    }
+}
+
+As5047uSpiQueueTask::As5047uSpiQueueTask(As5047uSpiAdapter& adapter, uint32_t priority) noexcept
+    : BaseThread("As5047uSpiQueue"), adapter_(adapter), priority_(priority), wake_("As5047uSpiWake") {}
+
+bool As5047uSpiQueueTask::Initialize() noexcept {
+    return wake_.EnsureInitialized() &&
+           CreateBaseThread(stack_, sizeof(stack_), priority_, 5, 0, OS_AUTO_START);
+}
+
+bool As5047uSpiQueueTask::Setup() noexcept {
+    return true;
+}
+
+uint32_t As5047uSpiQueueTask::Step() noexcept {
+    // The timeout only bounds how long a lost signal can delay queued work.
+    (void)wake_.WaitUntilSignalled(kIdleWaitMs);
+    adapter_.DrainQueue();
+    return 0;
+}
+
+bool As5047uSpiQueueTask::Cleanup() noexcept {
+    return true;
+}
+
+bool As5047uSpiQueueTask::ResetVariables() noexcept {
+    return true;
 }
 
 //======================================================//
@@ -63,7 +240,8 @@ As5047uHandler::As5047uHandler(BaseSpi& spi_interface, const As5047uConfig& conf
       config_(config),
       initialized_(false),
       last_error_(AS5047U_Error::None),
-      diagnostics_{} {
+      diagnostics_{},
+      measurement_done_("As5047uMeasDone") {
     
     // Generate description string
     snprintf(description_, sizeof(description_), "AS5047U_Handler_SPI");
@@ -72,6 +250,12 @@ As5047uHandler::As5047uHandler(BaseSpi& spi_interface, const As5047uConfig& conf
     memset(&diagnostics_, 0, sizeof(diagnostics_));
 }
 
+As5047uHandler::~As5047uHandler() noexcept {
+    StopStreaming();
+    // The queue may still point at measurement_txn_, which is destroyed before the adapter.
+    StopSpiQueue();
+}
+
 bool As5047uHandler::Initialize() noexcept {
     MutexLockGuard lock(handler_mutex_);
     
@@ -82,7 +266,7 @@ bool As5047uHandler::Initialize() noexcept {
     }
     
     // Create SPI adapter (CRTP pattern)
-    spi_adapter_ = std::make_unique<As5047uSpiAdapter>(spi_ref_);
+    spi_adapter_ = std::make_unique<As5047uSpiAdapter>(spi_ref_, config_.spi_timeout_ms);
     if (!spi_adapter_) {
         last_error_ = AS5047U_Error::None;
         return false;
@@ -134,6 +318,9 @@ bool As5047uHandler::EnsureInitialized() noexcept {
 }
 
 bool As5047uHandler::Deinitialize() noexcept {
+    // The sampling task uses the adapter, so it must be gone before the adapter is.
+    StopStreaming();
+
     MutexLockGuard lock(handler_mutex_);
     
     // Reset shared pointer (safe automatic cleanup)
@@ -176,6 +363,449 @@ const as5047u::AS5047U<As5047uSpiAdapter>* As5047uHandler::GetDriver() const noe
     return self->GetDriver();
 }
 
+//======================================================//
+// MEASUREMENT
+//======================================================//
+
+bool As5047uHandler::ReadMeasurement(As5047uMeasurement& measurement) noexcept {
+    measurement.valid = false;
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !EnsureInitializedLocked()) {
+        return false;
+    }
+    return ReadMeasurementLocked(measurement);
+}
+
+// Angle first: its result is clocked out by the second frame.
+// Command frames for every format are built at compile time.
+static constexpr auto kMeasurementRead = As5047uFrameCodec::PrecomputeRead(std::array<uint16_t, 6>{
+    As5047uFrameCodec::kRegAngleCom, As5047uFrameCodec::kRegAngleUnc, As5047uFrameCodec::kRegVel,
+    As5047uFrameCodec::kRegMag,      As5047uFrameCodec::kRegAgc,      As5047uFrameCodec::kRegErrfl,
+});
+static constexpr size_t kMeasurementRegisterCount = kMeasurementRead.registers.size();
+static_assert(decltype(kMeasurementRead)::kFrames == As5047uHandler::kMeasurementFrames,
+              "frame count out of sync with register list");
+
+bool As5047uHandler::ReadMeasurementLocked(As5047uMeasurement& measurement) noexcept {
+    As5047uSpiAdapter& adapter = *spi_adapter_;
+    const auto transfer = [&adapter](const uint8_t* tx, uint8_t* rx, std::size_t len) {
+        adapter.transfer(tx, rx, len);
+    };
+
+    uint16_t values[kMeasurementRegisterCount] = {};
+    As5047uPipelineStatus status{};
+    bool ok = false;
+    for (uint8_t attempt = 0; attempt <= config_.crc_retries && !ok; ++attempt) {
+        // Hold the bus for the whole chain: a queued batch between two frames would
+        // shift every later result onto the wrong register without failing a CRC.
+        As5047uSpiAdapter::BusGuard bus(adapter);
+        const uint32_t spi_errors = adapter.GetErrorCount();
+        const bool crc_ok = As5047uFrameCodec::ReadPipelined(config_.frame_format, transfer, kMeasurementRead, values,
+                                                             status);
+        // SPI failures are counted by the adapter; 16-bit frames have no CRC to catch them.
+        ok = crc_ok && adapter.GetErrorCount() == spi_errors;
+        if (!crc_ok && adapter.GetErrorCount() == spi_errors) {
+            ++diagnostics_.communication_errors;
+        }
+        if (!ok) {
+            diagnostics_.communication_ok = false;
+        }
+    }
+    diagnostics_.spi_frames = adapter.GetTransferCount();
+    if (!ok) {
+        last_error_ = AS5047U_Error::CrcError;
+        return false;
+    }
+
+    DecodeMeasurementLocked(values, measurement);
+    return true;
+}
+
+void As5047uHandler::DecodeMeasurementLocked(const uint16_t* values, As5047uMeasurement& measurement) noexcept {
+    measurement.angle_compensated = values[0];
+    measurement.angle_raw = values[1];
+    // Sign-extend the 14-bit two's complement velocity
+    measurement.velocity_raw = static_cast<int16_t>(static_cast<uint16_t>(values[2] << 2)) >> 2;
+    measurement.magnitude = values[3];
+    measurement.agc_value = static_cast<uint8_t>(values[4] & 0xFFU);
+    measurement.error_flags = values[5];
+
+    measurement.velocity_deg_per_sec = static_cast<float>(measurement.velocity_raw) * kVelocityDegPerSecPerLsb;
+    measurement.velocity_rad_per_sec = measurement.velocity_deg_per_sec * (static_cast<float>(M_PI) / 180.0f);
+    measurement.velocity_rpm = measurement.velocity_deg_per_sec / 6.0f;
+    measurement.valid = true;
+
+    HandleSensorErrors(measurement.error_flags);
+    ++diagnostics_.total_measurements;
+    last_error_ = static_cast<AS5047U_Error>(measurement.error_flags);
+}
+
+As5047uDiagnostics As5047uHandler::GetDiagnostics() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    As5047uDiagnostics diagnostics = diagnostics_;
+    if (spi_adapter_) {
+        diagnostics.spi_frames = spi_adapter_->GetTransferCount();
+        diagnostics.spi_errors = spi_adapter_->GetErrorCount();
+        diagnostics.communication_errors += diagnostics.spi_errors;
+    }
+    return diagnostics;
+}
+
+//======================================================//
+// QUEUED SPI
+//======================================================//
+
+bool As5047uHandler::StartSpiQueue(uint32_t priority) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !EnsureInitializedLocked()) {
+        return false;
+    }
+    return spi_adapter_->StartQueue(priority);
+}
+
+bool As5047uHandler::StopSpiQueue() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked()) {
+        return false;
+    }
+    // The queue task never takes the handler mutex, so stopping it here cannot deadlock.
+    return !spi_adapter_ || spi_adapter_->StopQueue();
+}
+
+bool As5047uHandler::SubmitTransaction(As5047uSpiTransaction& transaction) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !spi_adapter_) {
+        return false;
+    }
+    return spi_adapter_->Submit(transaction);
+}
+
+bool As5047uHandler::BeginReadMeasurement(As5047uSpiCompletion on_complete) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !EnsureInitializedLocked() || !spi_adapter_->IsQueueRunning()) {
+        return false;
+    }
+    // PrepareRead() refuses while the previous chain is still queued.
+    if (!measurement_txn_.PrepareRead(config_.frame_format, kMeasurementRead)) {
+        return false;
+    }
+    if (!measurement_done_.EnsureInitialized()) {
+        return false;
+    }
+    measurement_txn_.on_complete = on_complete;
+    measurement_txn_.done_signal = &measurement_done_;
+    return spi_adapter_->Submit(measurement_txn_);
+}
+
+bool As5047uHandler::FinishReadMeasurement(As5047uMeasurement& measurement, uint32_t timeout_us) noexcept {
+    measurement.valid = false;
+
+    // Wait without the handler mutex so other calls are not held up behind the bus.
+    const uint64_t start_us = RtosTime::GetCurrentTimeUs();
+    while (measurement_txn_.state.load(std::memory_order_acquire) == As5047uTransactionState::Queued) {
+        const uint64_t waited_us = RtosTime::GetCurrentTimeUs() - start_us;
+        if (waited_us >= timeout_us) {
+            return false;
+        }
+        if (waited_us < kMeasurementSpinUs) {
+            continue;
+        }
+        // Block so a queue task at or below our priority can run. A signal left
+        // over from an earlier measurement only costs another state check.
+        const auto remaining_ms = static_cast<uint32_t>((timeout_us - waited_us + 999) / 1000);
+        (void)measurement_done_.WaitUntilSignalled(remaining_ms);
+    }
+
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked()) {
+        return false;
+    }
+    const As5047uTransactionState state = measurement_txn_.state.load(std::memory_order_acquire);
+    measurement_txn_.state.store(As5047uTransactionState::Idle, std::memory_order_relaxed);
+    if (spi_adapter_) {
+        diagnostics_.spi_frames = spi_adapter_->GetTransferCount();
+    }
+    if (state != As5047uTransactionState::Done) {
+        // Idle: nothing was begun. Failed: SPI errors are already counted by the adapter.
+        diagnostics_.communication_ok = diagnostics_.communication_ok && state == As5047uTransactionState::Idle;
+        return false;
+    }
+
+    uint16_t values[kMeasurementRegisterCount] = {};
+    As5047uPipelineStatus status{};
+    if (!As5047uFrameCodec::ParsePipelineResponses(config_.frame_format, measurement_txn_.rx,
+                                                   kMeasurementRegisterCount, values, status)) {
+        ++diagnostics_.communication_errors;
+        diagnostics_.communication_ok = false;
+        last_error_ = AS5047U_Error::CrcError;
+        return false;
+    }
+    DecodeMeasurementLocked(values, measurement);
+    return true;
+}
+
+//======================================================//
+// STREAMING
+//======================================================//
+
+As5047uStreamTask::As5047uStreamTask(As5047uHandler& handler, const As5047uStreamConfig& config) noexcept
+    : BaseThread("As5047uStream"), handler_(handler), config_(config) {}
+
+bool As5047uStreamTask::Initialize() noexcept {
+    return CreateBaseThread(stack_, sizeof(stack_), config_.priority, 5, 0, OS_AUTO_START);
+}
+
+bool As5047uStreamTask::Setup() noexcept {
+#if defined(ESP_PLATFORM) && defined(CONFIG_FREERTOS_SMP)
+    if (config_.core_id >= 0) {
+        vTaskCoreAffinitySet(nullptr, static_cast<UBaseType_t>(1U << config_.core_id));
+    }
+#endif
+    return true;
+}
+
+uint32_t As5047uStreamTask::Step() noexcept {
+    handler_.RunStreamBurst();
+    return config_.yield_ms;
+}
+
+bool As5047uStreamTask::Cleanup() noexcept {
+    return true;
+}
+
+bool As5047uStreamTask::ResetVariables() noexcept {
+    return true;
+}
+
+bool As5047uHandler::StartStreaming(const As5047uStreamConfig& config) noexcept {
+    if (config.sample_rate_hz < kMinStreamRateHz || config.sample_rate_hz > kMaxStreamRateHz ||
+        !(config.observer_bandwidth_hz > 0.0f) ||
+        config.observer_bandwidth_hz * 10.0f > static_cast<float>(config.sample_rate_hz) ||
+        !(config.observer_damping > 0.0f) || config.burst_ms == 0) {
+        return false;
+    }
+    if (config.run_task && (config.yield_ms == 0 || config.core_id >= kStreamPinnableCores)) {
+        Logger::GetInstance().Error("As5047uHandler",
+                                    "Stream task needs yield_ms > 0 and a pinnable core_id (got %u, %d)",
+                                    static_cast<unsigned>(config.yield_ms), static_cast<int>(config.core_id));
+        return false;
+    }
+
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || streaming_ || !EnsureInitializedLocked()) {
+        return false;
+    }
+
+    stream_config_ = config;
+    stream_period_us_ = 1000000U / config.sample_rate_hz;
+    stream_frame_len_ = static_cast<uint8_t>(
+        As5047uFrameCodec::BuildReadFrame(config_.frame_format, As5047uFrameCodec::kRegAngleCom, stream_tx_));
+    stream_chained_ = false;
+    stream_command_us_ = 0;
+    stream_first_sample_us_ = 0;
+    stream_last_sample_us_ = 0;
+    stream_next_deadline_us_ = 0;
+    tracker_.Configure(config.observer_bandwidth_hz, config.observer_damping,
+                       1.0f / static_cast<float>(config.sample_rate_hz));
+    tracker_.Reset();
+    stream_stats_ = As5047uStreamStats{};
+    stream_stats_.active = true;
+    stream_stats_.sample_rate_hz = config.sample_rate_hz;
+    streaming_ = true;
+
+    if (config.run_task) {
+        stream_task_ = std::make_unique<As5047uStreamTask>(*this, config);
+        if (!stream_task_->EnsureInitialized() || !stream_task_->Start()) {
+            stream_task_.reset();
+            streaming_ = false;
+            stream_stats_.active = false;
+            return false;
+        }
+        stream_stats_.task_running = true;
+    }
+    return true;
+}
+
+bool As5047uHandler::IsStreamCorePinningSupported() noexcept {
+    return kStreamPinnableCores > 0;
+}
+
+bool As5047uHandler::StopStreaming() noexcept {
+    std::unique_ptr<As5047uStreamTask> task;
+    {
+        MutexLockGuard lock(handler_mutex_);
+        if (!lock.IsLocked()) {
+            return false;
+        }
+        streaming_ = false;
+        stream_stats_.active = false;
+        stream_stats_.task_running = false;
+        task = std::move(stream_task_);
+    }
+    if (!task) {
+        return true;
+    }
+
+    // The task may be waiting for the handler mutex, so wait for it unlocked.
+    task->Stop();
+    for (uint32_t waited_ms = 0; task->IsThreadRunning(); ++waited_ms) {
+        if (waited_ms >= kStreamTaskStopTimeoutMs) {
+            Logger::GetInstance().Error("As5047uHandler", "Stream task did not stop");
+            // Leak rather than free a stack that may still be running.
+            (void)task.release();
+            return false;
+        }
+        os_delay_msec(1);
+    }
+    return true;
+}
+
+bool As5047uHandler::IsStreaming() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return lock.IsLocked() && streaming_;
+}
+
+uint8_t As5047uHandler::PollStream(uint8_t max_samples) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !streaming_ || !spi_adapter_) {
+        return 0;
+    }
+    uint8_t accepted = 0;
+    for (uint8_t i = 0; i < max_samples; ++i) {
+        accepted += SampleStreamLocked(RtosTime::GetCurrentTimeUs()) ? 1 : 0;
+    }
+    return accepted;
+}
+
+bool As5047uHandler::GetLatestSample(As5047uStreamSample& sample) const noexcept {
+    return stream_slot_.Load(sample);
+}
+
+bool As5047uHandler::SetStreamTurns(int32_t turns) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !streaming_ || !tracker_.IsSeeded()) {
+        return false;
+    }
+    tracker_.SetTurns(turns);
+    return true;
+}
+
+bool As5047uHandler::GetStreamStats(As5047uStreamStats& stats) const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    stats = stream_stats_;
+    if (stream_stats_.samples > 1 && stream_last_sample_us_ > stream_first_sample_us_) {
+        stats.samples_per_second = static_cast<float>(stream_stats_.samples - 1U) * 1.0e6f /
+                                   static_cast<float>(stream_last_sample_us_ - stream_first_sample_us_);
+    }
+    return true;
+}
+
+void As5047uHandler::RunStreamBurst() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !streaming_ || !spi_adapter_) {
+        return;
+    }
+
+    const uint64_t start_us = RtosTime::GetCurrentTimeUs();
+    if (stream_next_deadline_us_ == 0) {
+        stream_next_deadline_us_ = start_us;  // First burst: the schedule starts now
+    }
+    const uint64_t burst_end_us = start_us + stream_config_.burst_ms * 1000ULL;
+    for (;;) {
+        const uint64_t now_us = RtosTime::GetCurrentTimeUs();
+        if (now_us < stream_next_deadline_us_) {
+            if (stream_next_deadline_us_ >= burst_end_us) {
+                return;  // Next deadline belongs to the next burst
+            }
+            continue;    // Spin: RTOS delays are too coarse for the sample period
+        }
+
+        const auto late_us = static_cast<uint32_t>(now_us - stream_next_deadline_us_);
+        if (late_us > stream_stats_.max_late_us) {
+            stream_stats_.max_late_us = late_us;
+        }
+        if (late_us >= stream_period_us_) {
+            // Skip the deadlines we missed instead of sampling back to back
+            stream_stats_.overruns += late_us / stream_period_us_;
+            stream_next_deadline_us_ = now_us;
+        }
+
+        SampleStreamLocked(now_us);
+        stream_next_deadline_us_ += stream_period_us_;
+        if (!streaming_ || now_us >= burst_end_us) {
+            return;
+        }
+    }
+}
+
+bool As5047uHandler::SampleStreamLocked(uint64_t now_us) noexcept {
+    As5047uSpiAdapter& adapter = *spi_adapter_;
+
+    // Any frame since our last one (ReadMeasurement, queued transactions, driver
+    // calls) replaced the pending read. The adapter checks this atomically with
+    // the transfer, so nothing can slip in between.
+    uint8_t rx[As5047uFrameCodec::kMaxFrameBytes];
+    bool followed = false;
+    const hf_spi_err_t result =
+        adapter.TransferChained(stream_tx_, rx, stream_frame_len_, stream_transfers_, followed);
+    ++stream_stats_.frames;
+    const bool chained = stream_chained_ && followed;
+    if (stream_chained_ && !followed) {
+        ++stream_stats_.resyncs;
+    }
+
+    // The response carries the angle requested by the previous frame.
+    const uint64_t sampled_us = stream_command_us_;
+    stream_command_us_ = now_us;
+    if (result != hf_spi_err_t::SPI_SUCCESS) {
+        // Counted by the adapter; the command may not have reached the sensor either.
+        ++stream_stats_.spi_errors;
+        diagnostics_.communication_ok = false;
+        stream_chained_ = false;
+        return false;
+    }
+    stream_chained_ = true;
+    if (!chained) {
+        return false;
+    }
+
+    uint16_t angle = 0;
+    bool warning = false;
+    bool error = false;
+    if (!As5047uFrameCodec::ParseResponse(config_.frame_format, rx, angle, warning, error)) {
+        ++stream_stats_.crc_errors;
+        ++diagnostics_.communication_errors;
+        diagnostics_.communication_ok = false;
+        return false;
+    }
+    if (error) {
+        ++stream_stats_.error_frames;
+    }
+
+    const float dt_s = stream_last_sample_us_ != 0
+                           ? static_cast<float>(sampled_us - stream_last_sample_us_) * 1.0e-6f
+                           : 0.0f;
+    tracker_.Update(angle, dt_s);
+    if (stream_first_sample_us_ == 0) {
+        stream_first_sample_us_ = sampled_us;
+    }
+    stream_last_sample_us_ = sampled_us;
+
+    As5047uStreamSample sample{};
+    sample.timestamp_us = sampled_us;
+    sample.position_counts = tracker_.GetPositionCounts();
+    sample.turns = tracker_.GetTurns();
+    sample.angle = angle;
+    sample.sensor_error = error;
+    sample.estimated_angle_rad = tracker_.GetEstimatedAngleRad();
+    sample.velocity_rad_per_sec = tracker_.GetVelocityRadPerSec();
+    sample.velocity_rpm = tracker_.GetVelocityRpm();
+    sample.tracking_error_counts = tracker_.GetTrackingErrorCounts();
+    sample.sequence = stream_stats_.samples++;
+    stream_slot_.Store(sample);
+    return true;
+}
+
 //======================================================//
 // UTILITY METHODS
 //======================================================//
@@ -193,6 +823,7 @@ As5047uConfig As5047uHandler::GetDefaultConfig() noexcept {
     config.abi_resolution_bits = 14;
     config.uvw_pole_pairs = 1;
     config.high_temperature_mode = false;
+    config.spi_timeout_ms = As5047uSpiAdapter::kDefaultTimeoutMs;
     return config;
 }
 
@@ -237,9 +868,10 @@ void As5047uHandler::HandleSensorErrors(uint16_t sensor_errors) noexcept {
 }
 
 void As5047uHandler::UpdateDiagnostics() noexcept {
-    if (!as5047u_sensor_) return;
+    if (!as5047u_sensor_ || !spi_adapter_) return;
     
     // Read current error flags (driver handles retries internally)
+    As5047uSpiAdapter::BusGuard bus(*spi_adapter_);
     uint16_t error_flags = as5047u_sensor_->GetErrorFlags(config_.crc_retries);
     HandleSensorErrors(error_flags);
 }
@@ -328,6 +960,7 @@ void As5047uHandler::DumpDiagnostics() const noexcept {
     Logger::GetInstance().Info(TAG, "  ABI Resolution: %d bits", config_.abi_resolution_bits);
     Logger::GetInstance().Info(TAG, "  UVW Pole Pairs: %d", config_.uvw_pole_pairs);
     Logger::GetInstance().Info(TAG, "  High Temp Mode: %s", config_.high_temperature_mode ? "YES" : "NO");
+    Logger::GetInstance().Info(TAG, "  SPI Timeout: %lu ms", static_cast<unsigned long>(config_.spi_timeout_ms));
     
     // Diagnostics Information
     Logger::GetInstance().Info(TAG, "Sensor Diagnostics:");
@@ -339,11 +972,28 @@ void As5047uHandler::DumpDiagnostics() const noexcept {
     Logger::GetInstance().Info(TAG, "  Last Error Flags: 0x%04X", diagnostics_.last_error_flags);
     Logger::GetInstance().Info(TAG, "  Communication Errors: %d", diagnostics_.communication_errors);
     Logger::GetInstance().Info(TAG, "  Total Measurements: %d", diagnostics_.total_measurements);
+    Logger::GetInstance().Info(TAG, "  SPI Frames: %lu",
+        static_cast<unsigned long>(spi_adapter_ ? spi_adapter_->GetTransferCount() : 0));
+    Logger::GetInstance().Info(TAG, "  SPI Errors: %lu",
+        static_cast<unsigned long>(spi_adapter_ ? spi_adapter_->GetErrorCount() : 0));
     
+    // Streaming
+    Logger::GetInstance().Info(TAG, "Streaming:");
+    Logger::GetInstance().Info(TAG, "  Active: %s  Task: %s  Rate: %lu Hz",
+        streaming_ ? "YES" : "NO", stream_task_ ? "YES" : "NO",
+        static_cast<unsigned long>(stream_config_.sample_rate_hz));
+    Logger::GetInstance().Info(TAG, "  Samples: %lu  Frames: %lu  CRC Errors: %lu  Resyncs: %lu",
+        static_cast<unsigned long>(stream_stats_.samples), static_cast<unsigned long>(stream_stats_.frames),
+        static_cast<unsigned long>(stream_stats_.crc_errors), static_cast<unsigned long>(stream_stats_.resyncs));
+    Logger::GetInstance().Info(TAG, "  Overruns: %lu  Max Late: %lu us  Turns: %ld",
+        static_cast<unsigned long>(stream_stats_.overruns), static_cast<unsigned long>(stream_stats_.max_late_us),
+        static_cast<long>(tracker_.GetTurns()));
+
     // SPI Interface Status
     Logger::GetInstance().Info(TAG, "SPI Interface:");
     if (spi_adapter_) {
         Logger::GetInstance().Info(TAG, "  SPI Adapter: ACTIVE");
+        Logger::GetInstance().Info(TAG, "  Transaction Queue: %s", spi_adapter_->IsQueueRunning() ? "RUNNING" : "OFF");
     } else {
         Logger::GetInstance().Info(TAG, "  SPI Adapter: NOT_INITIALIZED");
     }
@@ -23,6 +23,7 @@
  * - Comprehensive diagnostics and error handling
  * - Multiple SPI frame formats (16/24/32-bit)
  * - Thread-safe concurrent access
+ * - High-rate streaming with multi-turn tracking and a PLL velocity observer
  *
  * @author HardFOC Team
  * @version 1.0
@@ -33,35 +34,188 @@
 #ifndef COMPONENT_HANDLER_AS5047U_HANDLER_H_
 #define COMPONENT_HANDLER_AS5047U_HANDLER_H_
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 #include <utility>
 #include "core/hf-core-drivers/external/hf-as5047u-driver/inc/as5047u.hpp"
 #include "base/BaseSpi.h"
 #include "RtosMutex.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/BaseThread.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/SignalSemaphore.h"
+#include "handlers/common/InlineCallback.h"
+#include "handlers/common/SeqlockSlot.h"
+#include "handlers/common/SpscRing.h"
+#include "As5047uAngleTracker.h"
+#include "As5047uFrame.h"
 
 //======================================================//
 // AS5047U SPI BRIDGE ADAPTER
 //======================================================//
 
+/**
+ * @brief Lifecycle of a queued SPI transaction.
+ */
+enum class As5047uTransactionState : uint8_t {
+    Idle,      ///< Not submitted (or reset for reuse)
+    Queued,    ///< Owned by the adapter's queue; do not touch the buffers
+    Done,      ///< All frames transferred
+    Failed     ///< A frame failed or timed out, or the queue was stopped
+};
+
+struct As5047uSpiTransaction;
+
+/**
+ * @brief Completion callback, run on the queue task before the state leaves Queued.
+ * Keep it short and do not call back into As5047uHandler from it.
+ */
+using As5047uSpiCompletion = InlineCallback<void(As5047uSpiTransaction&)>;
+
+/**
+ * @brief Prepared batch of AS5047U frames for As5047uSpiAdapter::Submit().
+ *
+ * Each row is one chip-select cycle. Rows are word aligned and padded to
+ * 4 bytes so DMA-capable BaseSpi backends can use them in place. Build the
+ * frames once (e.g. with PrepareRead()) and resubmit the same transaction
+ * every cycle.
+ */
+struct As5047uSpiTransaction {
+    /** @brief Most frames in one transaction (a full pipelined read). */
+    static constexpr size_t kMaxFrames = As5047uFrameCodec::kMaxPipelineRegisters + 1;
+
+    alignas(4) uint8_t tx[kMaxFrames][As5047uFrameCodec::kMaxFrameBytes]{};  ///< Frames to send
+    alignas(4) uint8_t rx[kMaxFrames][As5047uFrameCodec::kMaxFrameBytes]{};  ///< Received frames
+    uint8_t frame_bytes = 0;                    ///< Bytes per frame (FrameBytes(format))
+    uint8_t frame_count = 0;                    ///< Frames to transfer
+    uint8_t frames_done = 0;                    ///< Frames transferred successfully
+    uint32_t timeout_ms = 0;                    ///< Per-frame timeout (0 = adapter default)
+    hf_spi_err_t result = hf_spi_err_t::SPI_SUCCESS;  ///< First failing frame's error
+    As5047uSpiCompletion on_complete;           ///< Optional completion callback
+    SignalSemaphore* done_signal = nullptr;     ///< Optional, signalled after the state leaves Queued
+    std::atomic<As5047uTransactionState> state{As5047uTransactionState::Idle};  ///< Written by the queue
+
+    /**
+     * @brief Fill the frames for a pipelined read of @p count registers (count + 1 frames).
+     * @return false if @p count is out of range or the transaction is queued
+     */
+    bool PrepareRead(FrameFormat format, const uint16_t* registers, size_t count) noexcept {
+        if (state.load(std::memory_order_acquire) == As5047uTransactionState::Queued) {
+            return false;
+        }
+        const size_t frames = As5047uFrameCodec::BuildPipelineFrames(format, registers, count, tx);
+        frame_bytes = static_cast<uint8_t>(As5047uFrameCodec::FrameBytes(format));
+        frame_count = static_cast<uint8_t>(frames);
+        return frames != 0;
+    }
+
+    /**
+     * @brief Copy the frames of a compile-time register set (see As5047uFrameCodec::PrecomputeRead()).
+     * @return false if the transaction is queued
+     */
+    template <size_t N>
+    bool PrepareRead(FrameFormat format, const As5047uPrecomputedRead<N>& read) noexcept {
+        static_assert(As5047uPrecomputedRead<N>::kFrames <= kMaxFrames, "register set too large for a transaction");
+        if (state.load(std::memory_order_acquire) == As5047uTransactionState::Queued) {
+            return false;
+        }
+        const auto& frames = read.For(format);
+        std::memcpy(tx, frames.data(), sizeof(frames));
+        frame_bytes = static_cast<uint8_t>(As5047uFrameCodec::FrameBytes(format));
+        frame_count = static_cast<uint8_t>(As5047uPrecomputedRead<N>::kFrames);
+        return true;
+    }
+
+    /** @brief Whether the queue has finished with the transaction (Done or Failed). */
+    bool IsComplete() const noexcept {
+        const auto s = state.load(std::memory_order_acquire);
+        return s == As5047uTransactionState::Done || s == As5047uTransactionState::Failed;
+    }
+};
+
+class As5047uSpiAdapter;
+
+/**
+ * @brief Task draining As5047uSpiAdapter's transaction queue.
+ *
+ * While a frame is on the bus the task blocks inside BaseSpi::Transfer(),
+ * so the submitting task keeps the CPU (e.g. for FOC math on the same core).
+ */
+class As5047uSpiQueueTask : public BaseThread {
+public:
+    /** @brief Task stack size in bytes. */
+    static constexpr uint32_t kStackSize = 3072;
+
+    /** @brief Idle wake-up period (queue re-check without a signal). */
+    static constexpr uint32_t kIdleWaitMs = 100;
+
+    As5047uSpiQueueTask(As5047uSpiAdapter& adapter, uint32_t priority) noexcept;
+    ~As5047uSpiQueueTask() noexcept override = default;
+
+    As5047uSpiQueueTask(const As5047uSpiQueueTask&) = delete;
+    As5047uSpiQueueTask& operator=(const As5047uSpiQueueTask&) = delete;
+
+    /** @brief Wake the task (called by Submit()). */
+    void Wake() noexcept { wake_.Signal(); }
+
+protected:
+    bool Initialize() noexcept override;
+    bool Setup() noexcept override;
+    uint32_t Step() noexcept override;
+    bool Cleanup() noexcept override;
+    bool ResetVariables() noexcept override;
+
+private:
+    As5047uSpiAdapter& adapter_;
+    const uint32_t priority_;
+    SignalSemaphore wake_;
+    uint8_t stack_[kStackSize];
+};
+
 /**
  * @brief CRTP adapter connecting BaseSpi interface to AS5047U SpiInterface.
  * 
  * This adapter implements the as5047u::SpiInterface<As5047uSpiAdapter> CRTP interface
  * using a HardFOC BaseSpi implementation, enabling the AS5047U driver to work with
  * any SPI controller that inherits from BaseSpi.
+ *
+ * Besides the blocking transfer() used by the driver, the adapter can run a
+ * transaction queue (StartQueue()/Submit()): prepared frame batches are
+ * transferred by a dedicated task and completed through a callback.
+ *
+ * Every frame is bounded by a per-frame timeout. Failed frames are counted
+ * (GetErrorCount()), and their receive buffer is filled with 0xFF so the
+ * response fails CRC (24/32-bit) or carries the error bit (16-bit).
  * 
- * Thread Safety: This adapter is thread-safe when the underlying BaseSpi
- * implementation is thread-safe.
+ * Thread Safety: transfer() and queued transactions are serialized on an
+ * internal bus mutex, so a queued batch is never split by other frames.
+ * Callers that need several transfer() calls back to back hold a BusGuard.
+ * Submit() must be called from one task at a time.
  */
 class As5047uSpiAdapter : public as5047u::SpiInterface<As5047uSpiAdapter> {
 public:
+    /** @brief Default per-frame timeout in milliseconds. */
+    static constexpr uint32_t kDefaultTimeoutMs = 5;
+
+    /** @brief Transactions the queue holds. */
+    static constexpr uint32_t kQueueDepth = 8;
+
+    /** @brief Time StopQueue() waits for the queue task to exit. */
+    static constexpr uint32_t kQueueStopTimeoutMs = 200;
+
     /**
      * @brief Construct SPI adapter with BaseSpi interface
      * @param spi_interface Reference to BaseSpi implementation
+     * @param timeout_ms Per-frame BaseSpi timeout
      */
-    explicit As5047uSpiAdapter(BaseSpi& spi_interface) noexcept;
+    explicit As5047uSpiAdapter(BaseSpi& spi_interface, uint32_t timeout_ms = kDefaultTimeoutMs) noexcept;
+
+    /** @brief Destructor. Stops the queue task and fails unfinished transactions. */
+    ~As5047uSpiAdapter() noexcept;
+
+    As5047uSpiAdapter(const As5047uSpiAdapter&) = delete;
+    As5047uSpiAdapter& operator=(const As5047uSpiAdapter&) = delete;
 
     /**
      * @brief Perform full-duplex SPI transfer (CRTP dispatch target)
@@ -71,8 +225,108 @@ public:
      */
     void transfer(const uint8_t* tx, uint8_t* rx, std::size_t len) noexcept;
 
+    /**
+     * @brief Transfer one frame and report whether it directly follows the caller's previous frame.
+     *
+     * The frame-count check and the transfer run under the bus mutex, so
+     * neither transfer() nor a queued transaction can land between them.
+     *
+     * @param tx Transmit buffer
+     * @param rx Receive buffer
+     * @param len Number of bytes to transfer
+     * @param transfer_count In: GetTransferCount() after the caller's previous frame;
+     *                       out: GetTransferCount() after this frame
+     * @param chained Set if no other frame was transferred in between
+     * @return BaseSpi result of the frame
+     */
+    hf_spi_err_t TransferChained(const uint8_t* tx, uint8_t* rx, std::size_t len,
+                                 uint32_t& transfer_count, bool& chained) noexcept;
+
+    /**
+     * @brief Holds the bus across several transfer() calls.
+     *
+     * Multi-frame exchanges (a pipelined chain, or a driver register access
+     * whose result comes back in the next frame) must not be split by a
+     * queued transaction: each frame would still pass its CRC, but return
+     * the result of the wrong command. The bus mutex is recursive, so
+     * transfer() may be called while the guard is held.
+     */
+    class BusGuard {
+    public:
+        explicit BusGuard(As5047uSpiAdapter& adapter) noexcept : lock_(adapter.bus_mutex_) {}
+        BusGuard(const BusGuard&) = delete;
+        BusGuard& operator=(const BusGuard&) = delete;
+
+    private:
+        MutexLockGuard lock_;
+    };
+
+    /**
+     * @brief Start the transaction queue task.
+     * @param priority Task priority
+     * @return true if the task runs (also if it already did)
+     */
+    bool StartQueue(uint32_t priority) noexcept;
+
+    /**
+     * @brief Stop the queue task; still-queued transactions complete as Failed.
+     * @return false if the task did not exit in time
+     */
+    bool StopQueue() noexcept;
+
+    /** @brief Whether the queue task is running. */
+    bool IsQueueRunning() const noexcept { return queue_task_ != nullptr; }
+
+    /**
+     * @brief Queue a prepared transaction (returns immediately).
+     *
+     * The transaction must stay alive and untouched until IsComplete().
+     *
+     * @param transaction Prepared frames
+     * @return false if the queue is not running or full, or the transaction is
+     *         empty or already queued
+     */
+    bool Submit(As5047uSpiTransaction& transaction) noexcept;
+
+    /** @brief Set the per-frame timeout for subsequent frames. */
+    void SetTimeoutMs(uint32_t timeout_ms) noexcept { timeout_ms_.store(timeout_ms, std::memory_order_relaxed); }
+
+    /** @brief Per-frame timeout in milliseconds. */
+    uint32_t GetTimeoutMs() const noexcept { return timeout_ms_.load(std::memory_order_relaxed); }
+
+    /** @brief Number of frames transferred since construction. */
+    uint32_t GetTransferCount() const noexcept { return transfer_count_.load(std::memory_order_relaxed); }
+
+    /** @brief Frames whose BaseSpi transfer failed or timed out. */
+    uint32_t GetErrorCount() const noexcept { return error_count_.load(std::memory_order_relaxed); }
+
+    /** @brief Result of the most recent failed frame. */
+    hf_spi_err_t GetLastResult() const noexcept { return last_result_.load(std::memory_order_relaxed); }
+
 private:
+    friend class As5047uSpiQueueTask;
+
+    /** @brief One chip-selected frame with timeout and error accounting (bus mutex held). */
+    hf_spi_err_t TransferFrameLocked(const uint8_t* tx, uint8_t* rx, std::size_t len,
+                                     uint32_t timeout_ms) noexcept;
+
+    /** @brief Run every queued transaction (queue task). */
+    void DrainQueue() noexcept;
+
+    /** @brief Transfer all frames of @p transaction and complete it (queue task). */
+    void RunTransaction(As5047uSpiTransaction& transaction) noexcept;
+
+    /** @brief Complete @p transaction: callback, then publish the final state. */
+    static void Complete(As5047uSpiTransaction& transaction) noexcept;
+
     BaseSpi& spi_interface_;
+    RtosMutex bus_mutex_;                                    ///< Serializes frames and batches
+    std::atomic<uint32_t> timeout_ms_;                       ///< Per-frame timeout
+    std::atomic<uint32_t> transfer_count_{0};                ///< Frames transferred
+    std::atomic<uint32_t> error_count_{0};                   ///< Failed frames
+    std::atomic<hf_spi_err_t> last_result_{hf_spi_err_t::SPI_SUCCESS};  ///< Last failure
+    SpscRing<As5047uSpiTransaction*> queue_;                 ///< Submitted transactions
+    std::unique_ptr<As5047uSpiQueueTask> queue_task_;        ///< Queue worker
 };
 
 //======================================================//
@@ -105,8 +359,10 @@ struct As5047uDiagnostics {
     bool offset_compensation_ok;     ///< Offset compensation completed
     bool communication_ok;           ///< SPI communication working
     uint16_t last_error_flags;       ///< Last error flags read
-    uint32_t communication_errors;   ///< Count of communication errors
+    uint32_t communication_errors;   ///< Count of communication errors (CRC and SPI failures)
     uint32_t total_measurements;     ///< Total measurements taken
+    uint32_t spi_frames;             ///< SPI frames clocked through the adapter
+    uint32_t spi_errors;             ///< Frames whose BaseSpi transfer failed or timed out
 };
 
 /**
@@ -124,6 +380,95 @@ struct As5047uConfig {
     uint8_t abi_resolution_bits;     ///< ABI resolution in bits (10-14)
     uint8_t uvw_pole_pairs;          ///< UVW pole pairs (1-7)
     bool high_temperature_mode;      ///< Enable 150°C operation mode
+    uint32_t spi_timeout_ms;         ///< Per-frame BaseSpi timeout in milliseconds
+};
+
+/**
+ * @brief Streaming mode configuration (see As5047uHandler::StartStreaming()).
+ *
+ * With run_task the sampling task busy-waits for burst_ms, then sleeps for
+ * yield_ms, so it uses burst_ms / (burst_ms + yield_ms) of its core and
+ * samples at that fraction of sample_rate_hz. yield_ms must be non-zero:
+ * without it the task never blocks and starves the IDLE task (and anything
+ * else at or below its priority) on its core, which trips the task watchdog.
+ * For a gap-free stream, pin the task to a core reserved for it (core_id),
+ * or set run_task = false and call PollStream() from the control loop.
+ */
+struct As5047uStreamConfig {
+    uint32_t sample_rate_hz{10000};       ///< Angle samples per second (100-20000)
+    float observer_bandwidth_hz{150.0f};  ///< PLL natural frequency (at most sample_rate_hz / 10)
+    float observer_damping{1.0f};         ///< PLL damping ratio (1.0 = critically damped)
+    bool run_task{true};                  ///< false: the caller drives PollStream() at sample_rate_hz
+    uint32_t priority{10};                ///< Sampling task priority
+    uint32_t burst_ms{4};                 ///< Sampling time per task step (handler lock held)
+    uint32_t yield_ms{1};                 ///< Task delay between bursts (> 0; samples missed meanwhile)
+    int32_t core_id{-1};                  ///< Core to pin the sampling task to (-1 = any core)
+};
+
+/**
+ * @brief One streamed sample, published wait-free by the sampling loop.
+ */
+struct As5047uStreamSample {
+    uint64_t timestamp_us;           ///< Time the angle read was clocked out
+    int64_t position_counts;         ///< Measured multi-turn position (turns * 16384 + angle)
+    int32_t turns;                   ///< Whole turns of the measured position
+    uint16_t angle;                  ///< Latest compensated angle (0-16383 LSB)
+    bool sensor_error;               ///< Error bit set in the response (read ERRFL for details)
+    float estimated_angle_rad;       ///< Observer angle within the turn [0, 2pi)
+    float velocity_rad_per_sec;      ///< Observer velocity in radians per second
+    float velocity_rpm;              ///< Observer velocity in revolutions per minute
+    float tracking_error_counts;     ///< Observer innovation (measured - predicted)
+    uint32_t sequence;               ///< Accepted samples since StartStreaming()
+};
+
+/**
+ * @brief Streaming throughput and error counters.
+ */
+struct As5047uStreamStats {
+    bool active;                     ///< Streaming mode engaged
+    bool task_running;               ///< Handler-owned sampling task in use
+    uint32_t sample_rate_hz;         ///< Configured rate
+    uint32_t samples;                ///< Samples accepted since StartStreaming()
+    uint32_t frames;                 ///< SPI frames clocked by the stream
+    uint32_t crc_errors;             ///< Responses rejected by CRC
+    uint32_t spi_errors;             ///< Frames whose BaseSpi transfer failed or timed out
+    uint32_t error_frames;           ///< Responses with the error bit set
+    uint32_t resyncs;                ///< Responses discarded after other traffic broke the frame chain
+    uint32_t overruns;               ///< Sample deadlines missed by the sampling task
+    uint32_t max_late_us;            ///< Worst sample start delay after its deadline
+    float samples_per_second;        ///< Sustained rate since the first sample
+};
+
+class As5047uHandler;
+
+/**
+ * @brief Sampling task owned by As5047uHandler (see As5047uHandler::StartStreaming()).
+ *
+ * Each step runs one sampling burst through the handler and then yields for
+ * As5047uStreamConfig::yield_ms.
+ */
+class As5047uStreamTask : public BaseThread {
+public:
+    /** @brief Task stack size in bytes. */
+    static constexpr uint32_t kStackSize = 3072;
+
+    As5047uStreamTask(As5047uHandler& handler, const As5047uStreamConfig& config) noexcept;
+    ~As5047uStreamTask() noexcept override = default;
+
+    As5047uStreamTask(const As5047uStreamTask&) = delete;
+    As5047uStreamTask& operator=(const As5047uStreamTask&) = delete;
+
+protected:
+    bool Initialize() noexcept override;
+    bool Setup() noexcept override;
+    uint32_t Step() noexcept override;
+    bool Cleanup() noexcept override;
+    bool ResetVariables() noexcept override;
+
+private:
+    As5047uHandler& handler_;
+    const As5047uStreamConfig config_;
+    uint8_t stack_[kStackSize];
 };
 
 //======================================================//
@@ -162,9 +507,9 @@ public:
                            const As5047uConfig& config = GetDefaultConfig()) noexcept;
 
     /**
-     * @brief Destructor - automatically handles cleanup
+     * @brief Destructor - stops streaming and the SPI queue; other resources are released automatically
      */
-    ~As5047uHandler() noexcept = default;
+    ~As5047uHandler() noexcept;
 
     // Disable copy construction and assignment
     As5047uHandler(const As5047uHandler&) = delete;
@@ -216,7 +561,8 @@ public:
      * @return Pointer to AS5047U driver or nullptr if not initialized
      *
      * @warning Raw pointer — NOT mutex-protected. Caller is responsible for
-     *          external synchronization in multi-task environments.
+     *          external synchronization in multi-task environments, and must
+     *          hold an As5047uSpiAdapter::BusGuard while the SPI queue runs.
      *          Prefer visitDriver() for thread-safe access.
      * 
      * Note: Caller must not delete the returned pointer; lifetime is owned by the handler.
@@ -232,6 +578,10 @@ public:
 
     /**
      * @brief Visit the underlying AS5047U driver under handler mutex protection.
+     *
+     * The SPI bus is held for the whole call, so queued transactions cannot
+     * land between the frames of a driver register access.
+     *
      * @return Callable result or default-constructed value when driver is unavailable.
      */
     template <typename Fn>
@@ -245,9 +595,189 @@ public:
                 return ReturnType{};
             }
         }
+        As5047uSpiAdapter::BusGuard bus(*spi_adapter_);
         return fn(*as5047u_sensor_);
     }
 
+    //======================================================//
+    // MEASUREMENT
+    //======================================================//
+
+    /**
+     * @brief Read angle, compensated angle, velocity, AGC, magnitude and error flags.
+     *
+     * The six registers are read as one pipelined chain of seven SPI frames
+     * with the bus held throughout (each frame returns the previous command's
+     * result), so queued transactions run before or after the chain, never
+     * inside it.
+     * In 24/32-bit frame formats every result is CRC-checked and the whole
+     * chain is retried up to As5047uConfig::crc_retries times; CRC failures
+     * count as communication errors. Reading ERRFL clears the sensor's flags.
+     *
+     * @param measurement Output; @c valid is false on failure
+     * @return true if a consistent measurement was read
+     */
+    bool ReadMeasurement(As5047uMeasurement& measurement) noexcept;
+
+    /**
+     * @brief Get a copy of the cached diagnostics.
+     * @return Diagnostics including error counters and SPI frame count
+     */
+    As5047uDiagnostics GetDiagnostics() const noexcept;
+
+    /** @brief Velocity register scale (degrees per second per LSB). */
+    static constexpr float kVelocityDegPerSecPerLsb = 24.141f;
+
+    /** @brief SPI frames one ReadMeasurement() attempt takes (6 registers + 1). */
+    static constexpr uint32_t kMeasurementFrames = 7;
+
+    //======================================================//
+    // QUEUED SPI
+    //======================================================//
+
+    /**
+     * @brief Start the adapter's transaction queue task.
+     *
+     * Queued transactions run on their own task, which blocks in BaseSpi while
+     * frames are on the bus. The submitting task can compute meanwhile, e.g.
+     * BeginReadMeasurement(), then the FOC math, then FinishReadMeasurement().
+     *
+     * @param priority Queue task priority (above the submitting task)
+     * @return true if the queue runs
+     */
+    bool StartSpiQueue(uint32_t priority = kDefaultSpiQueuePriority) noexcept;
+
+    /**
+     * @brief Stop the queue task; unfinished transactions complete as Failed.
+     * @return true if successful (also when not running)
+     */
+    bool StopSpiQueue() noexcept;
+
+    /**
+     * @brief Queue a caller-prepared transaction (see As5047uSpiTransaction::PrepareRead()).
+     * @param transaction Must stay alive and untouched until IsComplete()
+     * @return false if the queue is not running or rejects the transaction
+     */
+    bool SubmitTransaction(As5047uSpiTransaction& transaction) noexcept;
+
+    /**
+     * @brief Queue the ReadMeasurement() frame chain and return immediately.
+     *
+     * Pair each call with FinishReadMeasurement() from the same task.
+     *
+     * @param on_complete Optional callback, run on the queue task when the frames are done
+     * @return false if the queue is not running or a measurement is still pending
+     */
+    bool BeginReadMeasurement(As5047uSpiCompletion on_complete = nullptr) noexcept;
+
+    /**
+     * @brief Wait for the queued measurement and decode it.
+     *
+     * Unlike ReadMeasurement() there is no retry: a CRC or SPI failure returns
+     * false (and is counted), and the caller may begin a new read.
+     *
+     * Spins for up to kMeasurementSpinUs, which covers the frames when the
+     * queue task outranks the caller, then blocks until the queue task signals
+     * completion. The queue task may therefore run at a lower priority on the
+     * same core; it just adds a context switch to the wait.
+     *
+     * @param measurement Output; @c valid is false on failure
+     * @param timeout_us Longest wait for the queue to finish the frames
+     * @return true if a consistent measurement was read
+     */
+    bool FinishReadMeasurement(As5047uMeasurement& measurement,
+                               uint32_t timeout_us = kDefaultMeasurementWaitUs) noexcept;
+
+    /** @brief Default queue task priority. */
+    static constexpr uint32_t kDefaultSpiQueuePriority = 12;
+
+    /** @brief Default FinishReadMeasurement() wait. */
+    static constexpr uint32_t kDefaultMeasurementWaitUs = 2000;
+
+    /** @brief FinishReadMeasurement() busy-wait before it blocks. */
+    static constexpr uint32_t kMeasurementSpinUs = 50;
+
+    //======================================================//
+    // STREAMING
+    //======================================================//
+
+    /**
+     * @brief Start high-rate angle streaming.
+     *
+     * Every sample is a single SPI frame: the stream keeps re-issuing an
+     * ANGLECOM read, and each frame clocks out the angle requested by the
+     * previous one. Samples feed an As5047uAngleTracker (multi-turn count and
+     * PLL velocity observer) and are published through a seqlock, so
+     * GetLatestSample() never blocks on the sampling loop.
+     *
+     * With config.run_task the handler runs an As5047uStreamTask. RTOS ticks
+     * are too coarse for 10-20 kHz, so the task busy-waits on the microsecond
+     * clock for config.burst_ms at a time while holding the handler lock, then
+     * sleeps for config.yield_ms. config.core_id pins it to a core; this needs
+     * an RTOS that can change a running task's affinity (ESP-IDF with
+     * CONFIG_FREERTOS_SMP). Otherwise call PollStream() from an existing
+     * control loop at config.sample_rate_hz.
+     *
+     * Other handler calls remain available while streaming, including queued
+     * transactions; they break the frame chain, and the stream discards one
+     * response to resynchronise (see As5047uSpiAdapter::TransferChained()).
+     *
+     * @param config Rate, observer and task settings
+     * @return false if the configuration is invalid (including run_task with
+     *         yield_ms == 0, or a core_id that cannot be honoured), streaming
+     *         is already active, or the sensor / task could not be started
+     */
+    bool StartStreaming(const As5047uStreamConfig& config = As5047uStreamConfig{}) noexcept;
+
+    /**
+     * @brief Stop streaming and the sampling task (waits for it to exit).
+     * @return true if successful (also when not streaming)
+     */
+    bool StopStreaming() noexcept;
+
+    /** @brief Check whether streaming mode is active. */
+    bool IsStreaming() const noexcept;
+
+    /**
+     * @brief Take up to @p max_samples stream samples now (manual pacing).
+     * @param max_samples Frames to clock
+     * @return Number of samples accepted (0 when not streaming)
+     */
+    uint8_t PollStream(uint8_t max_samples = 1) noexcept;
+
+    /**
+     * @brief Copy the most recent stream sample without locking.
+     * @param sample Output sample
+     * @return true if a sample has been published
+     */
+    bool GetLatestSample(As5047uStreamSample& sample) const noexcept;
+
+    /**
+     * @brief Restart the multi-turn counter at @p turns for the current angle.
+     * @param turns Turn count to assign
+     * @return false when not streaming or before the first sample
+     */
+    bool SetStreamTurns(int32_t turns = 0) noexcept;
+
+    /**
+     * @brief Get streaming throughput and error counters.
+     * @param stats Output statistics
+     * @return true always
+     */
+    bool GetStreamStats(As5047uStreamStats& stats) const noexcept;
+
+    /** @brief Highest supported stream sample rate. */
+    static constexpr uint32_t kMaxStreamRateHz = 20000;
+
+    /** @brief Lowest supported stream sample rate. */
+    static constexpr uint32_t kMinStreamRateHz = 100;
+
+    /** @brief Whether As5047uStreamConfig::core_id can pin the sampling task on this platform. */
+    static bool IsStreamCorePinningSupported() noexcept;
+
+    /** @brief Time StopStreaming() waits for the sampling task to exit. */
+    static constexpr uint32_t kStreamTaskStopTimeoutMs = 200;
+
     //======================================================//
     // UTILITY METHODS
     //======================================================//
@@ -291,6 +821,26 @@ private:
     mutable As5047uDiagnostics diagnostics_;         ///< Cached diagnostics
     char description_[64];                           ///< Sensor description
 
+    // Streaming state (handler_mutex_ held, except the slot's readers)
+    std::unique_ptr<As5047uStreamTask> stream_task_; ///< Sampling task (run_task mode)
+    As5047uStreamConfig stream_config_{};            ///< Active stream configuration
+    bool streaming_ = false;                         ///< Streaming mode engaged
+    bool stream_chained_ = false;                    ///< Previous frame was our ANGLECOM read
+    uint8_t stream_tx_[As5047uFrameCodec::kMaxFrameBytes]{}; ///< Prebuilt ANGLECOM read frame
+    uint8_t stream_frame_len_ = 0;                   ///< Bytes per stream frame
+    uint32_t stream_transfers_ = 0;                  ///< Adapter frame count after our last frame
+    uint32_t stream_period_us_ = 0;                  ///< Sample period
+    uint64_t stream_command_us_ = 0;                 ///< Time the pending angle read was clocked
+    uint64_t stream_next_deadline_us_ = 0;           ///< Next sampling task deadline (0 = not scheduled)
+    uint64_t stream_first_sample_us_ = 0;            ///< First accepted sample
+    uint64_t stream_last_sample_us_ = 0;             ///< Latest accepted sample (0 = none)
+    As5047uAngleTracker tracker_;                    ///< Multi-turn count and velocity observer
+    As5047uStreamStats stream_stats_{};              ///< Stream counters
+    SeqlockSlot<As5047uStreamSample> stream_slot_;   ///< Latest sample (lock-free readers)
+
+    As5047uSpiTransaction measurement_txn_;          ///< Prepared ReadMeasurement() chain (queued SPI)
+    SignalSemaphore measurement_done_;               ///< Signalled by the queue when measurement_txn_ completes
+
     //======================================================//
     // PRIVATE HELPER METHODS
     //======================================================//
@@ -318,6 +868,30 @@ private:
      */
     void UpdateDiagnostics() noexcept;
 
+    /**
+     * @brief ReadMeasurement() body (mutex held, driver ready).
+     */
+    bool ReadMeasurementLocked(As5047uMeasurement& measurement) noexcept;
+
+    /**
+     * @brief Fill @p measurement from the register values of a measurement chain (mutex held).
+     */
+    void DecodeMeasurementLocked(const uint16_t* values, As5047uMeasurement& measurement) noexcept;
+
+    friend class As5047uStreamTask;
+
+    /**
+     * @brief One sampling task burst: deadline-paced samples for burst_ms (takes the mutex).
+     */
+    void RunStreamBurst() noexcept;
+
+    /**
+     * @brief Clock one stream frame and publish its sample (mutex held, streaming).
+     * @param now_us Current time
+     * @return true if a sample was accepted
+     */
+    bool SampleStreamLocked(uint64_t now_us) noexcept;
+
     /**
      * @brief Apply configuration to sensor
      * @param config Configuration to apply
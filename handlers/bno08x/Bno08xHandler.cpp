@@ -11,6 +11,9 @@
  * - Sensor enable/disable with configurable intervals
  * - Hardware control (reset, boot, wake pins)
  * - Thread-safe operations with recursive mutex
+ * - Seqlock latest-sample store for mutex-free readers
+ * - INT-driven service task with a cached INT edge for the comm adapters
+ * - Lock-free per-sensor report rings
  * - Comprehensive diagnostics
  *
  * @author HardFOC Team
@@ -30,6 +33,44 @@ extern "C" {
 #include "core/hf-core-drivers/external/hf-bno08x-driver/src/sh2/sh2_err.h"
 }
 
+static constexpr const char* TAG = "Bno08xHandler";
+
+/**
+ * Branch-free atan2 for the fast Euler path: octant reduction plus an
+ * 11th-order odd minimax polynomial for atan on [0, 1] (|error| < 2e-6 rad).
+ */
+static inline float fastAtan2(float y, float x) noexcept {
+    const float ax = std::fabs(x);
+    const float ay = std::fabs(y);
+    const float hi = ax > ay ? ax : ay;
+    const float lo = ax > ay ? ay : ax;
+    const float a = lo / (hi > 0.0f ? hi : 1.0f);
+    const float s = a * a;
+    float r = (((((-0.0117212f * s + 0.05265332f) * s - 0.11643287f) * s + 0.19354346f) * s
+                - 0.33262347f) * s + 0.99997726f) * a;
+    r = ay > ax ? 1.57079637f - r : r;
+    r = x < 0.0f ? 3.14159274f - r : r;
+    return y < 0.0f ? -r : r;
+}
+
+/// Fast Euler conversion of one quaternion; the per-lane body of the batch path.
+static inline void fastEuler(float w, float x, float y, float z,
+                             float& roll, float& pitch, float& yaw) noexcept {
+    roll = fastAtan2(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y));
+
+    float sinp = 2.0f * (w * y - z * x);
+    sinp = sinp > 1.0f ? 1.0f : (sinp < -1.0f ? -1.0f : sinp);
+    const float cos2p = 1.0f - sinp * sinp;
+    pitch = fastAtan2(sinp, std::sqrt(cos2p > 0.0f ? cos2p : 0.0f));
+
+    yaw = fastAtan2(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z));
+}
+
+/// True while the service task's INT interrupt keeps the edge latch current.
+static bool intLatchArmed(const Bno08xIntLatch* latch) noexcept {
+    return latch != nullptr && latch->armed.load(std::memory_order_acquire);
+}
+
 // ============================================================================
 //  I2C CRTP ADAPTER IMPLEMENTATION
 // ============================================================================
@@ -74,8 +115,9 @@ int HalI2cBno08xComm::Write(const uint8_t* data, uint32_t length) noexcept {
 int HalI2cBno08xComm::Read(uint8_t* data, uint32_t length) noexcept {
     if (!data || length == 0) return -1;
 
-    // Check INT pin first if available (configured active-low: IsActive() = data ready)
-    if (int_gpio_) {
+    // Check INT pin first if available (configured active-low: IsActive() = data ready).
+    // With the latch armed, DataAvailable() already consumed the edge for this transfer.
+    if (int_gpio_ && !intLatchArmed(int_latch_)) {
         bool is_active = false;
         if (int_gpio_->IsActive(is_active) == hf_gpio_err_t::GPIO_SUCCESS) {
             if (!is_active) {
@@ -92,6 +134,11 @@ int HalI2cBno08xComm::Read(uint8_t* data, uint32_t length) noexcept {
 }
 
 bool HalI2cBno08xComm::DataAvailable() noexcept {
+    // Interrupt armed: consume the cached edge instead of sampling the pin
+    if (intLatchArmed(int_latch_)) {
+        return int_latch_->pending.exchange(false, std::memory_order_acq_rel);
+    }
+
     if (!int_gpio_) return true;  // Assume data available if no INT pin
 
     // INT is active-low, configured as such: IsActive() = data available
@@ -181,8 +228,8 @@ int HalSpiBno08xComm::Write(const uint8_t* data, uint32_t length) noexcept {
 int HalSpiBno08xComm::Read(uint8_t* data, uint32_t length) noexcept {
     if (!data || length == 0) return -1;
 
-    // Check INT pin first if available
-    if (int_gpio_) {
+    // Check INT pin first if available (skipped while the edge latch is armed)
+    if (int_gpio_ && !intLatchArmed(int_latch_)) {
         bool is_active = false;
         if (int_gpio_->IsActive(is_active) == hf_gpio_err_t::GPIO_SUCCESS) {
             if (!is_active) {
@@ -199,6 +246,10 @@ int HalSpiBno08xComm::Read(uint8_t* data, uint32_t length) noexcept {
 }
 
 bool HalSpiBno08xComm::DataAvailable() noexcept {
+    if (intLatchArmed(int_latch_)) {
+        return int_latch_->pending.exchange(false, std::memory_order_acq_rel);
+    }
+
     if (!int_gpio_) return true;
 
     bool is_active = false;
@@ -252,10 +303,11 @@ Bno08xHandler::Bno08xHandler(BaseI2c& i2c_device,
                              const Bno08xConfig& config,
                              BaseGpio* reset_gpio,
                              BaseGpio* int_gpio) noexcept
-    : driver_ops_(std::make_unique<Bno08xDriverImpl<HalI2cBno08xComm>>(
-          HalI2cBno08xComm(i2c_device, reset_gpio, int_gpio)))
+    : driver_(std::in_place_type<Bno08xDriver::I2cDriver>,
+              HalI2cBno08xComm(i2c_device, reset_gpio, int_gpio, &int_latch_))
     , config_(config)
-    , interface_type_(BNO085Interface::I2C) {
+    , interface_type_(BNO085Interface::I2C)
+    , int_gpio_(int_gpio) {
     std::snprintf(description_, sizeof(description_),
                   "BNO08x IMU (I2C @0x%02X)",
                   static_cast<unsigned>(i2c_device.GetDeviceAddress()));
@@ -266,14 +318,19 @@ Bno08xHandler::Bno08xHandler(BaseSpi& spi_device,
                              BaseGpio* reset_gpio,
                              BaseGpio* int_gpio,
                              BaseGpio* wake_gpio) noexcept
-    : driver_ops_(std::make_unique<Bno08xDriverImpl<HalSpiBno08xComm>>(
-          HalSpiBno08xComm(spi_device, reset_gpio, int_gpio, wake_gpio)))
+    : driver_(std::in_place_type<Bno08xDriver::SpiDriver>,
+              HalSpiBno08xComm(spi_device, reset_gpio, int_gpio, wake_gpio, &int_latch_))
     , config_(config)
-    , interface_type_(BNO085Interface::SPI) {
+    , interface_type_(BNO085Interface::SPI)
+    , int_gpio_(int_gpio) {
     std::snprintf(description_, sizeof(description_),
                   "BNO08x IMU (SPI)");
 }
 
+Bno08xHandler::~Bno08xHandler() noexcept {
+    StopServiceTask();
+}
+
 // --- Initialization ---
 
 Bno08xError Bno08xHandler::Initialize() noexcept {
@@ -288,27 +345,24 @@ Bno08xError Bno08xHandler::Initialize() noexcept {
         return last_error_;
     }
 
-    if (!driver_ops_) {
-        last_error_ = Bno08xError::INITIALIZATION_FAILED;
-        return last_error_;
-    }
-
     // Perform hardware reset via the driver (uses RSTN pin if wired)
-    driver_ops_->HardwareReset(10);
+    driver_.HardwareReset(10);
 
     // Initialize the SH-2 protocol
-    if (!driver_ops_->Begin()) {
+    if (!driver_.Begin()) {
         last_error_ = Bno08xError::SENSOR_NOT_RESPONDING;
         return last_error_;
     }
 
-    // Set internal callback that forwards to user callback
-    driver_ops_->SetCallback([this](const SensorEvent& event) {
-        // Forward to user callback (no extra lock needed - called from Update()
-        // which already holds the mutex, and the recursive mutex allows re-entry)
-        if (user_callback_) {
-            user_callback_(event);
-        }
+    // Rings must exist before the first report can be pushed
+    allocateReportRingsLocked();
+
+    // Set internal callback that forwards to user callback. Capturing only
+    // `this` keeps it within the driver's std::function small buffer.
+    driver_.SetCallback([this](const SensorEvent& event) {
+        // Called from Update(), which already holds the mutex (the recursive
+        // mutex allows re-entry).
+        dispatchEventLocked(event);
     });
 
     if (!applyConfigLocked()) {
@@ -331,6 +385,9 @@ bool Bno08xHandler::EnsureInitialized() noexcept {
 }
 
 Bno08xError Bno08xHandler::Deinitialize() noexcept {
+    // Outside the mutex: the task may be waiting for it.
+    StopServiceTask();
+
     MutexLockGuard lock(handler_mutex_);
     if (!lock.IsLocked()) {
         last_error_ = Bno08xError::MUTEX_LOCK_FAILED;
@@ -343,9 +400,7 @@ Bno08xError Bno08xHandler::Deinitialize() noexcept {
     }
 
     // Clear the driver callback
-    if (driver_ops_) {
-        driver_ops_->SetCallback(nullptr);
-    }
+    driver_.SetCallback(nullptr);
 
     user_callback_ = nullptr;
     initialized_ = false;
@@ -359,14 +414,10 @@ bool Bno08xHandler::IsInitialized() const noexcept {
 }
 
 bool Bno08xHandler::ensureInitializedLocked() noexcept {
-    if (initialized_ && driver_ops_) {
+    if (initialized_) {
         last_error_ = Bno08xError::SUCCESS;
         return true;
     }
-    if (!driver_ops_) {
-        last_error_ = Bno08xError::INITIALIZATION_FAILED;
-        return false;
-    }
 
     const Bno08xError init_result = Initialize();
     if (init_result == Bno08xError::SUCCESS) {
@@ -375,20 +426,16 @@ bool Bno08xHandler::ensureInitializedLocked() noexcept {
 
     // Initialize() can return a non-fatal communication error after partial
     // sensor enables while the driver itself is ready for use.
-    return initialized_ && driver_ops_;
+    return initialized_;
 }
 
 bool Bno08xHandler::applyConfigLocked() noexcept {
-    if (!driver_ops_) {
-        return false;
-    }
-
     const auto enable_if_configured =
         [this](BNO085Sensor sensor, bool enabled, uint32_t interval_ms) noexcept {
             if (!enabled) {
                 return true;
             }
-            return driver_ops_->EnableSensor(sensor, interval_ms, 0.0f);
+            return driver_.EnableSensor(sensor, interval_ms, 0.0f);
         };
 
     return enable_if_configured(BNO085Sensor::Accelerometer,
@@ -450,11 +497,28 @@ Bno08xError Bno08xHandler::Update() noexcept {
         return last_error_;
     }
 
-    // Pump the SH-2 service loop (dispatches callbacks internally)
-    driver_ops_->Update();
+    return serviceLocked(1);
+}
+
+Bno08xError Bno08xHandler::serviceLocked(uint8_t max_passes) noexcept {
+    // Pump the SH-2 service loop (dispatches callbacks internally). While the
+    // latch is armed, keep going as long as INT re-asserted during the pass.
+    uint8_t passes = 0;
+    do {
+        driver_.Update();
+        ++passes;
+    } while (passes < max_passes && int_latch_.armed.load(std::memory_order_acquire) &&
+             int_latch_.pending.load(std::memory_order_acquire));
+    service_stats_.service_passes += passes;
+
+    // One coherent snapshot per service call that decoded anything
+    if (imu_dirty_) {
+        imu_slot_.Store(imu_pending_);
+        imu_dirty_ = false;
+    }
 
     // Check for driver errors
-    int driver_error = driver_ops_->GetLastError();
+    int driver_error = driver_.GetLastError();
     if (driver_error != 0) {
         last_error_ = mapDriverError(driver_error);
     } else {
@@ -464,14 +528,199 @@ Bno08xError Bno08xHandler::Update() noexcept {
     return last_error_;
 }
 
+// ============================================================================
+//  INTERRUPT-DRIVEN SERVICE TASK
+// ============================================================================
+
+Bno08xServiceTask::Bno08xServiceTask(Bno08xHandler& handler,
+                                     const Bno08xServiceTaskConfig& config) noexcept
+    : BaseThread("Bno08xService"), handler_(handler), config_(config), wake_("Bno08xWake") {}
+
+bool Bno08xServiceTask::Initialize() noexcept {
+    return wake_.EnsureInitialized() &&
+           CreateBaseThread(stack_, sizeof(stack_), config_.priority, 5, 0, OS_AUTO_START);
+}
+
+bool Bno08xServiceTask::Setup() noexcept {
+    return true;
+}
+
+uint32_t Bno08xServiceTask::Step() noexcept {
+    // Sleep until INT fires; the timeout bounds how long a missed edge can stall us.
+    const bool signalled = wake_.WaitUntilSignalled(config_.idle_timeout_ms);
+    handler_.serviceWake(signalled, config_.max_passes_per_wake);
+    return 0;
+}
+
+bool Bno08xServiceTask::Cleanup() noexcept {
+    return true;
+}
+
+bool Bno08xServiceTask::ResetVariables() noexcept {
+    return true;
+}
+
+Bno08xError Bno08xHandler::StartServiceTask(const Bno08xServiceTaskConfig& config) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked()) {
+        last_error_ = Bno08xError::MUTEX_LOCK_FAILED;
+        return last_error_;
+    }
+
+    if (service_task_) {
+        last_error_ = Bno08xError::SUCCESS;
+        return last_error_;
+    }
+
+    if (!ensureInitializedLocked()) {
+        return last_error_;
+    }
+
+    // The ISR dereferences service_task_, so it must exist before the interrupt is armed.
+    service_task_ = std::make_unique<Bno08xServiceTask>(*this, config);
+    service_stats_ = Bno08xServiceStats{};
+    int_latch_.edges.store(0, std::memory_order_relaxed);
+
+    if (int_gpio_) {
+        // Start with a pending edge: INT may already be asserted and no edge would follow.
+        int_latch_.pending.store(true, std::memory_order_relaxed);
+        int_latch_.armed.store(true, std::memory_order_release);
+        auto result = int_gpio_->ConfigureInterrupt(
+            hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_FALLING_EDGE,
+            intEdgeCallback,
+            this);
+        if (result != hf_gpio_err_t::GPIO_SUCCESS) {
+            int_latch_.armed.store(false, std::memory_order_release);
+            Logger::GetInstance().Warn(TAG, "INT interrupt unavailable, service task polls every %lu ms",
+                                       static_cast<unsigned long>(config.idle_timeout_ms));
+        }
+    }
+
+    if (!service_task_->EnsureInitialized() || !service_task_->Start()) {
+        if (int_latch_.armed.exchange(false, std::memory_order_acq_rel)) {
+            int_gpio_->ConfigureInterrupt(hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_NONE);
+        }
+        service_task_.reset();
+        last_error_ = Bno08xError::INITIALIZATION_FAILED;
+        return last_error_;
+    }
+
+    // Drain whatever the initial pending edge stands for without waiting a timeout.
+    service_task_->Wake();
+    last_error_ = Bno08xError::SUCCESS;
+    return last_error_;
+}
+
+Bno08xError Bno08xHandler::StopServiceTask() noexcept {
+    std::unique_ptr<Bno08xServiceTask> task;
+    {
+        MutexLockGuard lock(handler_mutex_);
+        if (!lock.IsLocked()) {
+            last_error_ = Bno08xError::MUTEX_LOCK_FAILED;
+            return last_error_;
+        }
+        if (!service_task_) {
+            return Bno08xError::SUCCESS;
+        }
+        // Disarm first: once the interrupt is off nothing touches service_task_ from ISR context.
+        if (int_latch_.armed.exchange(false, std::memory_order_acq_rel)) {
+            int_gpio_->ConfigureInterrupt(hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_NONE);
+        }
+        int_latch_.pending.store(false, std::memory_order_relaxed);
+        task = std::move(service_task_);
+    }
+
+    // The task may be blocked on the handler mutex, so wait for it unlocked.
+    task->Stop();
+    task->Wake();
+    for (uint32_t waited_ms = 0; task->IsThreadRunning(); ++waited_ms) {
+        if (waited_ms >= kServiceTaskStopTimeoutMs) {
+            Logger::GetInstance().Error(TAG, "Service task did not stop");
+            // Leak rather than free a stack that may still be running.
+            (void)task.release();
+            return Bno08xError::TIMEOUT;
+        }
+        os_delay_msec(1);
+    }
+    return Bno08xError::SUCCESS;
+}
+
+bool Bno08xHandler::IsServiceTaskRunning() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return lock.IsLocked() && service_task_ != nullptr;
+}
+
+Bno08xServiceStats Bno08xHandler::GetServiceStats() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    Bno08xServiceStats stats = service_stats_;
+    stats.int_edges = int_latch_.edges.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void Bno08xHandler::serviceWake(bool signalled, uint8_t max_passes) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked() || !initialized_) {
+        return;
+    }
+
+    ++service_stats_.wakeups;
+    const bool armed = int_latch_.armed.load(std::memory_order_acquire);
+
+    if (!signalled) {
+        ++service_stats_.idle_timeouts;
+        if (armed) {
+            // An edge lost before arming leaves INT low with no interrupt to follow.
+            bool asserted = false;
+            if (int_gpio_->IsActive(asserted) != hf_gpio_err_t::GPIO_SUCCESS || !asserted) {
+                return;
+            }
+            ++service_stats_.missed_edges;
+            int_latch_.pending.store(true, std::memory_order_release);
+        }
+        // Not armed: the timeout is the poll period.
+    } else if (armed && !int_latch_.pending.load(std::memory_order_acquire)) {
+        // Semaphore count left by an edge that an earlier pass already drained.
+        ++service_stats_.coalesced_wakeups;
+        return;
+    }
+
+    serviceLocked(max_passes > 0 ? max_passes : 1);
+
+    if (signalled && armed) {
+        const uint32_t latency_us = static_cast<uint32_t>(RtosTime::GetCurrentTimeUs()) -
+                                    int_latch_.last_edge_us.load(std::memory_order_relaxed);
+        service_stats_.last_latency_us = latency_us;
+        if (latency_us > service_stats_.max_latency_us) {
+            service_stats_.max_latency_us = latency_us;
+        }
+    }
+}
+
+void Bno08xHandler::intEdgeCallback(BaseGpio* /*gpio*/,
+                                    hf_gpio_interrupt_trigger_t /*trigger*/,
+                                    void* user_data) noexcept {
+    // Called in ISR context -- latch the edge and wake the task, defer bus work.
+    auto* self = static_cast<Bno08xHandler*>(user_data);
+    if (!self) {
+        return;
+    }
+    self->int_latch_.last_edge_us.store(static_cast<uint32_t>(RtosTime::GetCurrentTimeUs()),
+                                        std::memory_order_relaxed);
+    self->int_latch_.edges.fetch_add(1, std::memory_order_relaxed);
+    self->int_latch_.pending.store(true, std::memory_order_release);
+    if (auto* task = self->service_task_.get()) {
+        task->Wake();
+    }
+}
+
 // ============================================================================
 //  CALLBACK MANAGEMENT
 // ============================================================================
 
-void Bno08xHandler::SetSensorCallback(SensorCallback callback) noexcept {
+void Bno08xHandler::SetSensorCallback(Bno08xEventCallback callback) noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (lock.IsLocked()) {
-        user_callback_ = std::move(callback);
+        user_callback_ = callback;
     }
 }
 
@@ -482,6 +731,204 @@ void Bno08xHandler::ClearSensorCallback() noexcept {
     }
 }
 
+Bno08xError Bno08xHandler::ReplayEvent(const SensorEvent& event) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!lock.IsLocked()) {
+        return Bno08xError::MUTEX_LOCK_FAILED;
+    }
+    if (!initialized_) {
+        return Bno08xError::NOT_INITIALIZED;
+    }
+
+    dispatchEventLocked(event);
+    if (imu_dirty_) {
+        imu_slot_.Store(imu_pending_);
+        imu_dirty_ = false;
+    }
+    return Bno08xError::SUCCESS;
+}
+
+void Bno08xHandler::dispatchEventLocked(const SensorEvent& event) noexcept {
+    // Publish for readers, then forward.
+    publishEventLocked(event);
+    if (user_callback_) {
+        user_callback_(event);
+    }
+}
+
+// ============================================================================
+//  LATEST-SAMPLE STORE
+// ============================================================================
+
+bool Bno08xHandler::GetLatestImuData(Bno08xImuData& data) const noexcept {
+    return imu_slot_.Load(data);
+}
+
+bool Bno08xHandler::GetLatestVector(BNO085Sensor sensor, Bno08xVector3& vector) const noexcept {
+    const auto* slot = const_cast<Bno08xHandler*>(this)->vectorSlot(sensor);
+    return slot != nullptr && slot->Load(vector);
+}
+
+bool Bno08xHandler::GetLatestQuaternion(BNO085Sensor sensor,
+                                        Bno08xQuaternion& quaternion) const noexcept {
+    const auto* slot = const_cast<Bno08xHandler*>(this)->quaternionSlot(sensor);
+    return slot != nullptr && slot->Load(quaternion);
+}
+
+uint32_t Bno08xHandler::GetImuSnapshotCount() const noexcept {
+    return imu_slot_.GetPublishCount();
+}
+
+SeqlockSlot<Bno08xVector3>* Bno08xHandler::vectorSlot(BNO085Sensor sensor) noexcept {
+    switch (sensor) {
+        case BNO085Sensor::Accelerometer:      return &accel_slot_;
+        case BNO085Sensor::Gyroscope:          return &gyro_slot_;
+        case BNO085Sensor::Magnetometer:       return &mag_slot_;
+        case BNO085Sensor::LinearAcceleration: return &linear_accel_slot_;
+        case BNO085Sensor::Gravity:            return &gravity_slot_;
+        default:                               return nullptr;
+    }
+}
+
+SeqlockSlot<Bno08xQuaternion>* Bno08xHandler::quaternionSlot(BNO085Sensor sensor) noexcept {
+    switch (sensor) {
+        case BNO085Sensor::RotationVector:     return &rotation_slot_;
+        case BNO085Sensor::GameRotationVector: return &game_rotation_slot_;
+        default:                               return nullptr;
+    }
+}
+
+void Bno08xHandler::publishEventLocked(const SensorEvent& event) noexcept {
+    const uint64_t now_us = RtosTime::GetCurrentTimeUs();
+
+    if (auto* slot = vectorSlot(event.sensor)) {
+        Bno08xVector3 vector;
+        vector.x = event.vector.x;
+        vector.y = event.vector.y;
+        vector.z = event.vector.z;
+        vector.accuracy = event.vector.accuracy;
+        vector.timestamp_us = now_us;
+        vector.valid = true;
+        slot->Store(vector);
+        pushReportLocked(event.sensor, now_us, vector.accuracy, vector.x, vector.y, vector.z, 0.0f);
+
+        switch (event.sensor) {
+            case BNO085Sensor::Accelerometer:      imu_pending_.acceleration = vector; break;
+            case BNO085Sensor::Gyroscope:          imu_pending_.gyroscope = vector; break;
+            case BNO085Sensor::Magnetometer:       imu_pending_.magnetometer = vector; break;
+            case BNO085Sensor::LinearAcceleration: imu_pending_.linear_acceleration = vector; break;
+            case BNO085Sensor::Gravity:            imu_pending_.gravity = vector; break;
+            default: break;
+        }
+    } else if (auto* rot_slot = quaternionSlot(event.sensor)) {
+        Bno08xQuaternion quaternion;
+        quaternion.w = event.rotation.w;
+        quaternion.x = event.rotation.x;
+        quaternion.y = event.rotation.y;
+        quaternion.z = event.rotation.z;
+        quaternion.accuracy = event.rotation.accuracy;
+        quaternion.timestamp_us = now_us;
+        quaternion.valid = true;
+        rot_slot->Store(quaternion);
+        pushReportLocked(event.sensor, now_us, quaternion.accuracy,
+                         quaternion.w, quaternion.x, quaternion.y, quaternion.z);
+
+        // The snapshot's orientation comes from the fused rotation vector only.
+        if (event.sensor != BNO085Sensor::RotationVector) {
+            return;
+        }
+        imu_pending_.rotation = quaternion;
+        QuaternionsToEuler(&quaternion, &imu_pending_.euler, 1, config_.euler_mode);
+    } else {
+        return;
+    }
+
+    imu_pending_.timestamp_us = now_us;
+    imu_pending_.valid = true;
+    imu_dirty_ = true;
+}
+
+// ============================================================================
+//  REPORT RINGS
+// ============================================================================
+
+size_t Bno08xHandler::DrainReports(BNO085Sensor sensor, Bno08xReport* reports,
+                                   size_t max_count) noexcept {
+    const int index = reportRingIndex(sensor);
+    if (index < 0) {
+        return 0;
+    }
+    return report_rings_[static_cast<size_t>(index)].PopBatch(reports, max_count);
+}
+
+bool Bno08xHandler::GetReportRingStats(BNO085Sensor sensor,
+                                       Bno08xReportRingStats& stats) const noexcept {
+    const int index = reportRingIndex(sensor);
+    if (index < 0 || !report_rings_[static_cast<size_t>(index)].IsAllocated()) {
+        return false;
+    }
+    const auto& ring = report_rings_[static_cast<size_t>(index)];
+    stats.capacity = ring.Capacity();
+    stats.pending = ring.Size();
+    stats.pushed = ring.GetPushedCount();
+    stats.dropped = ring.GetDroppedCount();
+    stats.high_water = ring.GetHighWater();
+    return true;
+}
+
+int Bno08xHandler::reportRingIndex(BNO085Sensor sensor) noexcept {
+    switch (sensor) {
+        case BNO085Sensor::Accelerometer:      return 0;
+        case BNO085Sensor::Gyroscope:          return 1;
+        case BNO085Sensor::Magnetometer:       return 2;
+        case BNO085Sensor::LinearAcceleration: return 3;
+        case BNO085Sensor::Gravity:            return 4;
+        case BNO085Sensor::RotationVector:     return 5;
+        case BNO085Sensor::GameRotationVector: return 6;
+        default:                               return -1;
+    }
+}
+
+void Bno08xHandler::allocateReportRingsLocked() noexcept {
+    if (config_.report_ring_capacity == 0) {
+        return;
+    }
+
+    const std::array<bool, kReportRingSensors> enabled = {
+        config_.enable_accelerometer, config_.enable_gyroscope, config_.enable_magnetometer,
+        config_.enable_linear_acceleration, config_.enable_gravity,
+        config_.enable_rotation_vector, config_.enable_game_rotation};
+
+    for (size_t i = 0; i < kReportRingSensors; ++i) {
+        if (enabled[i] && !report_rings_[i].Allocate(config_.report_ring_capacity)) {
+            Logger::GetInstance().Warn(TAG, "Report ring %u (%u reports) not allocated",
+                                       static_cast<unsigned>(i),
+                                       static_cast<unsigned>(config_.report_ring_capacity));
+        }
+    }
+}
+
+void Bno08xHandler::pushReportLocked(BNO085Sensor sensor, uint64_t timestamp_us, uint8_t accuracy,
+                                     float d0, float d1, float d2, float d3) noexcept {
+    const int index = reportRingIndex(sensor);
+    if (index < 0 || !report_rings_[static_cast<size_t>(index)].IsAllocated()) {
+        return;
+    }
+    const auto i = static_cast<size_t>(index);
+
+    Bno08xReport report;
+    report.timestamp_us = timestamp_us;
+    report.data[0] = d0;
+    report.data[1] = d1;
+    report.data[2] = d2;
+    report.data[3] = d3;
+    report.sensor = sensor;
+    report.accuracy = accuracy;
+    // The sequence advances on drops too, so consumers can see the gap.
+    report.sequence = report_sequence_[i]++;
+    report_rings_[i].Push(report);
+}
+
 // ============================================================================
 //  UTILITY METHODS
 // ============================================================================
@@ -521,11 +968,130 @@ void Bno08xHandler::QuaternionToEuler(const Bno08xQuaternion& quaternion,
     euler_angles.valid = true;
 }
 
+void Bno08xHandler::QuaternionsToEuler(const Bno08xQuaternion* quaternions,
+                                        Bno08xEulerAngles* euler_angles, size_t count,
+                                        Bno08xEulerMode mode) noexcept {
+    if (quaternions == nullptr || euler_angles == nullptr) {
+        return;
+    }
+
+    if (mode == Bno08xEulerMode::Exact) {
+        for (size_t i = 0; i < count; ++i) {
+            QuaternionToEuler(quaternions[i], euler_angles[i]);
+        }
+        return;
+    }
+
+    // Gather full blocks into lanes, convert with straight-line arithmetic, scatter back.
+    float w[kEulerBatchBlock], x[kEulerBatchBlock], y[kEulerBatchBlock], z[kEulerBatchBlock];
+    float roll[kEulerBatchBlock], pitch[kEulerBatchBlock], yaw[kEulerBatchBlock];
+
+    size_t base = 0;
+    for (; count - base >= kEulerBatchBlock; base += kEulerBatchBlock) {
+        const Bno08xQuaternion* in = quaternions + base;
+        Bno08xEulerAngles* out = euler_angles + base;
+
+        for (size_t i = 0; i < kEulerBatchBlock; ++i) {
+            w[i] = in[i].w;
+            x[i] = in[i].x;
+            y[i] = in[i].y;
+            z[i] = in[i].z;
+        }
+        for (size_t i = 0; i < kEulerBatchBlock; ++i) {
+            fastEuler(w[i], x[i], y[i], z[i], roll[i], pitch[i], yaw[i]);
+        }
+        for (size_t i = 0; i < kEulerBatchBlock; ++i) {
+            out[i].valid = in[i].valid;
+            if (!in[i].valid) {
+                continue;
+            }
+            out[i].roll = roll[i];
+            out[i].pitch = pitch[i];
+            out[i].yaw = yaw[i];
+            out[i].accuracy = in[i].accuracy;
+            out[i].timestamp_us = in[i].timestamp_us;
+        }
+    }
+
+    // Short tail (and single reports): scalar, no padding to a full block.
+    for (; base < count; ++base) {
+        const Bno08xQuaternion& in = quaternions[base];
+        Bno08xEulerAngles& out = euler_angles[base];
+        out.valid = in.valid;
+        if (!in.valid) {
+            continue;
+        }
+        fastEuler(in.w, in.x, in.y, in.z, out.roll, out.pitch, out.yaw);
+        out.accuracy = in.accuracy;
+        out.timestamp_us = in.timestamp_us;
+    }
+}
+
+Bno08xQuaternion Bno08xHandler::QuaternionMultiply(const Bno08xQuaternion& a,
+                                                   const Bno08xQuaternion& b) noexcept {
+    Bno08xQuaternion result;
+    result.w = a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z;
+    result.x = a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y;
+    result.y = a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x;
+    result.z = a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w;
+    result.accuracy = a.accuracy < b.accuracy ? a.accuracy : b.accuracy;
+    result.timestamp_us = a.timestamp_us > b.timestamp_us ? a.timestamp_us : b.timestamp_us;
+    result.valid = a.valid && b.valid;
+    return result;
+}
+
+bool Bno08xHandler::QuaternionNormalize(Bno08xQuaternion& quaternion) noexcept {
+    const float norm_sq = quaternion.w * quaternion.w + quaternion.x * quaternion.x +
+                          quaternion.y * quaternion.y + quaternion.z * quaternion.z;
+    if (!(norm_sq > 1e-12f) || !std::isfinite(norm_sq)) {
+        return false;
+    }
+    const float inv = 1.0f / std::sqrt(norm_sq);
+    quaternion.w *= inv;
+    quaternion.x *= inv;
+    quaternion.y *= inv;
+    quaternion.z *= inv;
+    return true;
+}
+
+Bno08xQuaternion Bno08xHandler::QuaternionSlerp(const Bno08xQuaternion& a, const Bno08xQuaternion& b,
+                                                float t) noexcept {
+    t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+
+    // q and -q are the same rotation: flip b onto a's hemisphere for the short arc.
+    float dot = a.w * b.w + a.x * b.x + a.y * b.y + a.z * b.z;
+    const float sign = dot < 0.0f ? -1.0f : 1.0f;
+    dot *= sign;
+
+    float wa = 1.0f - t;
+    float wb = t;
+    if (dot < 0.9995f) {
+        const float theta = std::acos(dot);
+        const float inv_sin = 1.0f / std::sin(theta);
+        wa = std::sin(wa * theta) * inv_sin;
+        wb = std::sin(wb * theta) * inv_sin;
+    }
+    wb *= sign;
+
+    Bno08xQuaternion result;
+    result.w = wa * a.w + wb * b.w;
+    result.x = wa * a.x + wb * b.x;
+    result.y = wa * a.y + wb * b.y;
+    result.z = wa * a.z + wb * b.z;
+    QuaternionNormalize(result);
+
+    const double dt = static_cast<double>(b.timestamp_us) - static_cast<double>(a.timestamp_us);
+    result.timestamp_us = static_cast<uint64_t>(static_cast<double>(a.timestamp_us) + dt * t);
+    result.accuracy = a.accuracy < b.accuracy ? a.accuracy : b.accuracy;
+    result.valid = a.valid && b.valid;
+    return result;
+}
+
 BNO085Interface Bno08xHandler::GetInterfaceType() const noexcept {
     return interface_type_;
 }
 
-IBno08xDriverOps* Bno08xHandler::GetSensor() noexcept {
+Bno08xDriver* Bno08xHandler::GetSensor() noexcept {
     if (!EnsureInitialized()) {
         return nullptr;
     }
@@ -535,10 +1101,10 @@ IBno08xDriverOps* Bno08xHandler::GetSensor() noexcept {
         last_error_ = Bno08xError::MUTEX_LOCK_FAILED;
         return nullptr;
     }
-    return driver_ops_.get();
+    return &driver_;
 }
 
-const IBno08xDriverOps* Bno08xHandler::GetSensor() const noexcept {
+const Bno08xDriver* Bno08xHandler::GetSensor() const noexcept {
     auto* self = const_cast<Bno08xHandler*>(this);
     return self->GetSensor();
 }
@@ -552,8 +1118,8 @@ int Bno08xHandler::GetLastDriverError() const noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!lock.IsLocked()) return -1;
     auto* self = const_cast<Bno08xHandler*>(this);
-    if (!self->ensureInitializedLocked() || !driver_ops_) return -1;
-    return driver_ops_->GetLastError();
+    if (!self->ensureInitializedLocked()) return -1;
+    return driver_.GetLastError();
 }
 
 const char* Bno08xHandler::GetDescription() const noexcept {
@@ -576,8 +1142,6 @@ Bno08xError Bno08xHandler::mapDriverError(int sh2_error) noexcept {
 // ============================================================================
 
 void Bno08xHandler::DumpDiagnostics() const noexcept {
-    static constexpr const char* TAG = "Bno08xHandler";
-
     Logger::GetInstance().Info(TAG, "=== BNO08X HANDLER DIAGNOSTICS ===");
 
     MutexLockGuard lock(handler_mutex_);
@@ -604,12 +1168,9 @@ void Bno08xHandler::DumpDiagnostics() const noexcept {
 
     // Driver status
     Logger::GetInstance().Info(TAG, "Driver:");
-    if (driver_ops_) {
-        Logger::GetInstance().Info(TAG, "  Instance: ACTIVE");
-        Logger::GetInstance().Info(TAG, "  Last SH2 Error: %d", driver_ops_->GetLastError());
-    } else {
-        Logger::GetInstance().Info(TAG, "  Instance: NOT_CREATED");
-    }
+    Logger::GetInstance().Info(TAG, "  Instance: %s (static dispatch)",
+        interface_type_ == BNO085Interface::SPI ? "BNO085<HalSpiBno08xComm>" : "BNO085<HalI2cBno08xComm>");
+    Logger::GetInstance().Info(TAG, "  Last SH2 Error: %d", driver_.GetLastError());
 
     // Sensor Configuration
     Logger::GetInstance().Info(TAG, "Sensor Configuration:");
@@ -651,11 +1212,11 @@ void Bno08xHandler::DumpDiagnostics() const noexcept {
         config_.enable_stability_classifier ? "ON" : "OFF");
 
     // Calibration status (if initialized)
-    if (initialized_ && driver_ops_) {
-        SensorEvent accel = driver_ops_->GetLatest(BNO085Sensor::Accelerometer);
-        SensorEvent gyro = driver_ops_->GetLatest(BNO085Sensor::Gyroscope);
-        SensorEvent mag = driver_ops_->GetLatest(BNO085Sensor::Magnetometer);
-        SensorEvent rv = driver_ops_->GetLatest(BNO085Sensor::RotationVector);
+    if (initialized_) {
+        SensorEvent accel = driver_.GetLatest(BNO085Sensor::Accelerometer);
+        SensorEvent gyro = driver_.GetLatest(BNO085Sensor::Gyroscope);
+        SensorEvent mag = driver_.GetLatest(BNO085Sensor::Magnetometer);
+        SensorEvent rv = driver_.GetLatest(BNO085Sensor::RotationVector);
 
         Logger::GetInstance().Info(TAG, "Calibration Accuracy:");
         Logger::GetInstance().Info(TAG, "  Accelerometer: %u/3", accel.vector.accuracy);
@@ -668,6 +1229,50 @@ void Bno08xHandler::DumpDiagnostics() const noexcept {
     Logger::GetInstance().Info(TAG, "Callback: %s",
         user_callback_ ? "REGISTERED" : "NONE");
 
+    // Latest-sample store
+    Logger::GetInstance().Info(TAG, "Sample Store:");
+    Logger::GetInstance().Info(TAG, "  Snapshots: %lu",
+        static_cast<unsigned long>(imu_slot_.GetPublishCount()));
+    Logger::GetInstance().Info(TAG, "  Reports: accel=%lu gyro=%lu mag=%lu rot=%lu game_rot=%lu",
+        static_cast<unsigned long>(accel_slot_.GetPublishCount()),
+        static_cast<unsigned long>(gyro_slot_.GetPublishCount()),
+        static_cast<unsigned long>(mag_slot_.GetPublishCount()),
+        static_cast<unsigned long>(rotation_slot_.GetPublishCount()),
+        static_cast<unsigned long>(game_rotation_slot_.GetPublishCount()));
+
+    // Report rings
+    static constexpr const char* kRingNames[kReportRingSensors] = {
+        "accel", "gyro", "mag", "linear_accel", "gravity", "rotation", "game_rotation"};
+    for (size_t i = 0; i < kReportRingSensors; ++i) {
+        const auto& ring = report_rings_[i];
+        if (!ring.IsAllocated()) {
+            continue;
+        }
+        Logger::GetInstance().Info(TAG, "Report Ring %s: depth=%lu pending=%lu pushed=%lu dropped=%lu peak=%lu",
+            kRingNames[i],
+            static_cast<unsigned long>(ring.Capacity()),
+            static_cast<unsigned long>(ring.Size()),
+            static_cast<unsigned long>(ring.GetPushedCount()),
+            static_cast<unsigned long>(ring.GetDroppedCount()),
+            static_cast<unsigned long>(ring.GetHighWater()));
+    }
+
+    // Service task
+    const uint32_t int_edges = int_latch_.edges.load(std::memory_order_relaxed);
+    Logger::GetInstance().Info(TAG, "Service Task: %s (INT %s)",
+        service_task_ ? "RUNNING" : "STOPPED",
+        int_latch_.armed.load(std::memory_order_relaxed) ? "interrupt" : "polled");
+    Logger::GetInstance().Info(TAG, "  Edges: %lu  Wakeups: %lu  Coalesced: %lu  Timeouts: %lu  Missed Edges: %lu",
+        static_cast<unsigned long>(int_edges),
+        static_cast<unsigned long>(service_stats_.wakeups),
+        static_cast<unsigned long>(service_stats_.coalesced_wakeups),
+        static_cast<unsigned long>(service_stats_.idle_timeouts),
+        static_cast<unsigned long>(service_stats_.missed_edges));
+    Logger::GetInstance().Info(TAG, "  Passes: %lu  Latency(us) last=%lu max=%lu",
+        static_cast<unsigned long>(service_stats_.service_passes),
+        static_cast<unsigned long>(service_stats_.last_latency_us),
+        static_cast<unsigned long>(service_stats_.max_latency_us));
+
     // Memory estimate
     size_t estimated_memory = sizeof(*this);
     Logger::GetInstance().Info(TAG, "Estimated Memory: %u bytes",
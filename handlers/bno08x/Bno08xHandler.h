@@ -16,22 +16,27 @@
  *    driver's CRTP-based bno08x::CommInterface. Includes all 12 required methods
  *    (bus I/O, timing, and 5 pin control signals).
  *
- * 2. **Type-Erased Driver Interface** (IBno08xDriverOps):
- *    Internal abstract class that hides the BNO085<CommType> template from the
- *    handler. Provides virtual methods for all driver operations. The one-vtable
- *    cost is negligible for an IMU updating at ~100 Hz.
+ * 2. **Template Driver Wrapper** (Bno08xDriverImpl<CommType>):
+ *    Owns both the CRTP comm adapter and the BNO085 driver instance and
+ *    forwards the SH-2 API to the real driver with plain (inlinable) calls.
  *
- * 3. **Template Driver Wrapper** (Bno08xDriverImpl<CommType>):
- *    Owns both the CRTP comm adapter and the BNO085 driver instance, implementing
- *    IBno08xDriverOps by delegating to the real driver.
+ * 3. **Static Driver Dispatch** (Bno08xDriver):
+ *    Holds one of the two possible Bno08xDriverImpl instantiations in a
+ *    std::variant, selected at construction by the transport. Every call is
+ *    resolved with a two-way branch on the variant index instead of a
+ *    vtable, so the hot path (Update() and report dispatch) keeps the
+ *    zero-overhead CRTP design. No heap allocation.
  *
  * 4. **Bno08xHandler** (main class):
- *    Non-templated facade that owns a type-erased driver via unique_ptr.
+ *    Non-templated facade that owns the Bno08xDriver in place.
  *    Provides:
  *    - Lazy initialization with hardware reset sequence
  *    - Complete SH-2 sensor data access (9-DOF fusion, gestures, activity)
  *    - GetSensor() for direct driver API (Update, EnableSensor, GetLatest, SetCallback, etc.)
- *    - Callback management for event-driven operation
+ *    - Wait-free latest-sample store (seqlock slots) for reader tasks
+ *    - Optional INT-driven service task (StartServiceTask) instead of polled Update()
+ *    - Per-sensor lock-free report rings with batch drain (DrainReports)
+ *    - Allocation-free callback management for event-driven operation
  *    - Individual sensor enable/disable with configurable intervals
  *    - Hardware control (reset, boot, wake pins)
  *    - Thread-safe operations with RtosMutex protection
@@ -40,7 +45,7 @@
  * ## Ownership Model
  *
  * The handler owns all its internal resources:
- * - One IBno08xDriverOps (type-erased driver + comm adapter)
+ * - One Bno08xDriver (driver + comm adapter, stored inline)
  *
  * ## Initialization Sequence
  *
@@ -53,7 +58,7 @@
  * if (handler.Initialize() != Bno08xError::SUCCESS) { return; }
  *
  * // 4. Optionally enable extra sensors via driver access
- * handler.visitDriver([](IBno08xDriverOps& drv) {
+ * handler.visitDriver([](Bno08xDriver& drv) {
  *     drv.EnableSensor(BNO085Sensor::GameRotationVector, 10);
  * });
  *
@@ -69,6 +74,17 @@
  * The handler uses RtosMutex (recursive) for thread-safe access to all
  * handler-level operations.
  *
+ * Sample readers do not need that mutex: every report decoded inside
+ * Update() is published into a per-sensor SeqlockSlot, and each Update()
+ * that decoded anything publishes one coherent Bno08xImuData snapshot.
+ * GetLatestImuData(), GetLatestVector() and GetLatestQuaternion() copy from
+ * those slots without blocking, so an estimator task never waits behind the
+ * I2C/SPI transfers of the service loop.
+ *
+ * StartServiceTask() moves the service loop onto a handler-owned task that
+ * sleeps until the INT line falls and then drains every pending SH-2
+ * packet, so reports reach callbacks and readers without a poll period.
+ *
  * @see BNO085             Templated driver from hf-bno08x-driver
  * @see bno08x::CommInterface  CRTP communication base class
  *
@@ -80,18 +96,26 @@
 #ifndef COMPONENT_HANDLER_BNO08X_HANDLER_H_
 #define COMPONENT_HANDLER_BNO08X_HANDLER_H_
 
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <array>
 #include <functional>
 #include <type_traits>
 #include <utility>
+#include <variant>
 #include "core/hf-core-drivers/external/hf-bno08x-driver/inc/bno08x.hpp"
 #include "core/hf-core-drivers/external/hf-bno08x-driver/inc/bno08x_comm_interface.hpp"
 #include "base/BaseI2c.h"
 #include "base/BaseSpi.h"
 #include "base/BaseGpio.h"
 #include "RtosMutex.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/BaseThread.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/SignalSemaphore.h"
+#include "handlers/common/InlineCallback.h"
+#include "handlers/common/SeqlockSlot.h"
+#include "handlers/common/SpscRing.h"
 
 // ============================================================================
 //  BNO08X ERROR CODES
@@ -142,6 +166,24 @@ constexpr const char* Bno08xErrorToString(Bno08xError error) noexcept {
     }
 }
 
+// ============================================================================
+//  INT EDGE LATCH
+// ============================================================================
+
+/**
+ * @brief INT edge latch shared by the handler's GPIO interrupt and the comm adapters.
+ *
+ * While @c armed, the INT interrupt records every falling edge here and the
+ * adapters answer DataAvailable() from the latch instead of sampling the pin
+ * on every transfer.
+ */
+struct Bno08xIntLatch {
+    std::atomic<bool> armed{false};         ///< INT interrupt configured by the service task
+    std::atomic<bool> pending{false};       ///< Edge seen and not yet consumed
+    std::atomic<uint32_t> edges{0};         ///< Falling edges since arming
+    std::atomic<uint32_t> last_edge_us{0};  ///< Time of the latest edge (µs, wraps)
+};
+
 // ============================================================================
 //  CRTP COMMUNICATION ADAPTERS
 // ============================================================================
@@ -159,11 +201,13 @@ public:
      * @param i2c Reference to BaseI2c implementation (address pre-configured)
      * @param reset_gpio Optional GPIO for hardware reset (RSTN, active-low)
      * @param int_gpio Optional GPIO for interrupt monitoring (INT, active-low)
+     * @param int_latch Optional INT edge latch (owned by Bno08xHandler)
      */
     explicit HalI2cBno08xComm(BaseI2c& i2c,
                               BaseGpio* reset_gpio = nullptr,
-                              BaseGpio* int_gpio = nullptr) noexcept
-        : i2c_(i2c), reset_gpio_(reset_gpio), int_gpio_(int_gpio) {}
+                              BaseGpio* int_gpio = nullptr,
+                              Bno08xIntLatch* int_latch = nullptr) noexcept
+        : i2c_(i2c), reset_gpio_(reset_gpio), int_gpio_(int_gpio), int_latch_(int_latch) {}
 
     // -- bno08x::CommInterface required methods --
 
@@ -178,7 +222,7 @@ public:
     int  Write(const uint8_t* data, uint32_t length) noexcept;
     /** @param data Buffer to fill. @param length Max bytes. @return Bytes read, 0 if no data, -1 on error */
     int  Read(uint8_t* data, uint32_t length) noexcept;
-    /** Check INT pin (active-low). @return true if data ready or no INT pin */
+    /** Check INT (cached edge if the latch is armed, else the pin). @return true if data ready or no INT pin */
     bool DataAvailable() noexcept;
     /** Block for @p ms milliseconds. @param ms Delay in ms */
     void Delay(uint32_t ms) noexcept;
@@ -192,6 +236,7 @@ private:
     BaseI2c& i2c_;
     BaseGpio* reset_gpio_;
     BaseGpio* int_gpio_;
+    Bno08xIntLatch* int_latch_;
 };
 
 /**
@@ -207,12 +252,15 @@ public:
      * @param reset_gpio Optional GPIO for hardware reset (RSTN, active-low)
      * @param int_gpio Optional GPIO for interrupt monitoring (INT, active-low)
      * @param wake_gpio Optional GPIO for wake control (SPI mode)
+     * @param int_latch Optional INT edge latch (owned by Bno08xHandler)
      */
     explicit HalSpiBno08xComm(BaseSpi& spi,
                               BaseGpio* reset_gpio = nullptr,
                               BaseGpio* int_gpio = nullptr,
-                              BaseGpio* wake_gpio = nullptr) noexcept
-        : spi_(spi), reset_gpio_(reset_gpio), int_gpio_(int_gpio), wake_gpio_(wake_gpio) {}
+                              BaseGpio* wake_gpio = nullptr,
+                              Bno08xIntLatch* int_latch = nullptr) noexcept
+        : spi_(spi), reset_gpio_(reset_gpio), int_gpio_(int_gpio), wake_gpio_(wake_gpio),
+          int_latch_(int_latch) {}
 
     // -- bno08x::CommInterface required methods --
 
@@ -227,7 +275,7 @@ public:
     int  Write(const uint8_t* data, uint32_t length) noexcept;
     /** @param data Buffer to fill. @param length Max bytes. @return Bytes read, 0 if no data, -1 on error */
     int  Read(uint8_t* data, uint32_t length) noexcept;
-    /** Check INT pin (active-low). @return true if data ready or no INT pin */
+    /** Check INT (cached edge if the latch is armed, else the pin). @return true if data ready or no INT pin */
     bool DataAvailable() noexcept;
     /** Block for @p ms milliseconds. @param ms Delay in ms */
     void Delay(uint32_t ms) noexcept;
@@ -242,49 +290,24 @@ private:
     BaseGpio* reset_gpio_;
     BaseGpio* int_gpio_;
     BaseGpio* wake_gpio_;
+    Bno08xIntLatch* int_latch_;
 };
 
 // ============================================================================
-//  TYPE-ERASED DRIVER INTERFACE (internal)
+//  DRIVER WRAPPER AND STATIC DISPATCH
 // ============================================================================
 
 /**
- * @brief Internal abstract interface for type-erasing the BNO085<CommType> template.
- *
- * This enables the handler to work with both I2C and SPI transports
- * without exposing template parameters to handler users.
- */
-class IBno08xDriverOps {
-public:
-    virtual ~IBno08xDriverOps() noexcept = default;
-
-    virtual bool Begin() noexcept = 0;
-    virtual void Update() noexcept = 0;
-    virtual bool EnableSensor(BNO085Sensor sensor, uint32_t interval_ms,
-                              float sensitivity) noexcept = 0;
-    virtual bool DisableSensor(BNO085Sensor sensor) noexcept = 0;
-    virtual void SetCallback(SensorCallback cb) noexcept = 0;
-    virtual bool HasNewData(BNO085Sensor sensor) const noexcept = 0;
-    virtual SensorEvent GetLatest(BNO085Sensor sensor) const noexcept = 0;
-    virtual int  GetLastError() const noexcept = 0;
-    virtual void HardwareReset(uint32_t lowMs) noexcept = 0;
-    virtual void SetBootPin(bool state) noexcept = 0;
-    virtual void SetWakePin(bool state) noexcept = 0;
-    virtual void SelectInterface(BNO085Interface iface) noexcept = 0;
-    virtual BNO085Interface GetInterfaceType() noexcept = 0;
-};
-
-/**
- * @brief Concrete type-erased driver wrapper.
+ * @brief Concrete driver wrapper for one transport.
  *
  * Owns both the CRTP comm adapter (as a member) and the BNO085 driver instance.
  * The comm adapter is declared first to ensure it outlives the driver (which
- * stores a reference to it).
+ * stores a reference to it). Not copyable or movable for the same reason.
  *
  * @tparam CommType  The CRTP communication adapter type.
  */
 template <typename CommType>
-class Bno08xDriverImpl : public IBno08xDriverOps {
+class Bno08xDriverImpl {
 public:
     /**
      * @brief Construct with a pre-built comm adapter (moved in).
@@ -292,57 +315,121 @@ public:
     explicit Bno08xDriverImpl(CommType&& comm) noexcept
         : comm_(std::move(comm)), driver_(comm_) {}
 
-    bool Begin() noexcept override { return driver_.Begin(); }
-    void Update() noexcept override { driver_.Update(); }
+    Bno08xDriverImpl(const Bno08xDriverImpl&) = delete;
+    Bno08xDriverImpl& operator=(const Bno08xDriverImpl&) = delete;
+
+    bool Begin() noexcept { return driver_.Begin(); }
+    void Update() noexcept { driver_.Update(); }
 
-    bool EnableSensor(BNO085Sensor sensor, uint32_t interval_ms,
-                      float sensitivity) noexcept override {
+    bool EnableSensor(BNO085Sensor sensor, uint32_t interval_ms, float sensitivity) noexcept {
         return driver_.EnableSensor(sensor, interval_ms, sensitivity);
     }
 
-    bool DisableSensor(BNO085Sensor sensor) noexcept override {
-        return driver_.DisableSensor(sensor);
-    }
+    bool DisableSensor(BNO085Sensor sensor) noexcept { return driver_.DisableSensor(sensor); }
+    void SetCallback(SensorCallback cb) noexcept { driver_.SetCallback(std::move(cb)); }
+    bool HasNewData(BNO085Sensor sensor) const noexcept { return driver_.HasNewData(sensor); }
+    SensorEvent GetLatest(BNO085Sensor sensor) const noexcept { return driver_.GetLatest(sensor); }
+    int GetLastError() const noexcept { return driver_.GetLastError(); }
+    void HardwareReset(uint32_t lowMs) noexcept { driver_.HardwareReset(lowMs); }
+    void SetBootPin(bool state) noexcept { driver_.SetBootPin(state); }
+    void SetWakePin(bool state) noexcept { driver_.SetWakePin(state); }
+    void SelectInterface(BNO085Interface iface) noexcept { driver_.SelectInterface(iface); }
+    BNO085Interface GetInterfaceType() noexcept { return comm_.GetInterfaceType(); }
+
+    /** @brief Typed access to the underlying BNO085 driver. */
+    BNO085<CommType>& Native() noexcept { return driver_; }
+
+private:
+    CommType comm_;                  ///< CRTP comm adapter (must outlive driver_)
+    mutable BNO085<CommType> driver_;  ///< BNO085 driver instance (mutable: GetLatest clears internal flag)
+};
+
+/**
+ * @brief Driver selected at construction from a closed set of transports.
+ *
+ * Stores the I2C or SPI Bno08xDriverImpl inline in a std::variant and
+ * exposes the SH-2 API with the same method names. Each call branches on
+ * the variant index and then calls the concrete driver directly, which
+ * the compiler can inline; there is no vtable and no heap allocation.
+ *
+ * Use Visit() for generic code that needs the concrete type, e.g. to reach
+ * BNO085<CommType> through Native().
+ */
+class Bno08xDriver {
+public:
+    using I2cDriver = Bno08xDriverImpl<HalI2cBno08xComm>;  ///< Driver over BaseI2c
+    using SpiDriver = Bno08xDriverImpl<HalSpiBno08xComm>;  ///< Driver over BaseSpi
+
+    /**
+     * @brief Construct the driver of type @p Impl in place.
+     * @param args Forwarded to the Impl constructor (the comm adapter)
+     */
+    template <typename Impl, typename... CtorArgs>
+    explicit Bno08xDriver(std::in_place_type_t<Impl> tag, CtorArgs&&... args) noexcept
+        : impl_(tag, std::forward<CtorArgs>(args)...) {}
+
+    Bno08xDriver(const Bno08xDriver&) = delete;
+    Bno08xDriver& operator=(const Bno08xDriver&) = delete;
 
-    void SetCallback(SensorCallback cb) noexcept override {
-        driver_.SetCallback(std::move(cb));
+    /**
+     * @brief Call @p fn with the concrete driver (I2cDriver& or SpiDriver&).
+     * @return Whatever @p fn returns (must be the same type for both drivers).
+     */
+    template <typename Fn>
+    decltype(auto) Visit(Fn&& fn) noexcept {
+        if (auto* spi = std::get_if<SpiDriver>(&impl_)) {
+            return fn(*spi);
+        }
+        return fn(*std::get_if<I2cDriver>(&impl_));
     }
 
-    bool HasNewData(BNO085Sensor sensor) const noexcept override {
-        return driver_.HasNewData(sensor);
+    /** @brief Const overload of Visit(). */
+    template <typename Fn>
+    decltype(auto) Visit(Fn&& fn) const noexcept {
+        if (const auto* spi = std::get_if<SpiDriver>(&impl_)) {
+            return fn(*spi);
+        }
+        return fn(*std::get_if<I2cDriver>(&impl_));
     }
 
-    SensorEvent GetLatest(BNO085Sensor sensor) const noexcept override {
-        return driver_.GetLatest(sensor);
+    bool Begin() noexcept { return Visit([](auto& d) { return d.Begin(); }); }
+    void Update() noexcept { Visit([](auto& d) { d.Update(); }); }
+
+    bool EnableSensor(BNO085Sensor sensor, uint32_t interval_ms, float sensitivity = 0.0f) noexcept {
+        return Visit([&](auto& d) { return d.EnableSensor(sensor, interval_ms, sensitivity); });
     }
 
-    int GetLastError() const noexcept override {
-        return driver_.GetLastError();
+    bool DisableSensor(BNO085Sensor sensor) noexcept {
+        return Visit([&](auto& d) { return d.DisableSensor(sensor); });
     }
 
-    void HardwareReset(uint32_t lowMs) noexcept override {
-        driver_.HardwareReset(lowMs);
+    void SetCallback(SensorCallback cb) noexcept {
+        Visit([&](auto& d) { d.SetCallback(std::move(cb)); });
     }
 
-    void SetBootPin(bool state) noexcept override {
-        driver_.SetBootPin(state);
+    bool HasNewData(BNO085Sensor sensor) const noexcept {
+        return Visit([&](const auto& d) { return d.HasNewData(sensor); });
     }
 
-    void SetWakePin(bool state) noexcept override {
-        driver_.SetWakePin(state);
+    SensorEvent GetLatest(BNO085Sensor sensor) const noexcept {
+        return Visit([&](const auto& d) { return d.GetLatest(sensor); });
     }
 
-    void SelectInterface(BNO085Interface iface) noexcept override {
-        driver_.SelectInterface(iface);
+    int GetLastError() const noexcept { return Visit([](const auto& d) { return d.GetLastError(); }); }
+    void HardwareReset(uint32_t lowMs) noexcept { Visit([&](auto& d) { d.HardwareReset(lowMs); }); }
+    void SetBootPin(bool state) noexcept { Visit([&](auto& d) { d.SetBootPin(state); }); }
+    void SetWakePin(bool state) noexcept { Visit([&](auto& d) { d.SetWakePin(state); }); }
+
+    void SelectInterface(BNO085Interface iface) noexcept {
+        Visit([&](auto& d) { d.SelectInterface(iface); });
     }
 
-    BNO085Interface GetInterfaceType() noexcept override {
-        return comm_.GetInterfaceType();
+    BNO085Interface GetInterfaceType() noexcept {
+        return Visit([](auto& d) { return d.GetInterfaceType(); });
     }
 
 private:
-    CommType comm_;                  ///< CRTP comm adapter (must outlive driver_)
-    mutable BNO085<CommType> driver_;  ///< BNO085 driver instance (mutable: GetLatest clears internal flag)
+    std::variant<I2cDriver, SpiDriver> impl_;  ///< Active driver (stored inline)
 };
 
 // ============================================================================
@@ -351,6 +438,9 @@ private:
 
 /**
  * @brief Enhanced vector with timestamp and accuracy.
+ *
+ * In samples published by Bno08xHandler, @c timestamp_us is the host time
+ * (RtosTime) at which the report was decoded.
  */
 struct Bno08xVector3 {
     float x{0};                  ///< X component
@@ -386,6 +476,14 @@ struct Bno08xEulerAngles {
     bool valid{false};           ///< Data validity flag
 };
 
+/**
+ * @brief Euler conversion algorithm.
+ */
+enum class Bno08xEulerMode : uint8_t {
+    Exact,   ///< libm atan2 / asin
+    Fast     ///< Branch-free polynomial atan2; |error| <= 1e-5 rad per angle
+};
+
 /**
  * @brief Complete IMU sensor data structure.
  */
@@ -418,6 +516,38 @@ struct Bno08xActivityData {
     bool valid{false};               ///< Data validity
 };
 
+/**
+ * @brief Sensor event callback stored inline (no heap allocation).
+ *
+ * Accepts function pointers, a function pointer plus context
+ * (@c Bno08xEventCallback(&OnEvent, ctx)), and lambdas whose captures are
+ * trivially copyable and fit in two pointers (e.g. @c [this] or
+ * @c [this, &counter]). Larger captures fail to compile.
+ */
+using Bno08xEventCallback = InlineCallback<void(const SensorEvent&)>;
+
+/**
+ * @brief Compact fixed-size report queued in a per-sensor report ring.
+ */
+struct Bno08xReport {
+    uint64_t timestamp_us;   ///< Host time at decode (µs)
+    float data[4];           ///< x, y, z, 0 (vector sensors) or w, x, y, z (rotation sensors)
+    BNO085Sensor sensor;     ///< Source sensor
+    uint8_t accuracy;        ///< Sensor accuracy (0-3)
+    uint16_t sequence;       ///< Per-sensor sequence number (wraps; a gap means drops)
+};
+
+/**
+ * @brief Fill and overflow counters of one report ring.
+ */
+struct Bno08xReportRingStats {
+    uint32_t capacity{0};      ///< Ring depth in reports (0 = no ring)
+    uint32_t pending{0};       ///< Reports waiting to be drained
+    uint32_t pushed{0};        ///< Reports queued
+    uint32_t dropped{0};       ///< Reports lost because the ring was full
+    uint32_t high_water{0};    ///< Peak fill level
+};
+
 /**
  * @brief Sensor calibration status.
  */
@@ -462,6 +592,71 @@ struct Bno08xConfig {
     uint32_t linear_accel_interval_ms{50};      ///< 20 Hz default
     uint32_t gravity_interval_ms{100};          ///< 10 Hz default
     uint32_t game_rotation_interval_ms{50};     ///< 20 Hz default
+
+    // Report rings (allocated at Initialize() for the vector and rotation sensors enabled above only)
+    uint16_t report_ring_capacity{0};           ///< Reports per sensor ring (0 = no rings; rounded up to a power of two)
+
+    // Derived data
+    Bno08xEulerMode euler_mode{Bno08xEulerMode::Exact}; ///< Conversion used for Bno08xImuData::euler
+};
+
+/**
+ * @brief Configuration of the optional handler-owned service task.
+ */
+struct Bno08xServiceTaskConfig {
+    uint32_t priority{6};              ///< Task priority
+    uint32_t idle_timeout_ms{100};     ///< Wake without an edge (missed-edge check; poll period without INT)
+    uint8_t max_passes_per_wake{8};    ///< SH-2 service passes per wakeup while INT keeps re-asserting
+};
+
+/**
+ * @brief Service task statistics.
+ */
+struct Bno08xServiceStats {
+    uint32_t int_edges{0};          ///< INT falling edges seen by the interrupt
+    uint32_t wakeups{0};            ///< Task wakeups (edges and timeouts)
+    uint32_t coalesced_wakeups{0};  ///< Wakeups whose edge an earlier pass had already drained
+    uint32_t idle_timeouts{0};      ///< Wakeups without an edge
+    uint32_t missed_edges{0};       ///< Timeouts that found INT asserted
+    uint32_t service_passes{0};     ///< SH-2 service passes (task and Update())
+    uint32_t last_latency_us{0};    ///< INT edge to end of drain, latest wakeup
+    uint32_t max_latency_us{0};     ///< Worst INT edge to end of drain
+};
+
+class Bno08xHandler;
+
+/**
+ * @brief Service task owned by Bno08xHandler (see Bno08xHandler::StartServiceTask()).
+ *
+ * Sleeps until the INT interrupt signals it (or the idle timeout expires)
+ * and then drains the sensor through the handler.
+ */
+class Bno08xServiceTask : public BaseThread {
+public:
+    /** @brief Task stack size in bytes. */
+    static constexpr uint32_t kStackSize = 4096;
+
+    Bno08xServiceTask(Bno08xHandler& handler, const Bno08xServiceTaskConfig& config) noexcept;
+    ~Bno08xServiceTask() noexcept override = default;
+
+    Bno08xServiceTask(const Bno08xServiceTask&) = delete;
+    Bno08xServiceTask& operator=(const Bno08xServiceTask&) = delete;
+
+    /** @brief Wake the task (called from the INT interrupt). */
+    void Wake() noexcept { wake_.Signal(); }
+
+protected:
+    bool Initialize() noexcept override;
+    bool Setup() noexcept override;
+    uint32_t Step() noexcept override;
+    bool Cleanup() noexcept override;
+    bool ResetVariables() noexcept override;
+
+private:
+    Bno08xHandler& handler_;
+    const Bno08xServiceTaskConfig config_;
+    SignalSemaphore wake_;
+    uint8_t stack_[kStackSize];
 };
 
 // ============================================================================
@@ -476,7 +671,9 @@ struct Bno08xConfig {
  * - Exception-free design with noexcept methods
  * - Thread-safe operations with recursive mutex protection
  * - Bridge pattern integration with BaseI2c/BaseSpi via CRTP adapters
- * - Type erasure to hide template complexity from users
+ * - Static dispatch through Bno08xDriver: the I2C or SPI driver lives inline
+ *   in a std::variant and each call branches on std::get_if to the concrete
+ *   driver, with no vtable or heap-allocated driver
  * - Complete SH-2 mode sensor access (9-DOF, gestures, activity)
  * - Configurable sensor enable/disable and interval management
  * - Hardware control (reset, boot, wake, interface selection)
@@ -513,7 +710,8 @@ public:
                            BaseGpio* int_gpio = nullptr,
                            BaseGpio* wake_gpio = nullptr) noexcept;
 
-    ~Bno08xHandler() noexcept = default;
+    /** @brief Destructor. Stops the service task if running. */
+    ~Bno08xHandler() noexcept;
 
     // Non-copyable
     Bno08xHandler(const Bno08xHandler&) = delete;
@@ -562,13 +760,48 @@ public:
     /**
      * @brief Update sensor - must be called regularly to pump the SH-2 service loop.
      *
-     * Call this every 5-10 ms (or faster) for optimal data throughput.
+     * Call this every 5-10 ms (or faster) for optimal data throughput, or let
+     * StartServiceTask() call it on INT instead.
      * Sensor callbacks are dispatched from within this method.
      *
      * @return Bno08xError::SUCCESS if successful
      */
     Bno08xError Update() noexcept;
 
+    /**
+     * @brief Start a handler-owned task that services the sensor on INT.
+     *
+     * The INT GPIO is switched to a falling-edge interrupt that wakes the
+     * task; each wakeup runs SH-2 service passes until INT stops
+     * re-asserting (at most max_passes_per_wake). While the task runs the
+     * comm adapter answers DataAvailable() from the cached edge instead of
+     * reading the pin. Without an INT GPIO (or if the interrupt cannot be
+     * configured) the task polls every idle_timeout_ms instead.
+     *
+     * Callbacks and the latest-sample store are then fed from the task;
+     * calling Update() as well is allowed but unnecessary.
+     *
+     * @param config Task priority, idle timeout and drain bound
+     * @return SUCCESS (also if already running), initialization errors, or
+     *         INITIALIZATION_FAILED if the task could not be created
+     */
+    Bno08xError StartServiceTask(const Bno08xServiceTaskConfig& config = Bno08xServiceTaskConfig{}) noexcept;
+
+    /**
+     * @brief Stop the service task and restore polled INT handling.
+     *
+     * Must not be called from a sensor callback (those run on the task).
+     *
+     * @return SUCCESS, or TIMEOUT if the task did not exit in time
+     */
+    Bno08xError StopServiceTask() noexcept;
+
+    /** @brief Check whether the service task is running. */
+    bool IsServiceTaskRunning() const noexcept;
+
+    /** @brief Get a copy of the service task statistics. */
+    Bno08xServiceStats GetServiceStats() const noexcept;
+
     // ========================================================================
     //  CALLBACK MANAGEMENT
     // ========================================================================
@@ -576,18 +809,106 @@ public:
     /**
      * @brief Set callback for sensor events.
      *
-     * The callback is invoked from within Update() whenever a sensor report
-     * arrives. Only one callback can be active at a time.
+     * The callback is invoked from within Update() (or the service task)
+     * whenever a sensor report arrives. Only one callback can be active at a
+     * time. It is stored inline and called through one function pointer.
      *
      * @param callback Callback function for sensor events
      */
-    void SetSensorCallback(SensorCallback callback) noexcept;
+    void SetSensorCallback(Bno08xEventCallback callback) noexcept;
 
     /**
      * @brief Clear sensor event callback.
      */
     void ClearSensorCallback() noexcept;
 
+    /**
+     * @brief Feed one decoded report through the driver-callback path.
+     *
+     * Does exactly what a report decoded by Update() does: updates the
+     * latest-sample store, queues the report into its sensor's ring and
+     * invokes the sensor callback, then publishes the IMU snapshot. Used to
+     * replay recorded SH-2 traces without a live sensor feeding them.
+     *
+     * @note Serialized with Update() and the service task by the handler mutex,
+     *       so replay and live reports may share a ring.
+     *
+     * @param event Decoded sensor report
+     * @return SUCCESS, NOT_INITIALIZED or MUTEX_LOCK_FAILED
+     */
+    Bno08xError ReplayEvent(const SensorEvent& event) noexcept;
+
+    // ========================================================================
+    //  LATEST-SAMPLE STORE (wait-free readers)
+    // ========================================================================
+
+    /**
+     * @brief Copy the latest coherent multi-sensor snapshot.
+     *
+     * The snapshot is published at the end of every Update() that decoded at
+     * least one report, so all fields come from the same service pass. Each
+     * field carries its own timestamp and valid flag; @c euler is derived from
+     * @c rotation. Does not take the handler mutex.
+     *
+     * @param data Output snapshot
+     * @return true if a snapshot has been published and was copied consistently
+     */
+    bool GetLatestImuData(Bno08xImuData& data) const noexcept;
+
+    /**
+     * @brief Copy the latest report of a vector sensor without blocking.
+     * @param sensor Accelerometer, Gyroscope, Magnetometer, LinearAcceleration or Gravity
+     * @param vector Output sample
+     * @return true if the sensor has published a sample
+     */
+    bool GetLatestVector(BNO085Sensor sensor, Bno08xVector3& vector) const noexcept;
+
+    /**
+     * @brief Copy the latest report of a rotation sensor without blocking.
+     * @param sensor RotationVector or GameRotationVector
+     * @param quaternion Output sample
+     * @return true if the sensor has published a sample
+     */
+    bool GetLatestQuaternion(BNO085Sensor sensor, Bno08xQuaternion& quaternion) const noexcept;
+
+    /** @brief Number of Bno08xImuData snapshots published so far. */
+    uint32_t GetImuSnapshotCount() const noexcept;
+
+    // ========================================================================
+    //  REPORT RINGS (lock-free batch drain)
+    // ========================================================================
+
+    /**
+     * @brief Drain queued reports of one sensor, oldest first.
+     *
+     * With Bno08xConfig::report_ring_capacity set, Initialize() allocates a
+     * single-producer / single-consumer ring for every enabled vector and
+     * rotation sensor. Every decoded report is queued from the service loop
+     * with its host timestamp; when a ring is full the report is dropped and
+     * counted. Does not take the handler mutex.
+     *
+     * @note One consumer task per sensor.
+     * @note Rings are allocated only at Initialize(), for the sensors enabled
+     *       in Bno08xConfig. A sensor enabled later through GetSensor() still
+     *       updates the latest-sample store and the callback, but queues no
+     *       reports; enable it in the config to get a ring.
+     *
+     * @param sensor Accelerometer, Gyroscope, Magnetometer, LinearAcceleration,
+     *               Gravity, RotationVector or GameRotationVector
+     * @param reports Output array
+     * @param max_count Capacity of @p reports
+     * @return Number of reports copied (0 if empty or the sensor has no ring)
+     */
+    size_t DrainReports(BNO085Sensor sensor, Bno08xReport* reports, size_t max_count) noexcept;
+
+    /**
+     * @brief Get fill and overflow counters of one sensor's ring.
+     * @param sensor Sensor (see DrainReports())
+     * @param stats Output counters
+     * @return true if the sensor has a ring
+     */
+    bool GetReportRingStats(BNO085Sensor sensor, Bno08xReportRingStats& stats) const noexcept;
+
     // ========================================================================
     //  UTILITY METHODS
     // ========================================================================
@@ -600,6 +921,60 @@ public:
     static void QuaternionToEuler(const Bno08xQuaternion& quaternion,
                                   Bno08xEulerAngles& euler_angles) noexcept;
 
+    /**
+     * @brief Convert an array of quaternions to Euler angles.
+     *
+     * Fast mode processes blocks of kEulerBatchBlock quaternions as separate
+     * w/x/y/z lanes with branch-free arithmetic, so the inner loop can be
+     * vectorised and makes no libm calls except sqrt. A tail shorter than a
+     * block (including the single report converted per rotation-vector
+     * event) takes a scalar path with the same arithmetic. Its error against
+     * Exact is at most 1e-5 rad per angle for unit quaternions (measured
+     * 2e-6 rad); the pitch clamp at +/-pi/2 is the same in both modes.
+     * Exact mode gives the same results as QuaternionToEuler().
+     *
+     * Invalid input entries produce outputs with valid == false.
+     *
+     * @param quaternions Input array of @p count entries
+     * @param euler_angles Output array of @p count entries (may not alias the input)
+     * @param count Number of entries
+     * @param mode Exact or Fast
+     */
+    static void QuaternionsToEuler(const Bno08xQuaternion* quaternions,
+                                   Bno08xEulerAngles* euler_angles, size_t count,
+                                   Bno08xEulerMode mode = Bno08xEulerMode::Exact) noexcept;
+
+    /** @brief Quaternions per block in the fast QuaternionsToEuler() path. */
+    static constexpr size_t kEulerBatchBlock = 16;
+
+    /**
+     * @brief Hamilton product @p a * @p b (rotation @p b followed by @p a).
+     * @return Product; valid if both inputs are valid, accuracy is the lower one,
+     *         timestamp the later one
+     */
+    static Bno08xQuaternion QuaternionMultiply(const Bno08xQuaternion& a,
+                                               const Bno08xQuaternion& b) noexcept;
+
+    /**
+     * @brief Scale a quaternion to unit length in place.
+     * @return false (quaternion unchanged) if its norm is zero or not finite
+     */
+    static bool QuaternionNormalize(Bno08xQuaternion& quaternion) noexcept;
+
+    /**
+     * @brief Spherical linear interpolation along the shorter arc.
+     *
+     * Falls back to normalised linear interpolation when the inputs are
+     * closer than ~1.8 degrees. Timestamp is interpolated, accuracy is the
+     * lower one, valid requires both inputs valid.
+     *
+     * @param a Start orientation (t = 0)
+     * @param b End orientation (t = 1)
+     * @param t Interpolation parameter, clamped to [0, 1]
+     */
+    static Bno08xQuaternion QuaternionSlerp(const Bno08xQuaternion& a, const Bno08xQuaternion& b,
+                                            float t) noexcept;
+
     /**
      * @brief Get the communication interface type.
      * @return BNO085Interface::I2C or BNO085Interface::SPI
@@ -607,48 +982,53 @@ public:
     BNO085Interface GetInterfaceType() const noexcept;
 
     /**
-     * @brief Get direct access to the underlying sensor driver (type-erased).
+     * @brief Get direct access to the underlying sensor driver.
      *
-     * The returned pointer exposes the same SH-2 API as the concrete BNO085
+     * The returned driver exposes the same SH-2 API as the concrete BNO085
      * driver: Update(), EnableSensor(), DisableSensor(), SetCallback(),
      * HasNewData(), GetLatest(), GetLastError(), HardwareReset(), etc.
+     * Calls are statically dispatched to the I2C or SPI instantiation.
      * Use it when you need to call driver methods directly (e.g. custom
      * callbacks, low-level control). Valid for the lifetime of this handler.
      *
-     * @return Non-owning pointer to the driver interface, or nullptr if not constructed
+     * @return Non-owning pointer to the driver, or nullptr if initialization failed
      *
      * @warning Raw pointer — NOT mutex-protected. Caller is responsible for
      *          external synchronization in multi-task environments.
      *          Prefer visitDriver() for thread-safe access.
      */
-    IBno08xDriverOps* GetSensor() noexcept;
+    Bno08xDriver* GetSensor() noexcept;
 
     /** @brief Const overload of GetSensor(). */
-    const IBno08xDriverOps* GetSensor() const noexcept;
+    const Bno08xDriver* GetSensor() const noexcept;
 
     /**
      * @brief Naming-consistent alias of GetSensor().
      * @warning Raw pointer — NOT mutex-protected. Prefer visitDriver().
      */
-    IBno08xDriverOps* GetDriver() noexcept { return GetSensor(); }
-    const IBno08xDriverOps* GetDriver() const noexcept { return GetSensor(); }
+    Bno08xDriver* GetDriver() noexcept { return GetSensor(); }
+    const Bno08xDriver* GetDriver() const noexcept { return GetSensor(); }
 
     /**
      * @brief Visit the underlying IMU driver under handler mutex protection.
+     *
+     * @p fn receives the Bno08xDriver; call its Visit() from inside for the
+     * concrete Bno08xDriverImpl<CommType>.
+     *
      * @return Callable result or default-constructed value when driver is unavailable.
      */
     template <typename Fn>
-    auto visitDriver(Fn&& fn) noexcept -> decltype(fn(std::declval<IBno08xDriverOps&>())) {
-        using ReturnType = decltype(fn(std::declval<IBno08xDriverOps&>()));
+    auto visitDriver(Fn&& fn) noexcept -> decltype(fn(std::declval<Bno08xDriver&>())) {
+        using ReturnType = decltype(fn(std::declval<Bno08xDriver&>()));
         MutexLockGuard lock(handler_mutex_);
-        if (!lock.IsLocked() || !ensureInitializedLocked() || !driver_ops_) {
+        if (!lock.IsLocked() || !ensureInitializedLocked()) {
             if constexpr (std::is_void_v<ReturnType>) {
                 return;
             } else {
                 return ReturnType{};
             }
         }
-        return fn(*driver_ops_);
+        return fn(driver_);
     }
 
     /**
@@ -685,15 +1065,38 @@ private:
     //  PRIVATE MEMBERS
     // ========================================================================
 
-    std::unique_ptr<IBno08xDriverOps> driver_ops_; ///< Type-erased driver
+    Bno08xDriver driver_;                          ///< I2C or SPI driver (inline)
     Bno08xConfig config_;                          ///< Current configuration
     mutable RtosMutex handler_mutex_;              ///< Thread safety mutex
     bool initialized_{false};                      ///< Initialization state
     mutable Bno08xError last_error_{Bno08xError::SUCCESS}; ///< Last error
     BNO085Interface interface_type_;               ///< I2C or SPI
-    SensorCallback user_callback_;                 ///< User's sensor callback
+    Bno08xEventCallback user_callback_;            ///< User's sensor callback
     char description_[64]{};                       ///< Description string
 
+    // Latest-sample store: written from Update() only, read by any task.
+    SeqlockSlot<Bno08xVector3> accel_slot_;        ///< Accelerometer
+    SeqlockSlot<Bno08xVector3> gyro_slot_;         ///< Gyroscope
+    SeqlockSlot<Bno08xVector3> mag_slot_;          ///< Magnetometer
+    SeqlockSlot<Bno08xVector3> linear_accel_slot_; ///< Linear acceleration
+    SeqlockSlot<Bno08xVector3> gravity_slot_;      ///< Gravity
+    SeqlockSlot<Bno08xQuaternion> rotation_slot_;  ///< Rotation vector
+    SeqlockSlot<Bno08xQuaternion> game_rotation_slot_; ///< Game rotation vector
+    SeqlockSlot<Bno08xImuData> imu_slot_;          ///< Coherent multi-sensor snapshot
+    Bno08xImuData imu_pending_{};                  ///< Snapshot being assembled (under mutex)
+    bool imu_dirty_{false};                        ///< imu_pending_ changed this Update()
+
+    // Report rings: pushed from Update() only, drained by one consumer per sensor.
+    static constexpr size_t kReportRingSensors = 7;
+    std::array<SpscRing<Bno08xReport>, kReportRingSensors> report_rings_{}; ///< Indexed by reportRingIndex()
+    std::array<uint16_t, kReportRingSensors> report_sequence_{};            ///< Next sequence per ring (under mutex)
+
+    // Interrupt-driven service task
+    BaseGpio* int_gpio_{nullptr};                  ///< INT GPIO (not owned, may be null)
+    Bno08xIntLatch int_latch_;                     ///< INT edge latch shared with the comm adapter
+    std::unique_ptr<Bno08xServiceTask> service_task_; ///< Service task (null when stopped)
+    Bno08xServiceStats service_stats_{};           ///< Service statistics (under mutex)
+
     // ========================================================================
     //  PRIVATE HELPERS
     // ========================================================================
@@ -708,6 +1111,61 @@ private:
      */
     bool applyConfigLocked() noexcept;
 
+    friend class Bno08xServiceTask;
+
+    /** @brief How long StopServiceTask() waits for the task to exit. */
+    static constexpr uint32_t kServiceTaskStopTimeoutMs = 200;
+
+    /**
+     * @brief Internal: run up to @p max_passes SH-2 service passes and publish (assumes mutex is held).
+     */
+    Bno08xError serviceLocked(uint8_t max_passes) noexcept;
+
+    /**
+     * @brief Internal: one service task wakeup (takes the mutex).
+     * @param signalled true if woken by the INT interrupt, false on idle timeout
+     * @param max_passes Drain bound
+     */
+    void serviceWake(bool signalled, uint8_t max_passes) noexcept;
+
+    /**
+     * @brief Internal: INT falling-edge ISR; latches the edge and wakes the task.
+     */
+    static void intEdgeCallback(BaseGpio* gpio, hf_gpio_interrupt_trigger_t trigger,
+                                void* user_data) noexcept;
+
+    /**
+     * @brief Internal: publish a decoded report into the sample store (assumes mutex is held).
+     */
+    void publishEventLocked(const SensorEvent& event) noexcept;
+
+    /**
+     * @brief Internal: publish a report, then forward it to the user callback (assumes mutex is held).
+     */
+    void dispatchEventLocked(const SensorEvent& event) noexcept;
+
+    /**
+     * @brief Internal: seqlock slot of a vector / rotation sensor (nullptr if none).
+     */
+    SeqlockSlot<Bno08xVector3>* vectorSlot(BNO085Sensor sensor) noexcept;
+    SeqlockSlot<Bno08xQuaternion>* quaternionSlot(BNO085Sensor sensor) noexcept;
+
+    /**
+     * @brief Internal: report ring index of a sensor (-1 if it has none).
+     */
+    static int reportRingIndex(BNO085Sensor sensor) noexcept;
+
+    /**
+     * @brief Internal: allocate rings for configured sensors (assumes mutex is held).
+     */
+    void allocateReportRingsLocked() noexcept;
+
+    /**
+     * @brief Internal: queue one report into its sensor's ring (assumes mutex is held).
+     */
+    void pushReportLocked(BNO085Sensor sensor, uint64_t timestamp_us, uint8_t accuracy,
+                          float d0, float d1, float d2, float d3) noexcept;
+
     /**
      * @brief Internal: map SH-2 error code to Bno08xError.
      */
@@ -0,0 +1,153 @@
+/**
+ * @file GpioPinRegistry.h
+ * @brief Fixed-size store of a handler's GPIO pin wrappers, heap-owned or pooled.
+ *
+ * @details
+ * I/O expander handlers (PCAL95555, PCA9685) create one BaseGpio wrapper per
+ * pin on demand and hand it out to managers as shared_ptr<BaseGpio>.
+ * GpioPinRegistry keeps those wrappers with one of two storage policies,
+ * chosen at compile time so a registry only carries the array it uses:
+ *
+ * - **GpioPinStorage::kOwned (default)**: each wrapper is allocated with
+ *   make_shared. The handles returned by Share() co-own the wrapper, so they
+ *   stay valid after Clear() (e.g. on handler deinitialization).
+ * - **GpioPinStorage::kPooled**: wrappers are constructed in place in an
+ *   inline array, so creating them never touches the heap. Share() then
+ *   returns an aliasing shared_ptr without a control block: copies do no
+ *   atomic reference counting, but the handle dangles once Clear() runs or
+ *   the registry is destroyed.
+ *
+ * The expander handlers use kDefaultGpioPinStorage, which is kPooled when the
+ * build defines HARDFOC_EXPANDER_PIN_POOL (HF_CORE_EXPANDER_PIN_POOL=ON).
+ *
+ * @code
+ * GpioPinRegistry<Pcal95555GpioPin, 16, GpioPinStorage::kPooled> pins;
+ * Pcal95555GpioPin* pin = pins.Emplace(3, 3, this, ...);
+ * std::shared_ptr<BaseGpio> handle = pins.Share(3);
+ * @endcode
+ *
+ * Not thread-safe; the owning handler serializes access with its mutex.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "base/BaseGpio.h"
+
+/** @brief Where a GpioPinRegistry keeps its wrappers. */
+enum class GpioPinStorage : uint8_t {
+    kOwned,   ///< make_shared per wrapper; handles co-own it
+    kPooled   ///< Inline array; handles are non-owning aliases
+};
+
+/** @brief Storage used by the expander handlers' registries (build option). */
+#if defined(HARDFOC_EXPANDER_PIN_POOL)
+inline constexpr GpioPinStorage kDefaultGpioPinStorage = GpioPinStorage::kPooled;
+#else
+inline constexpr GpioPinStorage kDefaultGpioPinStorage = GpioPinStorage::kOwned;
+#endif
+
+/**
+ * @class GpioPinRegistry
+ * @brief N pin wrapper slots of type Pin (a BaseGpio), heap-owned or pooled inline.
+ * @tparam Pin     Wrapper type derived from BaseGpio
+ * @tparam N       Number of slots
+ * @tparam Storage Storage policy
+ */
+template <typename Pin, std::size_t N, GpioPinStorage Storage = kDefaultGpioPinStorage>
+class GpioPinRegistry {
+public:
+    /** @brief Number of slots. */
+    static constexpr std::size_t kSize = N;
+
+    /** @brief True for GpioPinStorage::kPooled. */
+    static constexpr bool kPooled = (Storage == GpioPinStorage::kPooled);
+
+    /** @brief Whether wrappers are constructed in the inline pool. */
+    [[nodiscard]] static constexpr bool IsPooled() noexcept { return kPooled; }
+
+    /**
+     * @brief Construct the wrapper of slot @p index (replacing any existing one).
+     * @return The new wrapper
+     */
+    template <typename... Args>
+    Pin* Emplace(std::size_t index, Args&&... args) noexcept {
+        if constexpr (kPooled) {
+            slots_[index].emplace(std::forward<Args>(args)...);
+        } else {
+            slots_[index] = std::make_shared<Pin>(std::forward<Args>(args)...);
+            ++heap_allocations_;
+        }
+        return &*slots_[index];
+    }
+
+    /** @brief Wrapper of slot @p index, or nullptr. */
+    [[nodiscard]] Pin* Get(std::size_t index) noexcept {
+        return slots_[index] ? &*slots_[index] : nullptr;
+    }
+
+    /** @brief Wrapper of slot @p index, or nullptr. */
+    [[nodiscard]] const Pin* Get(std::size_t index) const noexcept {
+        return slots_[index] ? &*slots_[index] : nullptr;
+    }
+
+    /** @brief Whether slot @p index holds a wrapper. */
+    [[nodiscard]] bool Has(std::size_t index) const noexcept { return static_cast<bool>(slots_[index]); }
+
+    /**
+     * @brief Handle to the wrapper of slot @p index, or nullptr.
+     *
+     * kOwned: shares ownership. kPooled: non-owning alias, valid until
+     * Clear() or destruction of the registry.
+     */
+    [[nodiscard]] std::shared_ptr<BaseGpio> Share(std::size_t index) noexcept {
+        if constexpr (kPooled) {
+            Pin* pin = Get(index);
+            return pin != nullptr ? std::shared_ptr<BaseGpio>(std::shared_ptr<BaseGpio>(), pin) : nullptr;
+        } else {
+            return slots_[index];
+        }
+    }
+
+    /** @brief Drop the wrapper of slot @p index (kOwned: outstanding handles keep it alive). */
+    void Reset(std::size_t index) noexcept { slots_[index].reset(); }
+
+    /** @brief Drop every wrapper. */
+    void Clear() noexcept {
+        for (std::size_t i = 0; i < N; ++i) {
+            Reset(i);
+        }
+    }
+
+    /** @brief Number of slots holding a wrapper. */
+    [[nodiscard]] std::size_t Count() const noexcept {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            count += Has(i) ? 1U : 0U;
+        }
+        return count;
+    }
+
+    /** @brief Wrappers allocated with make_shared since construction (always 0 when pooled). */
+    [[nodiscard]] uint32_t GetHeapAllocations() const noexcept { return heap_allocations_; }
+
+    /** @brief Bytes reserved inline for the slots. */
+    static constexpr std::size_t SlotBytes() noexcept { return sizeof(std::array<Slot, N>); }
+
+private:
+    using Slot = std::conditional_t<kPooled, std::optional<Pin>, std::shared_ptr<Pin>>;
+
+    std::array<Slot, N> slots_{};    ///< Wrappers (inline or heap-owned, per Storage)
+    uint32_t heap_allocations_ = 0;  ///< make_shared calls
+};
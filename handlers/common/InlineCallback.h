@@ -0,0 +1,120 @@
+/**
+ * @file InlineCallback.h
+ * @brief Allocation-free, fixed-capacity callable wrapper.
+ *
+ * @details
+ * InlineCallback stores a small callable (function pointer, or a lambda
+ * capturing a few pointers / scalars) directly inside the object and calls
+ * it through one plain function pointer. Unlike std::function it never
+ * allocates, is trivially copyable, and rejects oversized or non-trivial
+ * captures at compile time instead of silently moving them to the heap.
+ *
+ * @code
+ * InlineCallback<void(const SensorEvent&)> cb = [this](const SensorEvent& e) { onEvent(e); };
+ * if (cb) cb(event);
+ *
+ * // C-style registration
+ * InlineCallback<void(const SensorEvent&)> cb2(&OnEvent, context);
+ * @endcode
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template <typename Signature, std::size_t Capacity = 2 * sizeof(void*)>
+class InlineCallback;
+
+/**
+ * @class InlineCallback
+ * @brief Non-allocating callable holding at most @p Capacity bytes of state.
+ *
+ * @tparam R Return type.
+ * @tparam Args Argument types.
+ * @tparam Capacity Inline storage in bytes (default: two pointers).
+ *
+ * @note Stored callables must be trivially copyable and trivially
+ *       destructible, so a copy is a plain memcpy and nothing is released.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class InlineCallback<R(Args...), Capacity> {
+public:
+    /** @brief C-style callback receiving an opaque context pointer first. */
+    using ContextFn = R (*)(void* context, Args... args);
+
+    /** @brief Empty callback. */
+    InlineCallback() noexcept = default;
+
+    /** @brief Empty callback. */
+    InlineCallback(std::nullptr_t) noexcept {}
+
+    /**
+     * @brief Wrap a function pointer and its context.
+     * @param fn Function to call (nullptr gives an empty callback)
+     * @param context Passed as the first argument of @p fn
+     */
+    InlineCallback(ContextFn fn, void* context) noexcept {
+        if (fn != nullptr) {
+            Store(ContextCall{fn, context});
+        }
+    }
+
+    /**
+     * @brief Wrap a callable stored inline.
+     *
+     * A null function pointer or member pointer gives an empty callback.
+     * @tparam F Trivially copyable callable no larger than @p Capacity.
+     */
+    template <typename F,
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineCallback> &&
+                                          std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    InlineCallback(F&& fn) noexcept {
+        using Fn = std::decay_t<F>;
+        Fn callable(std::forward<F>(fn));
+        if constexpr (std::is_pointer_v<Fn> || std::is_member_pointer_v<Fn>) {
+            if (callable == nullptr) {
+                return;
+            }
+        }
+        Store(callable);
+    }
+
+    /** @brief Whether a callable is stored. */
+    explicit operator bool() const noexcept { return invoke_ != nullptr; }
+
+    /** @brief Invoke the stored callable (must not be empty). */
+    R operator()(Args... args) const {
+        return invoke_(storage_, std::forward<Args>(args)...);
+    }
+
+private:
+    struct ContextCall {
+        ContextFn fn;
+        void* context;
+        R operator()(Args... args) const { return fn(context, std::forward<Args>(args)...); }
+    };
+
+    template <typename F>
+    void Store(F fn) noexcept {
+        static_assert(sizeof(F) <= Capacity, "Callable state exceeds InlineCallback capacity");
+        static_assert(alignof(F) <= alignof(std::max_align_t), "Callable over-aligned for InlineCallback");
+        static_assert(std::is_trivially_copyable_v<F> && std::is_trivially_destructible_v<F>,
+                      "InlineCallback only stores trivially copyable callables");
+        ::new (static_cast<void*>(storage_)) F(fn);
+        invoke_ = [](const void* storage, Args... args) -> R {
+            return std::invoke(*static_cast<F*>(const_cast<void*>(storage)), std::forward<Args>(args)...);
+        };
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[Capacity]{};  ///< Inline callable state
+    R (*invoke_)(const void*, Args...) = nullptr;                  ///< Trampoline (null = empty)
+};
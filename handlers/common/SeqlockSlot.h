@@ -0,0 +1,118 @@
+/**
+ * @file SeqlockSlot.h
+ * @brief Single-writer / multi-reader sequence-locked value slot.
+ *
+ * @details
+ * A SeqlockSlot publishes a trivially copyable value from one writer task to
+ * any number of readers without a mutex. The writer never blocks; a reader
+ * copies the value and retries only if a write overlapped its copy, so read
+ * latency depends on the size of T and not on what the writer is doing
+ * (e.g. holding a bus for an I2C transfer).
+ *
+ * The payload is kept in relaxed atomic words, so concurrent copies are
+ * well-defined C++ rather than a benign data race.
+ *
+ * @code
+ * SeqlockSlot<Bno08xVector3> slot;
+ * slot.Store(sample);                  // writer task only
+ *
+ * Bno08xVector3 latest{};
+ * if (slot.Load(latest)) { ... }       // any task, never blocks
+ * @endcode
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @class SeqlockSlot
+ * @brief Wait-free writer, lock-free reader slot holding one value of type T.
+ *
+ * @tparam T Trivially copyable payload.
+ *
+ * @note Exactly one task may call Store(). Load() may be called from any task.
+ */
+template <typename T>
+class SeqlockSlot {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqlockSlot payload must be trivially copyable");
+
+public:
+    /** @brief Read attempts Load() makes before giving up. */
+    static constexpr uint32_t kDefaultMaxRetries = 8;
+
+    SeqlockSlot() noexcept = default;
+
+    SeqlockSlot(const SeqlockSlot&) = delete;
+    SeqlockSlot& operator=(const SeqlockSlot&) = delete;
+
+    /**
+     * @brief Publish a new value (single writer).
+     * @param value Value to publish.
+     */
+    void Store(const T& value) noexcept {
+        std::array<uint32_t, kWords> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        const uint32_t seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1U, std::memory_order_relaxed);   // odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < kWords; ++i) {
+            words_[i].store(words[i], std::memory_order_relaxed);
+        }
+        sequence_.store(seq + 2U, std::memory_order_release);   // even: stable
+    }
+
+    /**
+     * @brief Copy the latest value.
+     * @param value Output value (unchanged on failure).
+     * @param max_retries Attempts before giving up when writes keep overlapping.
+     * @return true if a value has been published and a consistent copy was taken.
+     */
+    bool Load(T& value, uint32_t max_retries = kDefaultMaxRetries) const noexcept {
+        std::array<uint32_t, kWords> words{};
+        for (uint32_t attempt = 0; attempt <= max_retries; ++attempt) {
+            const uint32_t before = sequence_.load(std::memory_order_acquire);
+            if (before == 0) {
+                return false;  // Nothing published yet
+            }
+            if (before & 1U) {
+                continue;      // Writer mid-update
+            }
+            for (std::size_t i = 0; i < kWords; ++i) {
+                words[i] = words_[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) {
+                std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** @brief Number of completed Store() calls. */
+    [[nodiscard]] uint32_t GetPublishCount() const noexcept {
+        return sequence_.load(std::memory_order_acquire) / 2U;
+    }
+
+    /** @brief Whether any value has been published. */
+    [[nodiscard]] bool HasValue() const noexcept {
+        return sequence_.load(std::memory_order_acquire) >= 2U;
+    }
+
+private:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(uint32_t) - 1U) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> sequence_{0};                  ///< Even = stable, odd = write in progress
+    std::array<std::atomic<uint32_t>, kWords> words_{};  ///< Payload storage
+};
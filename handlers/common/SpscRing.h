@@ -0,0 +1,160 @@
+/**
+ * @file SpscRing.h
+ * @brief Lock-free single-producer / single-consumer ring of fixed-size records.
+ *
+ * @details
+ * The producer (typically a driver service loop) pushes records without
+ * blocking; the consumer drains them in batches from another task. When the
+ * ring is full the newest record is dropped and counted, so a slow consumer
+ * never stalls the producer.
+ *
+ * Storage is allocated once by Allocate() and kept until destruction, so a
+ * consumer can never observe it being freed while the producer runs.
+ *
+ * @code
+ * SpscRing<Report> ring;
+ * ring.Allocate(64);                   // rounded up to a power of two
+ *
+ * ring.Push(report);                   // producer task only
+ *
+ * Report batch[16];
+ * size_t n = ring.PopBatch(batch, 16); // consumer task only
+ * @endcode
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+/**
+ * @class SpscRing
+ * @brief Bounded lock-free ring with one producer and one consumer.
+ *
+ * @tparam T Trivially copyable record type.
+ *
+ * @note Push() must only be called from one task and PopBatch()/Pop() from
+ *       one (other) task. Statistics may be read from anywhere.
+ */
+template <typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing records must be trivially copyable");
+
+public:
+    /** @brief Largest supported capacity. */
+    static constexpr uint32_t kMaxCapacity = 1U << 15;
+
+    SpscRing() noexcept = default;
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * @brief Allocate storage (once, before producer and consumer start).
+     * @param capacity Requested depth; rounded up to a power of two, at most kMaxCapacity.
+     * @return true if storage is allocated (also if it already was).
+     */
+    bool Allocate(uint32_t capacity) noexcept {
+        if (buffer_) {
+            return true;
+        }
+        if (capacity == 0 || capacity > kMaxCapacity) {
+            return false;
+        }
+        uint32_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        buffer_.reset(new (std::nothrow) T[size]);
+        if (!buffer_) {
+            return false;
+        }
+        mask_ = size - 1U;
+        return true;
+    }
+
+    /** @brief Whether storage has been allocated. */
+    [[nodiscard]] bool IsAllocated() const noexcept { return buffer_ != nullptr; }
+
+    /** @brief Capacity in records (0 if not allocated). */
+    [[nodiscard]] uint32_t Capacity() const noexcept { return buffer_ ? mask_ + 1U : 0U; }
+
+    /**
+     * @brief Append a record (producer only).
+     * @param record Record to copy in.
+     * @return false if the ring is full or unallocated (the record is dropped and counted).
+     */
+    bool Push(const T& record) noexcept {
+        if (!buffer_) {
+            return false;
+        }
+        const uint32_t head = head_.load(std::memory_order_relaxed);
+        const uint32_t used = head - tail_.load(std::memory_order_acquire);
+        if (used > mask_) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        buffer_[head & mask_] = record;
+        head_.store(head + 1U, std::memory_order_release);
+
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+        if (used + 1U > high_water_.load(std::memory_order_relaxed)) {
+            high_water_.store(used + 1U, std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Remove up to @p max_count records, oldest first (consumer only).
+     * @param out Destination array.
+     * @param max_count Capacity of @p out.
+     * @return Number of records copied.
+     */
+    size_t PopBatch(T* out, size_t max_count) noexcept {
+        if (!buffer_ || out == nullptr) {
+            return 0;
+        }
+        const uint32_t tail = tail_.load(std::memory_order_relaxed);
+        const uint32_t available = head_.load(std::memory_order_acquire) - tail;
+        const uint32_t count = available < max_count ? available : static_cast<uint32_t>(max_count);
+        for (uint32_t i = 0; i < count; ++i) {
+            out[i] = buffer_[(tail + i) & mask_];
+        }
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /** @brief Remove one record (consumer only). @return false if empty. */
+    bool Pop(T& out) noexcept { return PopBatch(&out, 1) == 1; }
+
+    /** @brief Records currently queued (approximate while both sides run). */
+    [[nodiscard]] uint32_t Size() const noexcept {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    /** @brief Records accepted by Push(). */
+    [[nodiscard]] uint32_t GetPushedCount() const noexcept { return pushed_.load(std::memory_order_relaxed); }
+
+    /** @brief Records dropped because the ring was full. */
+    [[nodiscard]] uint32_t GetDroppedCount() const noexcept { return dropped_.load(std::memory_order_relaxed); }
+
+    /** @brief Highest fill level seen by the producer. */
+    [[nodiscard]] uint32_t GetHighWater() const noexcept { return high_water_.load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<T[]> buffer_;               ///< Record storage (power-of-two size)
+    uint32_t mask_ = 0;                         ///< Capacity - 1
+    std::atomic<uint32_t> head_{0};             ///< Next write index (producer)
+    std::atomic<uint32_t> tail_{0};             ///< Next read index (consumer)
+    std::atomic<uint32_t> pushed_{0};           ///< Accepted records
+    std::atomic<uint32_t> dropped_{0};          ///< Records lost to a full ring
+    std::atomic<uint32_t> high_water_{0};       ///< Peak fill level
+};
@@ -0,0 +1,451 @@
+/**
+ * @file TemperatureSamplingScheduler.cpp
+ * @brief Implementation of the shared temperature sampling task.
+ *
+ * @see TemperatureSamplingScheduler.h for architectural overview and Doxygen documentation.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#include "TemperatureSamplingScheduler.h"
+#include "handlers/logger/Logger.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/OsUtility.h"
+
+static const char* TAG = "TempSampling";
+
+namespace {
+
+/// Single-writer maximum update for statistics read concurrently.
+inline void StoreMax(std::atomic<uint32_t>& target, uint32_t value) noexcept {
+    if (value > target.load(std::memory_order_relaxed)) {
+        target.store(value, std::memory_order_relaxed);
+    }
+}
+
+inline uint32_t Load(const std::atomic<uint32_t>& value) noexcept {
+    return value.load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+// =====================================================================
+// Construction
+// =====================================================================
+
+TemperatureSamplingScheduler::TemperatureSamplingScheduler(uint32_t tick_ms, uint32_t priority) noexcept
+    : BaseThread("TempSampling"),
+      tick_ms_(tick_ms == 0 ? 1U : tick_ms),
+      tick_us_((tick_ms == 0 ? 1U : tick_ms) * 1000U),
+      priority_(priority) {
+    buckets_.fill(kNone);
+}
+
+// =====================================================================
+// Registration
+// =====================================================================
+
+hf_temp_err_t TemperatureSamplingScheduler::AddSensor(const TemperatureSamplingSensorConfig& config,
+                                                      hf_u32_t* sensor_id) noexcept {
+    if (sensor_id == nullptr || config.sensor == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+    if (config.period_ms == 0) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+
+    MutexLockGuard lock(mutex_);
+    for (uint8_t slot = 0; slot < kMaxSensors; ++slot) {
+        SensorSlot& s = slots_[slot];
+        if (s.id.load(std::memory_order_relaxed) != 0 ||
+            (retiring_.load(std::memory_order_acquire) & (1U << slot)) != 0) {
+            continue;
+        }
+
+        // A free slot is never touched by the task (see RemoveSensor()), so
+        // the plain fields can be written before the ID publishes them.
+        s.sensor = config.sensor;
+        s.callback = config.callback;
+        s.user_data = config.user_data;
+        s.batch_acquire = config.batch_acquire;
+        s.batch_context = config.batch_context;
+        s.period_ticks = (config.period_ms + tick_ms_ - 1U) / tick_ms_;
+        s.stats.samples.store(0, std::memory_order_relaxed);
+        s.stats.read_failures.store(0, std::memory_order_relaxed);
+        s.stats.deadline_misses.store(0, std::memory_order_relaxed);
+        s.stats.skipped_periods.store(0, std::memory_order_relaxed);
+        s.stats.last_lateness_us.store(0, std::memory_order_relaxed);
+        s.stats.max_lateness_us.store(0, std::memory_order_relaxed);
+        s.stats.last_read_us.store(0, std::memory_order_relaxed);
+        s.stats.max_read_us.store(0, std::memory_order_relaxed);
+
+        // The generation makes IDs of a reused slot distinct from stale ones.
+        s.generation = (s.generation + 1U) & 0x00FFFFFFU;
+        const hf_u32_t id = (s.generation << 8) | (static_cast<hf_u32_t>(slot) + 1U);
+        s.id.store(id, std::memory_order_release);
+        pending_inserts_.fetch_or(1U << slot, std::memory_order_release);
+        ++sensor_count_;
+
+        *sensor_id = id;
+        return TEMP_SUCCESS;
+    }
+    return TEMP_ERR_OUT_OF_MEMORY;
+}
+
+hf_temp_err_t TemperatureSamplingScheduler::RemoveSensor(hf_u32_t sensor_id) noexcept {
+    uint32_t slot_bit = 0;
+    {
+        MutexLockGuard lock(mutex_);
+        if (ResolveSlot(sensor_id) == nullptr) {
+            return TEMP_ERR_INVALID_PARAMETER;
+        }
+        slot_bit = 1U << SlotFromId(sensor_id);
+
+        // Retire the ID. The slot stays reserved until the wait below is over,
+        // so AddSensor() cannot rewrite fields an in-flight read still uses.
+        retiring_.fetch_or(slot_bit, std::memory_order_relaxed);
+        slots_[SlotFromId(sensor_id)].id.store(0, std::memory_order_seq_cst);
+        --sensor_count_;
+    }
+
+    // Wait out a read that already claimed the ID, without holding mutex_, so a
+    // reading callback that registers or removes other sensors cannot deadlock.
+    // Both sides use sequentially consistent accesses: either the task sees the
+    // cleared ID and skips the sensor, or this loop sees active_id_ and waits.
+    while (active_id_.load(std::memory_order_seq_cst) == sensor_id) {
+        os_delay_msec(1);
+    }
+    retiring_.fetch_and(~slot_bit, std::memory_order_release);
+    // The wheel node is dropped lazily when it next comes due.
+    return TEMP_SUCCESS;
+}
+
+uint8_t TemperatureSamplingScheduler::GetSensorCount() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return sensor_count_;
+}
+
+const TemperatureSamplingScheduler::SensorSlot*
+TemperatureSamplingScheduler::ResolveSlot(hf_u32_t sensor_id) const noexcept {
+    if ((sensor_id & 0xFFU) == 0 || (sensor_id & 0xFFU) > kMaxSensors) {
+        return nullptr;
+    }
+    const SensorSlot& s = slots_[SlotFromId(sensor_id)];
+    return s.id.load(std::memory_order_acquire) == sensor_id ? &s : nullptr;
+}
+
+// =====================================================================
+// Sampling Task
+// =====================================================================
+
+bool TemperatureSamplingScheduler::Initialize() noexcept {
+    return CreateBaseThread(stack_, sizeof(stack_), priority_, 5, 0, OS_AUTO_START);
+}
+
+bool TemperatureSamplingScheduler::Setup() noexcept {
+    // Rebuild the wheel from the registrations so a restarted task starts clean.
+    buckets_.fill(kNone);
+    uint32_t registered = 0;
+    for (uint8_t slot = 0; slot < kMaxSensors; ++slot) {
+        nodes_[slot] = WheelNode{};
+        if (slots_[slot].id.load(std::memory_order_acquire) != 0) {
+            registered |= 1U << slot;
+        }
+    }
+    start_us_ = RtosTime::GetCurrentTimeUs();
+    next_tick_ = 0;
+    pending_inserts_.fetch_or(registered, std::memory_order_release);
+    return true;
+}
+
+uint32_t TemperatureSamplingScheduler::Step() noexcept {
+    const uint64_t now_us = RtosTime::GetCurrentTimeUs();
+    const auto now_tick = static_cast<uint32_t>((now_us - start_us_) / tick_us_);
+
+    ApplyPendingInserts();
+
+    if (TickReached(next_tick_, now_tick)) {
+        ticks_.fetch_add(now_tick - next_tick_ + 1U, std::memory_order_relaxed);
+        const uint8_t due_count = CollectDue(next_tick_, now_tick);
+        next_tick_ = now_tick + 1U;
+
+        if (due_count != 0) {
+            SampleGroup(due_count, now_tick);
+
+            const auto work_us = static_cast<uint32_t>(RtosTime::GetCurrentTimeUs() - now_us);
+            busy_ticks_.fetch_add(1, std::memory_order_relaxed);
+            last_work_us_.store(work_us, std::memory_order_relaxed);
+            StoreMax(max_work_us_, work_us);
+            StoreMax(max_due_per_wakeup_, due_count);
+            if (work_us > tick_us_) {
+                overruns_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Sleep until the start of the next tick (rounded up to whole milliseconds).
+    const uint64_t next_us = start_us_ + static_cast<uint64_t>(next_tick_) * tick_us_;
+    const uint64_t after_us = RtosTime::GetCurrentTimeUs();
+    return next_us > after_us ? static_cast<uint32_t>((next_us - after_us + 999U) / 1000U) : 0U;
+}
+
+bool TemperatureSamplingScheduler::Cleanup() noexcept {
+    return true;
+}
+
+bool TemperatureSamplingScheduler::ResetVariables() noexcept {
+    return true;
+}
+
+// =====================================================================
+// Timing Wheel
+// =====================================================================
+
+void TemperatureSamplingScheduler::ApplyPendingInserts() noexcept {
+    const uint32_t pending = pending_inserts_.exchange(0, std::memory_order_acquire);
+    if (pending == 0) {
+        return;
+    }
+
+    for (uint8_t slot = 0; slot < kMaxSensors; ++slot) {
+        if ((pending & (1U << slot)) == 0) {
+            continue;
+        }
+        // The slot may still carry the node of a removed registration.
+        Unlink(slot);
+
+        const hf_u32_t id = slots_[slot].id.load(std::memory_order_acquire);
+        if (id == 0) {
+            continue;
+        }
+        // Align the first sample to a multiple of the period so sensors
+        // sharing a period land in the same tick and can be batched.
+        const uint32_t period = slots_[slot].period_ticks;
+        nodes_[slot].id = id;
+        nodes_[slot].due_tick = ((next_tick_ + period - 1U) / period) * period;
+        Link(slot);
+    }
+}
+
+void TemperatureSamplingScheduler::Link(uint8_t slot) noexcept {
+    WheelNode& node = nodes_[slot];
+    int8_t& head = buckets_[node.due_tick & kWheelMask];
+    node.next = head;
+    head = static_cast<int8_t>(slot);
+    node.linked = true;
+}
+
+void TemperatureSamplingScheduler::Unlink(uint8_t slot) noexcept {
+    WheelNode& node = nodes_[slot];
+    if (!node.linked) {
+        return;
+    }
+    int8_t* link = &buckets_[node.due_tick & kWheelMask];
+    while (*link != kNone) {
+        if (*link == static_cast<int8_t>(slot)) {
+            *link = node.next;
+            break;
+        }
+        link = &nodes_[static_cast<uint8_t>(*link)].next;
+    }
+    node.next = kNone;
+    node.linked = false;
+}
+
+uint8_t TemperatureSamplingScheduler::CollectDue(uint32_t first_tick, uint32_t last_tick) noexcept {
+    // After a long stall one pass over every bucket finds all overdue nodes.
+    if (last_tick - first_tick >= kWheelSlots) {
+        first_tick = last_tick - kWheelSlots + 1U;
+    }
+
+    uint8_t count = 0;
+    for (uint32_t tick = first_tick; TickReached(tick, last_tick); ++tick) {
+        int8_t* link = &buckets_[tick & kWheelMask];
+        while (*link != kNone) {
+            const auto slot = static_cast<uint8_t>(*link);
+            WheelNode& node = nodes_[slot];
+            if (TickReached(node.due_tick, last_tick)) {
+                // Due now (or overdue): detach; entries for later rotations stay.
+                *link = node.next;
+                node.next = kNone;
+                node.linked = false;
+                due_[count++] = slot;
+            } else {
+                link = &node.next;
+            }
+        }
+    }
+    return count;
+}
+
+void TemperatureSamplingScheduler::SampleGroup(uint8_t due_count, uint32_t now_tick) noexcept {
+    std::array<void*, kMaxSensors> acquired{};
+    uint8_t acquired_count = 0;
+
+    for (uint8_t i = 0; i < due_count; ++i) {
+        const uint8_t slot = due_[i];
+        WheelNode& node = nodes_[slot];
+        SensorSlot& s = slots_[slot];
+
+        // Claim the ID before re-checking it (pairs with RemoveSensor()).
+        active_id_.store(node.id, std::memory_order_seq_cst);
+        if (s.id.load(std::memory_order_seq_cst) != node.id) {
+            // Removed or replaced: drop the stale node.
+            active_id_.store(0, std::memory_order_release);
+            continue;
+        }
+
+        if (s.batch_acquire != nullptr) {
+            bool shared = false;
+            for (uint8_t b = 0; b < acquired_count; ++b) {
+                if (acquired[b] == s.batch_context) {
+                    shared = true;
+                    break;
+                }
+            }
+            if (shared) {
+                batched_reads_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                acquired[acquired_count++] = s.batch_context;
+                batch_acquires_.fetch_add(1, std::memory_order_relaxed);
+                if (s.batch_acquire(s.batch_context) != TEMP_SUCCESS) {
+                    batch_failures_.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+
+        const uint64_t read_start_us = RtosTime::GetCurrentTimeUs();
+        const uint64_t due_us = start_us_ + static_cast<uint64_t>(node.due_tick) * tick_us_;
+        const auto lateness_us = static_cast<uint32_t>(read_start_us > due_us ? read_start_us - due_us : 0U);
+
+        hf_temp_reading_t reading = {};
+        const hf_temp_err_t err = s.sensor->ReadTemperature(&reading);
+        if (s.callback != nullptr) {
+            s.callback(s.sensor, &reading, s.user_data);
+        }
+
+        const auto read_us = static_cast<uint32_t>(RtosTime::GetCurrentTimeUs() - read_start_us);
+        const uint32_t period = s.period_ticks;
+        active_id_.store(0, std::memory_order_release);
+
+        s.stats.samples.fetch_add(1, std::memory_order_relaxed);
+        if (err != TEMP_SUCCESS) {
+            s.stats.read_failures.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (lateness_us >= tick_us_) {
+            s.stats.deadline_misses.fetch_add(1, std::memory_order_relaxed);
+        }
+        s.stats.last_lateness_us.store(lateness_us, std::memory_order_relaxed);
+        StoreMax(s.stats.max_lateness_us, lateness_us);
+        s.stats.last_read_us.store(read_us, std::memory_order_relaxed);
+        StoreMax(s.stats.max_read_us, read_us);
+
+        // Reschedule on the original grid; periods already in the past are
+        // dropped rather than sampled back to back.
+        uint32_t next_due = node.due_tick + period;
+        if (TickReached(next_due, now_tick)) {
+            const uint32_t missed = (now_tick - next_due) / period + 1U;
+            s.stats.skipped_periods.fetch_add(missed, std::memory_order_relaxed);
+            next_due += missed * period;
+        }
+        node.due_tick = next_due;
+        Link(slot);
+    }
+}
+
+// =====================================================================
+// Statistics
+// =====================================================================
+
+hf_temp_err_t TemperatureSamplingScheduler::GetSensorStats(hf_u32_t sensor_id,
+                                                           TemperatureSamplingStats* stats) const noexcept {
+    if (stats == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+    const SensorSlot* s = ResolveSlot(sensor_id);
+    if (s == nullptr) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+    stats->samples = Load(s->stats.samples);
+    stats->read_failures = Load(s->stats.read_failures);
+    stats->deadline_misses = Load(s->stats.deadline_misses);
+    stats->skipped_periods = Load(s->stats.skipped_periods);
+    stats->last_lateness_us = Load(s->stats.last_lateness_us);
+    stats->max_lateness_us = Load(s->stats.max_lateness_us);
+    stats->last_read_us = Load(s->stats.last_read_us);
+    stats->max_read_us = Load(s->stats.max_read_us);
+    return TEMP_SUCCESS;
+}
+
+TemperatureSchedulerStats TemperatureSamplingScheduler::GetStats() const noexcept {
+    TemperatureSchedulerStats stats;
+    stats.ticks = Load(ticks_);
+    stats.busy_ticks = Load(busy_ticks_);
+    stats.overruns = Load(overruns_);
+    stats.batch_acquires = Load(batch_acquires_);
+    stats.batch_failures = Load(batch_failures_);
+    stats.batched_reads = Load(batched_reads_);
+    stats.max_due_per_wakeup = Load(max_due_per_wakeup_);
+    stats.last_work_us = Load(last_work_us_);
+    stats.max_work_us = Load(max_work_us_);
+    return stats;
+}
+
+void TemperatureSamplingScheduler::ResetStats() noexcept {
+    for (auto* counter : {&ticks_, &busy_ticks_, &overruns_, &batch_acquires_, &batch_failures_,
+                          &batched_reads_, &max_due_per_wakeup_, &last_work_us_, &max_work_us_}) {
+        counter->store(0, std::memory_order_relaxed);
+    }
+    for (SensorSlot& s : slots_) {
+        for (auto* counter : {&s.stats.samples, &s.stats.read_failures, &s.stats.deadline_misses,
+                              &s.stats.skipped_periods, &s.stats.last_lateness_us,
+                              &s.stats.max_lateness_us, &s.stats.last_read_us, &s.stats.max_read_us}) {
+            counter->store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void TemperatureSamplingScheduler::DumpDiagnostics() const noexcept {
+    Logger::GetInstance().Info(TAG, "=== TEMPERATURE SAMPLING SCHEDULER DIAGNOSTICS ===");
+
+    const TemperatureSchedulerStats stats = GetStats();
+    Logger::GetInstance().Info(TAG, "  Tick: %u ms  Sensors: %u/%u",
+                               static_cast<unsigned>(tick_ms_),
+                               static_cast<unsigned>(GetSensorCount()),
+                               static_cast<unsigned>(kMaxSensors));
+    Logger::GetInstance().Info(TAG, "  Ticks: %u  Busy: %u  Overruns: %u  Work(us) last=%u max=%u  Max Group: %u",
+                               static_cast<unsigned>(stats.ticks),
+                               static_cast<unsigned>(stats.busy_ticks),
+                               static_cast<unsigned>(stats.overruns),
+                               static_cast<unsigned>(stats.last_work_us),
+                               static_cast<unsigned>(stats.max_work_us),
+                               static_cast<unsigned>(stats.max_due_per_wakeup));
+    Logger::GetInstance().Info(TAG, "  Batch Acquires: %u  Failures: %u  Shared Reads: %u",
+                               static_cast<unsigned>(stats.batch_acquires),
+                               static_cast<unsigned>(stats.batch_failures),
+                               static_cast<unsigned>(stats.batched_reads));
+
+    for (uint8_t slot = 0; slot < kMaxSensors; ++slot) {
+        const SensorSlot& s = slots_[slot];
+        const hf_u32_t id = s.id.load(std::memory_order_acquire);
+        if (id == 0) {
+            continue;
+        }
+        Logger::GetInstance().Info(TAG,
+                                   "  [%u] id=0x%08x period=%u ms samples=%u fail=%u misses=%u skipped=%u "
+                                   "late(us) last=%u max=%u read(us) last=%u max=%u",
+                                   static_cast<unsigned>(slot), static_cast<unsigned>(id),
+                                   static_cast<unsigned>(s.period_ticks * tick_ms_),
+                                   static_cast<unsigned>(Load(s.stats.samples)),
+                                   static_cast<unsigned>(Load(s.stats.read_failures)),
+                                   static_cast<unsigned>(Load(s.stats.deadline_misses)),
+                                   static_cast<unsigned>(Load(s.stats.skipped_periods)),
+                                   static_cast<unsigned>(Load(s.stats.last_lateness_us)),
+                                   static_cast<unsigned>(Load(s.stats.max_lateness_us)),
+                                   static_cast<unsigned>(Load(s.stats.last_read_us)),
+                                   static_cast<unsigned>(Load(s.stats.max_read_us)));
+    }
+
+    Logger::GetInstance().Info(TAG, "=== END TEMPERATURE SAMPLING SCHEDULER DIAGNOSTICS ===");
+}
@@ -0,0 +1,274 @@
+/**
+ * @file TemperatureSamplingScheduler.h
+ * @brief One sampling task with a timing wheel for many BaseTemperature sensors.
+ *
+ * @details
+ * Continuous monitoring used to give every temperature handler its own
+ * PeriodicTimer, so N sensors meant N timer callbacks, N context lookups
+ * under a shared registry mutex and N independent ADC transactions even
+ * when the sensors sit on the same converter. The scheduler replaces that
+ * with a single dedicated task:
+ *
+ * - A hashed timing wheel (kWheelSlots buckets of tick_ms each) holds every
+ *   registered sensor. Each tick the task collects all sensors that are due,
+ *   so sensors with the same period are read back to back in one wakeup.
+ * - Sensors that share a batch source (e.g. the channels of one
+ *   NtcThermistorBank) name the same batch_context; the source is acquired
+ *   once per tick and the individual reads are then served from it.
+ * - The task resolves sensors by slot index and generation-tagged ID
+ *   through atomics only; AddSensor()/RemoveSensor() never block it.
+ * - Lateness and missed deadlines are tracked per sensor.
+ *
+ * @code
+ * static TemperatureSamplingScheduler scheduler(5);   // 5 ms tick
+ * scheduler.EnsureInitialized();
+ * scheduler.Start();
+ *
+ * ntc_handler.SetSamplingScheduler(&scheduler);
+ * ntc_handler.StartContinuousMonitoring(10, OnReading, nullptr);   // via the wheel
+ *
+ * hf_u32_t id = 0;
+ * scheduler.AddSensor({bank.GetChannel(0), 100, OnReading, nullptr,
+ *                      &NtcThermistorBank::ScanBatch, &bank}, &id);
+ * @endcode
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#pragma once
+
+#include "core/hf-core-drivers/internal/hf-internal-interface-wrap/inc/base/BaseTemperature.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/BaseThread.h"
+#include "RtosMutex.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Batch acquisition hook shared by sensors of one source.
+ * @param batch_context Source-specific context (e.g. an NtcThermistorBank*).
+ * @return TEMP_SUCCESS if the following sensor reads can use the new data.
+ */
+using hf_temp_batch_acquire_t = hf_temp_err_t (*)(void* batch_context);
+
+/**
+ * @brief Registration parameters for one sensor.
+ */
+struct TemperatureSamplingSensorConfig {
+    BaseTemperature* sensor;                 ///< Sensor to read (must outlive its registration)
+    hf_u32_t period_ms;                      ///< Sampling period (rounded up to whole ticks)
+    hf_temp_reading_callback_t callback;     ///< Reading callback (may be nullptr)
+    void* user_data;                         ///< Passed to @c callback
+    hf_temp_batch_acquire_t batch_acquire;   ///< Optional shared acquisition hook
+    void* batch_context;                     ///< Context for @c batch_acquire; equal contexts batch together
+};
+
+/**
+ * @brief Per-sensor sampling statistics.
+ */
+struct TemperatureSamplingStats {
+    uint32_t samples = 0;            ///< Reads performed
+    uint32_t read_failures = 0;      ///< Reads that returned an error
+    uint32_t deadline_misses = 0;    ///< Reads taken one tick or more after their due time
+    uint32_t skipped_periods = 0;    ///< Whole periods dropped because the task fell behind
+    uint32_t last_lateness_us = 0;   ///< Lateness of the latest read
+    uint32_t max_lateness_us = 0;    ///< Worst lateness
+    uint32_t last_read_us = 0;       ///< Duration of the latest read (incl. callback)
+    uint32_t max_read_us = 0;        ///< Worst read duration
+};
+
+/**
+ * @brief Scheduler-wide statistics.
+ */
+struct TemperatureSchedulerStats {
+    uint32_t ticks = 0;              ///< Wheel ticks processed
+    uint32_t busy_ticks = 0;         ///< Wakeups that found at least one sensor due
+    uint32_t overruns = 0;           ///< Wakeups whose work exceeded one tick
+    uint32_t batch_acquires = 0;     ///< Batch hook invocations
+    uint32_t batch_failures = 0;     ///< Batch hook failures
+    uint32_t batched_reads = 0;      ///< Reads that shared a batch acquisition
+    uint32_t max_due_per_wakeup = 0; ///< Largest group of sensors read in one wakeup
+    uint32_t last_work_us = 0;       ///< Duration of the latest busy wakeup
+    uint32_t max_work_us = 0;        ///< Worst busy wakeup
+};
+
+/**
+ * @class TemperatureSamplingScheduler
+ * @brief Dedicated sampling task driving registered sensors from a timing wheel.
+ *
+ * Call EnsureInitialized() and Start() (BaseThread API) to run the task.
+ * Sensors may be added before or after the task starts.
+ *
+ * @note AddSensor()/RemoveSensor() are thread-safe. RemoveSensor() waits for
+ *       an in-flight read of that sensor to finish (without holding the
+ *       registration mutex), so it must not be called from the sensor's own
+ *       reading callback, nor while holding a lock that sensor's read takes.
+ */
+class TemperatureSamplingScheduler : public BaseThread {
+public:
+    /** @brief Maximum registered sensors. */
+    static constexpr uint8_t kMaxSensors = 32;
+    /** @brief Timing wheel buckets (power of two). */
+    static constexpr uint32_t kWheelSlots = 64;
+    /** @brief Default task priority. */
+    static constexpr uint32_t kDefaultPriority = 5;
+
+    /**
+     * @brief Construct the scheduler (the task is created by EnsureInitialized()).
+     * @param tick_ms Wheel resolution in milliseconds (minimum 1).
+     * @param priority Sampling task priority.
+     */
+    explicit TemperatureSamplingScheduler(uint32_t tick_ms = 5,
+                                          uint32_t priority = kDefaultPriority) noexcept;
+
+    ~TemperatureSamplingScheduler() noexcept override = default;
+
+    TemperatureSamplingScheduler(const TemperatureSamplingScheduler&) = delete;
+    TemperatureSamplingScheduler& operator=(const TemperatureSamplingScheduler&) = delete;
+
+    /// @name Registration
+    /// @{
+
+    /**
+     * @brief Register a sensor.
+     * @param config Sensor, period, callback and optional batch source.
+     * @param sensor_id Receives the sensor ID (never 0).
+     * @return TEMP_SUCCESS, TEMP_ERR_NULL_POINTER, TEMP_ERR_INVALID_PARAMETER
+     *         for a zero period, or TEMP_ERR_OUT_OF_MEMORY if kMaxSensors are in use.
+     */
+    hf_temp_err_t AddSensor(const TemperatureSamplingSensorConfig& config, hf_u32_t* sensor_id) noexcept;
+
+    /**
+     * @brief Unregister a sensor. Stale or unknown IDs are rejected.
+     * @param sensor_id ID returned by AddSensor().
+     * @return TEMP_SUCCESS or TEMP_ERR_INVALID_PARAMETER.
+     */
+    hf_temp_err_t RemoveSensor(hf_u32_t sensor_id) noexcept;
+
+    /** @brief Number of registered sensors. */
+    [[nodiscard]] uint8_t GetSensorCount() const noexcept;
+
+    /** @brief Wheel resolution (ms). */
+    [[nodiscard]] uint32_t GetTickMs() const noexcept { return tick_ms_; }
+
+    /// @}
+
+    /// @name Statistics
+    /// @{
+
+    /**
+     * @brief Get the statistics of one sensor.
+     * @param sensor_id Sensor ID.
+     * @param stats Pointer to receive the statistics.
+     * @return TEMP_SUCCESS, TEMP_ERR_NULL_POINTER or TEMP_ERR_INVALID_PARAMETER.
+     */
+    hf_temp_err_t GetSensorStats(hf_u32_t sensor_id, TemperatureSamplingStats* stats) const noexcept;
+
+    /** @brief Get scheduler-wide statistics. */
+    [[nodiscard]] TemperatureSchedulerStats GetStats() const noexcept;
+
+    /** @brief Reset scheduler and per-sensor statistics. */
+    void ResetStats() noexcept;
+
+    /** @brief Log registered sensors and statistics at INFO level. */
+    void DumpDiagnostics() const noexcept;
+
+    /// @}
+
+protected:
+    bool Initialize() noexcept override;
+    bool Setup() noexcept override;
+    uint32_t Step() noexcept override;
+    bool Cleanup() noexcept override;
+    bool ResetVariables() noexcept override;
+
+private:
+    static constexpr int8_t kNone = -1;
+    static constexpr uint32_t kWheelMask = kWheelSlots - 1;
+    static_assert((kWheelSlots & kWheelMask) == 0, "kWheelSlots must be a power of two");
+    static_assert(kMaxSensors <= 32, "pending_inserts_ is a 32-bit mask");
+
+    /// Statistics updated by the task and read by any thread.
+    struct AtomicSensorStats {
+        std::atomic<uint32_t> samples{0};
+        std::atomic<uint32_t> read_failures{0};
+        std::atomic<uint32_t> deadline_misses{0};
+        std::atomic<uint32_t> skipped_periods{0};
+        std::atomic<uint32_t> last_lateness_us{0};
+        std::atomic<uint32_t> max_lateness_us{0};
+        std::atomic<uint32_t> last_read_us{0};
+        std::atomic<uint32_t> max_read_us{0};
+    };
+
+    /// Registration slot; fields are published by a release store of @c id.
+    struct SensorSlot {
+        std::atomic<hf_u32_t> id{0};         ///< 0 = free
+        BaseTemperature* sensor = nullptr;
+        hf_temp_reading_callback_t callback = nullptr;
+        void* user_data = nullptr;
+        hf_temp_batch_acquire_t batch_acquire = nullptr;
+        void* batch_context = nullptr;
+        uint32_t period_ticks = 1;
+        uint32_t generation = 0;             ///< Producer-side, under mutex_
+        AtomicSensorStats stats;
+    };
+
+    /// Wheel bookkeeping, owned by the sampling task.
+    struct WheelNode {
+        hf_u32_t id = 0;          ///< Slot ID this node was scheduled for
+        uint32_t due_tick = 0;    ///< Absolute tick of the next sample
+        int8_t next = kNone;      ///< Next node in the same bucket
+        bool linked = false;
+    };
+
+    static constexpr uint8_t SlotFromId(hf_u32_t id) noexcept {
+        return static_cast<uint8_t>((id & 0xFFU) - 1U);
+    }
+    static constexpr bool TickReached(uint32_t tick, uint32_t now_tick) noexcept {
+        return static_cast<int32_t>(tick - now_tick) <= 0;
+    }
+
+    /** @brief Validate an ID and return its slot, or nullptr. */
+    const SensorSlot* ResolveSlot(hf_u32_t sensor_id) const noexcept;
+
+    // Task-side wheel operations.
+    void ApplyPendingInserts() noexcept;
+    void Link(uint8_t slot) noexcept;
+    void Unlink(uint8_t slot) noexcept;
+    uint8_t CollectDue(uint32_t first_tick, uint32_t last_tick) noexcept;
+    void SampleGroup(uint8_t due_count, uint32_t now_tick) noexcept;
+
+    const uint32_t tick_ms_;
+    const uint32_t tick_us_;
+    const uint32_t priority_;
+
+    std::array<SensorSlot, kMaxSensors> slots_{};
+    std::atomic<uint32_t> pending_inserts_{0};   ///< Slots to (re)link into the wheel
+    std::atomic<hf_u32_t> active_id_{0};         ///< ID being sampled right now
+    std::atomic<uint32_t> retiring_{0};          ///< Removed slots still waiting out a read
+    uint8_t sensor_count_ = 0;                   ///< Producer-side, under mutex_
+    mutable RtosMutex mutex_;                    ///< Serializes AddSensor/RemoveSensor
+
+    // Owned by the sampling task.
+    std::array<int8_t, kWheelSlots> buckets_{};
+    std::array<WheelNode, kMaxSensors> nodes_{};
+    std::array<uint8_t, kMaxSensors> due_{};
+    uint64_t start_us_ = 0;
+    uint32_t next_tick_ = 0;
+
+    // Scheduler statistics (written by the task).
+    std::atomic<uint32_t> ticks_{0};
+    std::atomic<uint32_t> busy_ticks_{0};
+    std::atomic<uint32_t> overruns_{0};
+    std::atomic<uint32_t> batch_acquires_{0};
+    std::atomic<uint32_t> batch_failures_{0};
+    std::atomic<uint32_t> batched_reads_{0};
+    std::atomic<uint32_t> max_due_per_wakeup_{0};
+    std::atomic<uint32_t> last_work_us_{0};
+    std::atomic<uint32_t> max_work_us_{0};
+
+    uint8_t stack_[4096];
+};
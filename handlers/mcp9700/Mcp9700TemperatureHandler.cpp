@@ -4,9 +4,14 @@
  */
 
 #include "Mcp9700TemperatureHandler.h"
+#include "handlers/logger/Logger.h"
+
+#include <cmath>
 
 #include "core/hf-core-drivers/internal/hf-internal-interface-wrap/inc/utils/memory_utils.h"
 
+static const char* TAG = "Mcp9700TempHandler";
+
 Mcp9700TemperatureHandler::Mcp9700TemperatureHandler(BaseAdc* adc_interface, uint8_t adc_channel,
                                                      const char* sensor_name) noexcept
     : BaseTemperature()
@@ -33,6 +38,10 @@ bool Mcp9700TemperatureHandler::Initialize() noexcept {
         adc_adapter_.reset();
         return false;
     }
+    if (scale_q16_ != 0 && !ScalingMatchesAdcLocked(volts_per_count_, max_count_ + 1U)) {
+        Logger::GetInstance().Warn(TAG, "%s: raw-count path dropped, using the float path", sensor_name_);
+        scale_q16_ = 0;
+    }
     return true;
 }
 
@@ -54,6 +63,15 @@ hf_temp_err_t Mcp9700TemperatureHandler::ReadTemperatureCelsiusImpl(float* tempe
     if (!thermistor_) {
         return hf_temp_err_t::TEMP_ERR_NOT_INITIALIZED;
     }
+    if (scale_q16_ != 0) {
+        hf_u32_t raw = 0;
+        if (adc_interface_->ReadChannelCount(static_cast<hf_channel_id_t>(adc_channel_), raw) !=
+            hf_adc_err_t::ADC_SUCCESS) {
+            return hf_temp_err_t::TEMP_ERR_READ_FAILED;
+        }
+        *temperature_celsius = static_cast<float>(AccumulateCount(raw)) * 0.01f;
+        return hf_temp_err_t::TEMP_SUCCESS;
+    }
     if (!thermistor_->ReadTemperatureCelsius(temperature_celsius)) {
         return hf_temp_err_t::TEMP_ERR_READ_FAILED;
     }
@@ -80,3 +98,153 @@ hf_temp_err_t Mcp9700TemperatureHandler::GetSensorInfo(hf_temp_sensor_info_t* in
 hf_u32_t Mcp9700TemperatureHandler::GetCapabilities() const noexcept {
     return HF_TEMP_CAP_NONE;
 }
+
+hf_temp_err_t Mcp9700TemperatureHandler::SetAdcScaling(float reference_voltage, uint8_t resolution_bits) noexcept {
+    if (!(reference_voltage > 0.0f) || resolution_bits == 0 || resolution_bits > 24) {
+        return hf_temp_err_t::TEMP_ERR_INVALID_PARAMETER;
+    }
+    const uint32_t full_scale = 1UL << resolution_bits;
+    const double scale = static_cast<double>(reference_voltage) * kCentiPerVolt /
+                         static_cast<double>(full_scale) * static_cast<double>(1UL << kScaleShift);
+    const auto scale_q16 = static_cast<uint32_t>(std::lround(scale));
+    // count * scale + rounding must stay within 32 bits for every count.
+    const uint64_t worst = static_cast<uint64_t>(full_scale - 1U) * scale_q16 + (1U << (kScaleShift - 1));
+    if (scale_q16 == 0 || worst > UINT32_MAX) {
+        return hf_temp_err_t::TEMP_ERR_INVALID_PARAMETER;
+    }
+
+    const float volts_per_count = reference_voltage / static_cast<float>(full_scale);
+
+    MutexLockGuard lock(mutex_);
+    if (thermistor_ && !ScalingMatchesAdcLocked(volts_per_count, full_scale)) {
+        return hf_temp_err_t::TEMP_ERR_INVALID_PARAMETER;
+    }
+    scale_q16_ = scale_q16;
+    max_count_ = full_scale - 1U;
+    volts_per_count_ = volts_per_count;
+    window_sum_ = 0;
+    window_head_ = 0;
+    window_filled_ = 0;
+    return hf_temp_err_t::TEMP_SUCCESS;
+}
+
+bool Mcp9700TemperatureHandler::IsRawCountPathEnabled() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return scale_q16_ != 0;
+}
+
+hf_temp_err_t Mcp9700TemperatureHandler::SetOversampling(uint8_t samples) noexcept {
+    if (samples == 0 || samples > kMaxOversampling) {
+        return hf_temp_err_t::TEMP_ERR_INVALID_PARAMETER;
+    }
+    MutexLockGuard lock(mutex_);
+    window_len_ = samples;
+    window_sum_ = 0;
+    window_head_ = 0;
+    window_filled_ = 0;
+    return hf_temp_err_t::TEMP_SUCCESS;
+}
+
+hf_temp_err_t Mcp9700TemperatureHandler::ReadTemperatureCentiCelsius(int32_t* centi_celsius) noexcept {
+    if (centi_celsius == nullptr) {
+        return hf_temp_err_t::TEMP_ERR_NULL_POINTER;
+    }
+    if (!EnsureInitialized()) {
+        return hf_temp_err_t::TEMP_ERR_NOT_INITIALIZED;
+    }
+    MutexLockGuard lock(mutex_);
+    if (!thermistor_ || scale_q16_ == 0) {
+        return hf_temp_err_t::TEMP_ERR_NOT_INITIALIZED;
+    }
+    hf_u32_t raw = 0;
+    if (adc_interface_->ReadChannelCount(static_cast<hf_channel_id_t>(adc_channel_), raw) !=
+        hf_adc_err_t::ADC_SUCCESS) {
+        return hf_temp_err_t::TEMP_ERR_READ_FAILED;
+    }
+    *centi_celsius = AccumulateCount(raw);
+    return hf_temp_err_t::TEMP_SUCCESS;
+}
+
+hf_temp_err_t Mcp9700TemperatureHandler::ReadMultiple(Mcp9700TemperatureHandler* const* handlers, size_t count,
+                                                      int32_t* centi_celsius) noexcept {
+    if (handlers == nullptr || centi_celsius == nullptr) {
+        return hf_temp_err_t::TEMP_ERR_NULL_POINTER;
+    }
+    if (count == 0 || count > kMaxBatch || handlers[0] == nullptr) {
+        return hf_temp_err_t::TEMP_ERR_INVALID_PARAMETER;
+    }
+
+    BaseAdc* adc = handlers[0]->adc_interface_;
+    std::array<hf_channel_id_t, kMaxBatch> channels{};
+    std::array<hf_u32_t, kMaxBatch> raw_counts{};
+    std::array<float, kMaxBatch> voltages{};
+    for (size_t i = 0; i < count; ++i) {
+        Mcp9700TemperatureHandler* handler = handlers[i];
+        if (handler == nullptr || handler->adc_interface_ != adc) {
+            return hf_temp_err_t::TEMP_ERR_INVALID_PARAMETER;
+        }
+        if (!handler->EnsureInitialized() || !handler->IsRawCountPathEnabled()) {
+            return hf_temp_err_t::TEMP_ERR_NOT_INITIALIZED;
+        }
+        channels[i] = static_cast<hf_channel_id_t>(handler->adc_channel_);
+    }
+
+    if (adc->ReadMultipleChannels(channels.data(), static_cast<hf_u8_t>(count), raw_counts.data(),
+                                  voltages.data()) != hf_adc_err_t::ADC_SUCCESS) {
+        return hf_temp_err_t::TEMP_ERR_READ_FAILED;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        MutexLockGuard lock(handlers[i]->mutex_);
+        centi_celsius[i] = handlers[i]->AccumulateCount(raw_counts[i]);
+    }
+    return hf_temp_err_t::TEMP_SUCCESS;
+}
+
+bool Mcp9700TemperatureHandler::ScalingMatchesAdcLocked(float volts_per_count, uint32_t full_scale) noexcept {
+    const auto channel = static_cast<hf_channel_id_t>(adc_channel_);
+    hf_u32_t raw = 0;
+    float volts = 0.0f;
+    if (adc_interface_->ReadChannelCount(channel, raw) != hf_adc_err_t::ADC_SUCCESS ||
+        adc_interface_->ReadChannelV(channel, volts) != hf_adc_err_t::ADC_SUCCESS) {
+        Logger::GetInstance().Error(TAG, "%s: cannot read ADC channel %u to check the scaling", sensor_name_,
+                                    static_cast<unsigned>(adc_channel_));
+        return false;
+    }
+    // Near zero the ratio is dominated by offset and noise, so it proves nothing.
+    const float expected = volts / volts_per_count;
+    const float count = static_cast<float>(raw);
+    const auto eighth = static_cast<float>(full_scale / 8U);
+    if ((expected < eighth && count < eighth) || (count >= 0.8f * expected && count <= 1.25f * expected)) {
+        return true;
+    }
+    Logger::GetInstance().Error(TAG, "%s: ADC read %lu counts at %.3f V; the scaling expects %.0f counts",
+                                sensor_name_, static_cast<unsigned long>(raw), static_cast<double>(volts),
+                                static_cast<double>(expected));
+    return false;
+}
+
+int32_t Mcp9700TemperatureHandler::AccumulateCount(uint32_t raw_count) noexcept {
+    if (raw_count > max_count_) {
+        raw_count = max_count_;
+    }
+    // Unsigned Q16 multiply (range-checked in SetAdcScaling), then the 500 mV offset.
+    const int32_t centi = static_cast<int32_t>((raw_count * scale_q16_ + (1U << (kScaleShift - 1))) >> kScaleShift) +
+                          kOffsetCenti;
+    if (window_len_ <= 1) {
+        return centi;
+    }
+
+    // Moving window: replace the oldest sample once full.
+    if (window_filled_ == window_len_) {
+        window_sum_ -= window_[window_head_];
+    } else {
+        ++window_filled_;
+    }
+    window_[window_head_] = centi;
+    window_sum_ += centi;
+    window_head_ = static_cast<uint8_t>((window_head_ + 1U) % window_len_);
+
+    const int32_t n = window_filled_;
+    return (window_sum_ >= 0 ? window_sum_ + n / 2 : window_sum_ - n / 2) / n;
+}
@@ -1,6 +1,14 @@
 /**
  * @file Mcp9700TemperatureHandler.h
  * @brief MCP9700 linear active thermistor handler (ADC voltage to °C).
+ *
+ * Two read paths:
+ * - Default: the Mcp9700Thermistor driver reads a float voltage and converts
+ *   it in floating point.
+ * - Raw-count path (after SetAdcScaling()): one ReadChannelCount() per read,
+ *   converted with a precomputed Q16 integer scale and offset, optionally
+ *   averaged over a moving oversampling window. ReadMultiple() acquires
+ *   several MCP9700s on one ADC with a single ReadMultipleChannels() call.
  */
 
 #pragma once
@@ -10,6 +18,8 @@
 #include "core/hf-core-drivers/internal/hf-internal-interface-wrap/inc/base/BaseTemperature.h"
 #include "RtosMutex.h"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -53,6 +63,66 @@ public:
 
     ~Mcp9700TemperatureHandler() noexcept override = default;
 
+    /// Longest oversampling window (samples).
+    static constexpr uint8_t kMaxOversampling = 16;
+    /// Most handlers ReadMultiple() accepts in one call.
+    static constexpr size_t kMaxBatch = 16;
+
+    /**
+     * @brief Enable the raw-count path for the ADC's reference and resolution.
+     *
+     * Precomputes the count → centi-degree Q16 scale. BaseAdc does not expose
+     * its reference, so the scaling is checked against one count / voltage
+     * pair read from the channel: the count must be within 0.8-1.25x of what
+     * the scaling predicts (readings below 1/8 of full scale are not
+     * conclusive and pass). On an initialized handler the check runs here; a
+     * scaling set before Initialize() is checked there and dropped on mismatch.
+     *
+     * @param reference_voltage ADC full-scale voltage (V), up to ~6 V
+     * @param resolution_bits ADC resolution (1-24 bits)
+     * @return TEMP_SUCCESS, or TEMP_ERR_INVALID_PARAMETER if the values are out
+     *         of range, the ADC cannot be read or its reading does not match
+     */
+    hf_temp_err_t SetAdcScaling(float reference_voltage, uint8_t resolution_bits) noexcept;
+
+    /** @brief Whether the raw-count path is active. */
+    [[nodiscard]] bool IsRawCountPathEnabled() const noexcept;
+
+    /**
+     * @brief Set the oversampling window of the raw-count path.
+     *
+     * Non-blocking: each read takes one sample, adds it to a moving window of
+     * @p samples and returns the window average.
+     *
+     * @param samples Window length (1 = no oversampling, max kMaxOversampling)
+     * @return TEMP_SUCCESS or TEMP_ERR_INVALID_PARAMETER
+     */
+    hf_temp_err_t SetOversampling(uint8_t samples) noexcept;
+
+    /**
+     * @brief Read the temperature in centi-degrees through the raw-count path.
+     * @param centi_celsius Pointer to store temperature (0.01 °C)
+     * @return TEMP_SUCCESS, TEMP_ERR_NULL_POINTER, TEMP_ERR_NOT_INITIALIZED
+     *         (handler or raw-count path), or TEMP_ERR_READ_FAILED
+     */
+    hf_temp_err_t ReadTemperatureCentiCelsius(int32_t* centi_celsius) noexcept;
+
+    /**
+     * @brief Read several MCP9700s sharing one ADC with one ReadMultipleChannels() call.
+     *
+     * Every handler must be initialized, use the same BaseAdc and have the
+     * raw-count path enabled. Each sample feeds that handler's oversampling
+     * window, as a single read would.
+     *
+     * @param handlers Handlers to read
+     * @param count Number of handlers (max kMaxBatch)
+     * @param centi_celsius Output temperatures (0.01 °C), one per handler
+     * @return TEMP_SUCCESS, TEMP_ERR_NULL_POINTER, TEMP_ERR_INVALID_PARAMETER,
+     *         TEMP_ERR_NOT_INITIALIZED or TEMP_ERR_READ_FAILED
+     */
+    static hf_temp_err_t ReadMultiple(Mcp9700TemperatureHandler* const* handlers, size_t count,
+                                      int32_t* centi_celsius) noexcept;
+
 protected:
     bool Initialize() noexcept override;
     bool Deinitialize() noexcept override;
@@ -61,10 +131,31 @@ protected:
     [[nodiscard]] hf_u32_t GetCapabilities() const noexcept override;
 
 private:
+    /// MCP9700 transfer function: V_out = 500 mV + 10 mV/°C * T.
+    static constexpr int32_t kOffsetCenti = -5000;           ///< -V0 / Tc in 0.01 °C
+    static constexpr float kCentiPerVolt = 10000.0f;         ///< 1 / Tc in 0.01 °C per volt
+    static constexpr uint8_t kScaleShift = 16;
+
+    /** @brief Check a count / voltage pair from the ADC against a scaling (caller holds mutex_). */
+    bool ScalingMatchesAdcLocked(float volts_per_count, uint32_t full_scale) noexcept;
+
+    /** @brief Convert one count and push it into the window (caller holds mutex_). */
+    int32_t AccumulateCount(uint32_t raw_count) noexcept;
+
     mutable RtosMutex mutex_;
     BaseAdc* adc_interface_;
     uint8_t adc_channel_;
     const char* sensor_name_;
     std::unique_ptr<Mcp9700AdcAdapter> adc_adapter_;
     std::unique_ptr<Mcp9700ThermistorConcrete> thermistor_;
+
+    // Raw-count path
+    uint32_t scale_q16_ = 0;                     ///< 0.01 °C per count, Q16 (0 = path disabled)
+    uint32_t max_count_ = 0;                     ///< Largest count the scale accepts
+    float volts_per_count_ = 0.0f;               ///< Scaling the Q16 factor was built from
+    std::array<int32_t, kMaxOversampling> window_{};  ///< Converted samples (0.01 °C)
+    int32_t window_sum_ = 0;                     ///< Sum of window_ entries in use
+    uint8_t window_len_ = 1;                     ///< Configured window length
+    uint8_t window_head_ = 0;                    ///< Next slot to write
+    uint8_t window_filled_ = 0;                  ///< Samples in the window
 };
@@ -0,0 +1,333 @@
+/**
+ * @file NtcFixedPointLut.h
+ * @brief Compile-time generated fixed-point lookup table for NTC conversion.
+ *
+ * @details
+ * The NtcThermistor driver converts each sample with the Beta or
+ * Steinhart-Hart equation, which costs a floating-point `log` per reading.
+ * NtcFixedPointLut moves that work to compile time: the table maps raw ADC
+ * counts directly to centi-degrees Celsius, and a conversion is one shift,
+ * one mask and one integer multiply-add.
+ *
+ * The table is built by a `constexpr` constructor from the thermistor Beta
+ * parameters, the divider series resistor, the ADC reference voltage and the
+ * ADC resolution. It is immutable and can be shared by every handler that
+ * reads the same thermistor type through the same divider:
+ *
+ * @code
+ * static constexpr NtcFixedPointLut kBoardNtcLut{
+ *     MakeNtcLutParams(NtcType::NtcG163Jft103Ft1S, 10000.0f, 3.3f, 12)};
+ *
+ * handler.SetFixedPointLut(&kBoardNtcLut);
+ * int32_t centi_c = 0;
+ * handler.ReadTemperatureCentiCelsius(&centi_c);
+ * @endcode
+ *
+ * ## Layout and Accuracy
+ *
+ * The count range is split into kSegments equal segments; each of the
+ * kSegments + 1 breakpoints stores the exact Beta-model temperature as
+ * int16 centi-degrees (258 bytes of flash). Conversions interpolate linearly
+ * between breakpoints and clamp to [min_temperature_c, max_temperature_c].
+ * For a 10k/B3435 thermistor with a 10k series resistor on a 12-bit ADC the
+ * interpolation error against the float Beta equation is below 0.06 °C
+ * from -20 to 100 °C and below 0.15 °C across -40 to 125 °C.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#pragma once
+
+#include "core/hf-core-drivers/external/hf-ntc-thermistor-driver/inc/ntc_thermistor.hpp"
+
+#include <array>
+#include <cstdint>
+
+//--------------------------------------
+//  LUT Parameters
+//--------------------------------------
+
+/**
+ * @brief Electrical and thermistor parameters a fixed-point LUT is built from.
+ *
+ * The divider is assumed to be excited by @c supply_voltage. With
+ * @c ntc_high_side false (default) the thermistor sits between the ADC node
+ * and ground and the series resistor goes to the supply.
+ */
+struct NtcLutParams {
+    float nominal_resistance_ohms;   ///< Thermistor resistance at nominal temperature (ohms)
+    float nominal_temperature_c;     ///< Nominal temperature (°C), usually 25
+    float beta_k;                    ///< Beta value (K); 0 marks the parameters invalid
+    float series_resistance_ohms;    ///< Divider series resistance (ohms)
+    float supply_voltage;            ///< Divider excitation voltage (V)
+    float adc_reference_voltage;     ///< ADC full-scale voltage (V)
+    uint8_t adc_resolution_bits;     ///< ADC resolution (bits)
+    bool ntc_high_side;              ///< true if the thermistor is on the supply side
+    float min_temperature_c;         ///< Lower conversion clamp (°C)
+    float max_temperature_c;         ///< Upper conversion clamp (°C)
+};
+
+/**
+ * @brief Build LUT parameters for any Beta-model thermistor.
+ *
+ * @param nominal_ohms     Thermistor resistance at 25 °C (ohms).
+ * @param beta_k           Beta value (K).
+ * @param series_ohms      Divider series resistance (ohms).
+ * @param reference_voltage ADC reference voltage, also used as the divider supply (V).
+ * @param resolution_bits  ADC resolution (bits).
+ * @return Parameters for NtcFixedPointLut.
+ */
+constexpr NtcLutParams MakeNtcLutParams(float nominal_ohms, float beta_k, float series_ohms,
+                                        float reference_voltage, uint8_t resolution_bits) noexcept {
+    return NtcLutParams{nominal_ohms, 25.0f, beta_k, series_ohms, reference_voltage, reference_voltage,
+                        resolution_bits, false, -40.0f, 125.0f};
+}
+
+/**
+ * @brief Build LUT parameters from a driver NtcType and the divider configuration.
+ *
+ * Only types with built-in data here are supported; use the overload taking
+ * nominal resistance and Beta for other parts (including NtcType::Custom).
+ *
+ * @param type             Thermistor type; supplies nominal resistance and Beta.
+ * @param series_ohms      Divider series resistance (ohms).
+ * @param reference_voltage ADC reference voltage, also used as the divider supply (V).
+ * @param resolution_bits  ADC resolution (bits).
+ * @param beta_override    Beta value to use instead of the type default (0 = default).
+ * @return Parameters for NtcFixedPointLut. Types without built-in data return
+ *         beta_k = 0 (invalid), since their nominal resistance is unknown.
+ */
+constexpr NtcLutParams MakeNtcLutParams(NtcType type, float series_ohms, float reference_voltage,
+                                        uint8_t resolution_bits, float beta_override = 0.0f) noexcept {
+    switch (type) {
+        case NtcType::NtcG163Jft103Ft1S:
+            // TDK NTCG163JF103FT1S: 10k @ 25 °C, B25/85 = 3435 K.
+            return MakeNtcLutParams(10000.0f, beta_override > 0.0f ? beta_override : 3435.0f, series_ohms,
+                                    reference_voltage, resolution_bits);
+        default:
+            return MakeNtcLutParams(0.0f, 0.0f, series_ohms, reference_voltage, resolution_bits);
+    }
+}
+
+//--------------------------------------
+//  NtcFixedPointLut
+//--------------------------------------
+
+/**
+ * @class NtcFixedPointLut
+ * @brief Immutable raw-count → centi-degree table with fixed-point interpolation.
+ */
+class NtcFixedPointLut {
+public:
+    /// log2 of the number of interpolation segments.
+    static constexpr uint8_t kSegmentsLog2 = 7;
+    /// Number of interpolation segments across the ADC count range.
+    static constexpr uint32_t kSegments = 1U << kSegmentsLog2;
+
+    /**
+     * @brief Generate the table. Intended for `constexpr` use.
+     * @param params Thermistor and divider parameters.
+     */
+    constexpr explicit NtcFixedPointLut(const NtcLutParams& params) noexcept
+        : table_{},
+          shift_(0),
+          full_scale_(0),
+          volts_per_count_(0.0f),
+          series_resistance_ohms_(params.series_resistance_ohms),
+          supply_voltage_(params.supply_voltage),
+          ntc_high_side_(params.ntc_high_side),
+          min_centi_(ToCenti(params.min_temperature_c)),
+          max_centi_(ToCenti(params.max_temperature_c)),
+          valid_(false) {
+        if (params.beta_k <= 0.0f || params.nominal_resistance_ohms <= 0.0f ||
+            params.series_resistance_ohms <= 0.0f || params.supply_voltage <= 0.0f ||
+            params.adc_reference_voltage <= 0.0f || params.adc_resolution_bits < kSegmentsLog2 ||
+            params.adc_resolution_bits > 24 || min_centi_ >= max_centi_) {
+            return;
+        }
+
+        shift_ = static_cast<uint8_t>(params.adc_resolution_bits - kSegmentsLog2);
+        full_scale_ = 1U << params.adc_resolution_bits;
+
+        const double volts_per_count =
+            static_cast<double>(params.adc_reference_voltage) / static_cast<double>(full_scale_);
+        volts_per_count_ = static_cast<float>(volts_per_count);
+        const double t0_inv = 1.0 / (static_cast<double>(params.nominal_temperature_c) + kKelvinOffset);
+
+        for (uint32_t i = 0; i <= kSegments; ++i) {
+            const double ratio = static_cast<double>(i << shift_) * volts_per_count /
+                                 static_cast<double>(params.supply_voltage);
+            // Fraction of the supply dropped across the thermistor.
+            const double node = params.ntc_high_side ? 1.0 - ratio : ratio;
+
+            // Breakpoints outside the physical range saturate; the conversion
+            // clamp keeps results inside [min, max] regardless.
+            double temp_c = 0.0;
+            if (node <= 0.0) {
+                temp_c = kSaturationC;
+            } else if (node >= 1.0) {
+                temp_c = -kSaturationC;
+            } else {
+                const double r_ntc = static_cast<double>(params.series_resistance_ohms) * node / (1.0 - node);
+                const double t_inv = t0_inv + Ln(r_ntc / static_cast<double>(params.nominal_resistance_ohms)) /
+                                                  static_cast<double>(params.beta_k);
+                temp_c = (t_inv > 0.0) ? (1.0 / t_inv - kKelvinOffset) : kSaturationC;
+            }
+            if (temp_c > kSaturationC) temp_c = kSaturationC;
+            if (temp_c < -kSaturationC) temp_c = -kSaturationC;
+            table_[i] = ToCenti(temp_c);
+        }
+        valid_ = true;
+    }
+
+    /** @brief Whether the parameters produced a usable table. */
+    [[nodiscard]] constexpr bool IsValid() const noexcept { return valid_; }
+
+    /** @brief ADC resolution the table was built for (bits). */
+    [[nodiscard]] constexpr uint8_t GetResolutionBits() const noexcept {
+        return static_cast<uint8_t>(shift_ + kSegmentsLog2);
+    }
+
+    /** @brief ADC full-scale voltage the table was built for (V). */
+    [[nodiscard]] constexpr float GetReferenceVoltage() const noexcept {
+        return volts_per_count_ * static_cast<float>(full_scale_);
+    }
+
+    /** @brief Divider series resistance the table was built for (ohms). */
+    [[nodiscard]] constexpr float GetSeriesResistanceOhms() const noexcept { return series_resistance_ohms_; }
+
+    /**
+     * @brief Check the table against a divider / ADC configuration.
+     *
+     * A table built for another resolution, reference or series resistor
+     * converts every count to a wrong temperature without any other sign.
+     *
+     * @param series_ohms       Divider series resistance (ohms).
+     * @param reference_voltage ADC reference voltage (V).
+     * @param resolution_bits   ADC resolution (bits).
+     * @return true if the resolution is equal and both analog values are within 1%.
+     */
+    [[nodiscard]] constexpr bool MatchesConfig(float series_ohms, float reference_voltage,
+                                               uint8_t resolution_bits) const noexcept {
+        return valid_ && resolution_bits == GetResolutionBits() &&
+               WithinPercent(series_ohms, series_resistance_ohms_, 1.0f) &&
+               WithinPercent(reference_voltage, GetReferenceVoltage(), 1.0f);
+    }
+
+    /**
+     * @brief Check a count and a voltage read from the real ADC against the table's scaling.
+     *
+     * Detects a wrong resolution (a factor of two per bit) or a grossly wrong
+     * reference. Readings below 1/8 of full scale cannot tell and pass.
+     *
+     * @param raw_count ADC count of the channel.
+     * @param volts     Voltage the ADC driver reported for the same channel (V).
+     * @return false if the count is more than 25% off the count the table expects.
+     */
+    [[nodiscard]] constexpr bool MatchesAdcReading(uint32_t raw_count, float volts) const noexcept {
+        if (!valid_) {
+            return false;
+        }
+        const float expected = volts / volts_per_count_;
+        const float count = static_cast<float>(raw_count);
+        const auto eighth = static_cast<float>(full_scale_ / 8U);
+        if (expected < eighth && count < eighth) {
+            return true;
+        }
+        return count >= 0.8f * expected && count <= 1.25f * expected;
+    }
+
+    /**
+     * @brief Convert a raw ADC count to centi-degrees Celsius.
+     * @param raw_count ADC count; values above full scale saturate.
+     * @return Temperature in 0.01 °C, clamped to the configured range.
+     */
+    [[nodiscard]] constexpr int32_t CountToCentiCelsius(uint32_t raw_count) const noexcept {
+        if (!valid_) {
+            return 0;
+        }
+        if (raw_count >= full_scale_) {
+            raw_count = full_scale_ - 1U;
+        }
+        const uint32_t index = raw_count >> shift_;
+        const int32_t frac = static_cast<int32_t>(raw_count & ((1U << shift_) - 1U));
+        const int32_t base = table_[index];
+        const int32_t delta = static_cast<int32_t>(table_[index + 1]) - base;
+        int32_t centi = base;
+        if (shift_ != 0) {
+            centi += (delta * frac + (1 << (shift_ - 1))) >> shift_;
+        }
+        if (centi < min_centi_) return min_centi_;
+        if (centi > max_centi_) return max_centi_;
+        return centi;
+    }
+
+    /**
+     * @brief Convert a raw ADC count to the ADC node voltage.
+     * @param raw_count ADC count.
+     * @return Voltage (V).
+     */
+    [[nodiscard]] constexpr float CountToVolts(uint32_t raw_count) const noexcept {
+        return static_cast<float>(raw_count) * volts_per_count_;
+    }
+
+    /**
+     * @brief Convert a raw ADC count to thermistor resistance.
+     * @param raw_count ADC count.
+     * @return Resistance (ohms), or 0 if the count is at either rail.
+     */
+    [[nodiscard]] constexpr float CountToResistanceOhms(uint32_t raw_count) const noexcept {
+        if (!valid_) {
+            return 0.0f;
+        }
+        const float ratio = CountToVolts(raw_count) / supply_voltage_;
+        const float node = ntc_high_side_ ? 1.0f - ratio : ratio;
+        if (node <= 0.0f || node >= 1.0f) {
+            return 0.0f;
+        }
+        return series_resistance_ohms_ * node / (1.0f - node);
+    }
+
+private:
+    static constexpr double kKelvinOffset = 273.15;
+    static constexpr double kSaturationC = 300.0;  ///< Fits int16 centi-degrees.
+
+    /// Natural log usable in constant expressions (std::log is not constexpr).
+    static constexpr double Ln(double x) noexcept {
+        int exponent = 0;
+        while (x > 1.5) { x *= 0.5; ++exponent; }
+        while (x < 0.75) { x *= 2.0; --exponent; }
+        // ln(x) = 2 * atanh((x - 1) / (x + 1)), |y| <= 0.2 converges quickly.
+        const double y = (x - 1.0) / (x + 1.0);
+        const double y2 = y * y;
+        double term = y;
+        double sum = 0.0;
+        for (int n = 1; n < 40; n += 2) {
+            sum += term / n;
+            term *= y2;
+        }
+        return 2.0 * sum + exponent * 0.69314718055994530942;
+    }
+
+    static constexpr bool WithinPercent(float value, float reference, float percent) noexcept {
+        const float diff = value > reference ? value - reference : reference - value;
+        return diff * 100.0f <= reference * percent;
+    }
+
+    static constexpr int16_t ToCenti(double celsius) noexcept {
+        return static_cast<int16_t>(celsius * 100.0 + (celsius >= 0.0 ? 0.5 : -0.5));
+    }
+
+    std::array<int16_t, kSegments + 1> table_;  ///< Breakpoint temperatures (0.01 °C)
+    uint8_t shift_;                             ///< Count bits below the segment index
+    uint32_t full_scale_;                       ///< 2^resolution
+    float volts_per_count_;                     ///< ADC reference / full scale (V)
+    float series_resistance_ohms_;              ///< Divider series resistance (ohms)
+    float supply_voltage_;                      ///< Divider excitation voltage (V)
+    bool ntc_high_side_;                        ///< Thermistor on the supply side
+    int16_t min_centi_;                         ///< Lower clamp (0.01 °C)
+    int16_t max_centi_;                         ///< Upper clamp (0.01 °C)
+    bool valid_;                                ///< Parameters accepted
+};
@@ -17,9 +17,13 @@
 
 static const char* TAG = "NtcTempHandler";
 
-RtosMutex NtcTemperatureHandler::callback_registry_mutex_{};
-std::array<NtcTemperatureHandler*, NtcTemperatureHandler::kMonitoringContextSlots>
+std::array<std::atomic<hf_u32_t>, NtcTemperatureHandler::kMonitoringContextSlots>
+    NtcTemperatureHandler::callback_registry_tags_ = {};
+std::array<std::atomic<NtcTemperatureHandler*>, NtcTemperatureHandler::kMonitoringContextSlots>
     NtcTemperatureHandler::callback_registry_ = {};
+std::array<std::atomic<hf_u32_t>, NtcTemperatureHandler::kMonitoringContextSlots>
+    NtcTemperatureHandler::callback_registry_in_flight_ = {};
+std::atomic<hf_u32_t> NtcTemperatureHandler::stale_callback_count_{0};
 
 //--------------------------------------
 //  NtcTemperatureHandler Implementation
@@ -44,12 +48,29 @@ NtcTemperatureHandler::NtcTemperatureHandler(BaseAdc* adc_interface,
     , continuous_user_data_(nullptr)
     , monitoring_timer_()
     , monitoring_context_id_(0)
+    , sampling_scheduler_(nullptr)
+    , scheduler_sensor_id_(0)
     , calibration_offset_(0.0f)
+    , fixed_point_lut_(nullptr)
+    , last_reading_{}
+    , incremental_raw_{}
+    , incremental_centi_{}
+    , incremental_raw_sum_(0)
+    , incremental_centi_sum_(0)
+    , incremental_head_(0)
+    , incremental_filled_(0)
     , statistics_({})
     , diagnostics_({})
     , initialized_(false)
     , threshold_monitoring_enabled_(false)
-    , monitoring_active_(false) {
+    , monitoring_active_(false)
+    , last_reading_valid_(false)
+    , incremental_sampling_(false) {
+    
+    // Configs built without NTC_TEMP_HANDLER_CONFIG_DEFAULT() leave the resolution 0.
+    if (config_.adc_resolution_bits == 0) {
+        config_.adc_resolution_bits = kDefaultAdcResolutionBits;
+    }
     
     // Initialize statistics
     statistics_.total_operations = 0;
@@ -97,12 +118,24 @@ NtcTemperatureHandler::NtcTemperatureHandler(NtcType ntc_type, BaseAdc* adc_inte
     , continuous_user_data_(nullptr)
     , monitoring_timer_()
     , monitoring_context_id_(0)
+    , sampling_scheduler_(nullptr)
+    , scheduler_sensor_id_(0)
     , calibration_offset_(0.0f)
+    , fixed_point_lut_(nullptr)
+    , last_reading_{}
+    , incremental_raw_{}
+    , incremental_centi_{}
+    , incremental_raw_sum_(0)
+    , incremental_centi_sum_(0)
+    , incremental_head_(0)
+    , incremental_filled_(0)
     , statistics_({})
     , diagnostics_({})
     , initialized_(false)
     , threshold_monitoring_enabled_(false)
-    , monitoring_active_(false) {
+    , monitoring_active_(false)
+    , last_reading_valid_(false)
+    , incremental_sampling_(false) {
     
     // Apply default configuration and override NTC type / sensor name
     ntc_temp_handler_config_t default_config = NTC_TEMP_HANDLER_CONFIG_DEFAULT();
@@ -180,7 +213,7 @@ bool NtcTemperatureHandler::Initialize() noexcept {
     
     // Create ADC adapter bridging BaseAdc to ntc::AdcInterface
     ntc_adc_adapter_ = std::make_unique<NtcAdcAdapter>(
-        adc_interface_, config_.reference_voltage);
+        adc_interface_, config_.reference_voltage, config_.adc_resolution_bits);
     if (!ntc_adc_adapter_) {
         Logger::GetInstance().Error(TAG, "Failed to create NTC ADC adapter");
         SetLastError(TEMP_ERR_OUT_OF_MEMORY);
@@ -220,6 +253,13 @@ bool NtcTemperatureHandler::Initialize() noexcept {
         ntc_thermistor_->SetBetaValue(config_.beta_value);
     }
     
+    // Incremental sampling: the driver takes one sample per acquisition
+    incremental_sampling_ = config_.incremental_sampling;
+    ResetIncrementalLocked();
+    if (incremental_sampling_) {
+        ntc_thermistor_->SetSamplingParameters(1, 0);
+    }
+    
     // Apply calibration offset if set
     if (calibration_offset_ != 0.0f) {
         ntc_thermistor_->SetCalibrationOffset(calibration_offset_);
@@ -232,6 +272,12 @@ bool NtcTemperatureHandler::Initialize() noexcept {
         EnableThresholdMonitoring(config_.threshold_callback, config_.threshold_user_data);
     }
     
+    // A LUT installed before initialization is checked against the real ADC now.
+    if (fixed_point_lut_ != nullptr && !LutMatchesAdcLocked(*fixed_point_lut_)) {
+        Logger::GetInstance().Error(TAG, "Fixed-point LUT dropped, using the float path");
+        fixed_point_lut_ = nullptr;
+    }
+
     initialized_ = true;
     current_state_ = HF_TEMP_STATE_INITIALIZED;
     
@@ -240,17 +286,16 @@ bool NtcTemperatureHandler::Initialize() noexcept {
 }
 
 bool NtcTemperatureHandler::Deinitialize() noexcept {
+    // Stop continuous monitoring before taking mutex_: removing a scheduled
+    // sensor waits for its in-flight read, which takes mutex_.
+    StopContinuousMonitoring();
+
     MutexLockGuard lock(mutex_);
     
     if (!initialized_) {
         return true;
     }
     
-    // Stop continuous monitoring
-    if (monitoring_active_) {
-        StopContinuousMonitoring();
-    }
-    
     // Clean up timer
     monitoring_timer_.Destroy();
     UnregisterMonitoringContext(monitoring_context_id_);
@@ -268,6 +313,7 @@ bool NtcTemperatureHandler::Deinitialize() noexcept {
     threshold_user_data_ = nullptr;
     continuous_callback_ = nullptr;
     continuous_user_data_ = nullptr;
+    last_reading_valid_ = false;
     
     initialized_ = false;
     current_state_ = HF_TEMP_STATE_UNINITIALIZED;
@@ -277,38 +323,19 @@ bool NtcTemperatureHandler::Deinitialize() noexcept {
 }
 
 hf_temp_err_t NtcTemperatureHandler::ReadTemperatureCelsiusImpl(float* temperature_celsius) noexcept {
+    // Also reached from the monitoring timer and the sampling scheduler; the
+    // incremental window and statistics are only touched under mutex_.
+    MutexLockGuard lock(mutex_);
     if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
         return TEMP_ERR_NOT_INITIALIZED;
     }
     
-    const auto start_time = os_time_get();
-    
-    NtcError result = ntc_thermistor_->ReadTemperatureCelsius(temperature_celsius);
-    
-    const auto end_time = os_time_get();
-    const auto operation_time = static_cast<hf_u32_t>(end_time - start_time);
-    
-    if (result == NtcError::Success) {
-        UpdateStatistics(true, operation_time);
-        UpdateDiagnostics(TEMP_SUCCESS);
-        
-        // Update diagnostics with raw reading
-        uint32_t raw_value = 0;
-        if (ntc_thermistor_->GetRawAdcValue(&raw_value) == NtcError::Success) {
-            diagnostics_.current_temperature_raw = static_cast<hf_u32_t>(raw_value);
-        }
-        
-        // Check thresholds
-        CheckThresholds(*temperature_celsius);
-        
-    } else {
-        UpdateStatistics(false, operation_time);
-        hf_temp_err_t temp_error = ConvertNtcError(result);
-        UpdateDiagnostics(temp_error);
-        return temp_error;
+    ntc_temp_handler_reading_t reading = {};
+    hf_temp_err_t result = ReadAndRecord(&reading);
+    if (result == TEMP_SUCCESS) {
+        *temperature_celsius = reading.temperature_celsius;
     }
-    
-    return TEMP_SUCCESS;
+    return result;
 }
 
 hf_temp_err_t NtcTemperatureHandler::GetSensorInfo(hf_temp_sensor_info_t* info) const noexcept {
@@ -409,12 +436,6 @@ hf_temp_err_t NtcTemperatureHandler::DisableThresholdMonitoring() noexcept {
 hf_temp_err_t NtcTemperatureHandler::StartContinuousMonitoring(hf_u32_t sample_rate_hz, 
                                                               hf_temp_reading_callback_t callback, 
                                                               void* user_data) noexcept {
-    MutexLockGuard lock(mutex_);
-    
-    if (!EnsureInitialized()) {
-        return TEMP_ERR_NOT_INITIALIZED;
-    }
-    
     if (callback == nullptr) {
         return TEMP_ERR_NULL_POINTER;
     }
@@ -423,9 +444,18 @@ hf_temp_err_t NtcTemperatureHandler::StartContinuousMonitoring(hf_u32_t sample_r
         return TEMP_ERR_INVALID_PARAMETER;
     }
     
-    // Stop existing monitoring if active
+    // Stop existing monitoring first, outside mutex_ (see StopContinuousMonitoring()).
+    StopContinuousMonitoring();
+    
+    MutexLockGuard lock(mutex_);
+    
+    if (!EnsureInitialized()) {
+        return TEMP_ERR_NOT_INITIALIZED;
+    }
+    
     if (monitoring_active_) {
-        StopContinuousMonitoring();
+        // Another caller started monitoring in the meantime.
+        return TEMP_ERR_BUSY;
     }
     
     // Calculate period in milliseconds (clamp to 1ms minimum).
@@ -433,19 +463,30 @@ hf_temp_err_t NtcTemperatureHandler::StartContinuousMonitoring(hf_u32_t sample_r
                                    ? 1U
                                    : (1000U / sample_rate_hz);
 
-    monitoring_context_id_ = RegisterMonitoringContext(this);
-    if (monitoring_context_id_ == 0) {
-        Logger::GetInstance().Error(TAG, "No callback context slot available");
-        return TEMP_ERR_RESOURCE_UNAVAILABLE;
-    }
-    
-    // Create hardware-agnostic periodic timer
-    if (!monitoring_timer_.Create("ntc_monitor", ContinuousMonitoringCallback,
-                                  monitoring_context_id_, period_ms, true)) {
-        UnregisterMonitoringContext(monitoring_context_id_);
-        monitoring_context_id_ = 0;
-        Logger::GetInstance().Error(TAG, "Failed to create monitoring timer");
-        return TEMP_ERR_RESOURCE_UNAVAILABLE;
+    if (sampling_scheduler_ != nullptr) {
+        const TemperatureSamplingSensorConfig sensor_config = {
+            this, period_ms, callback, user_data, nullptr, nullptr};
+        const hf_temp_err_t err = sampling_scheduler_->AddSensor(sensor_config, &scheduler_sensor_id_);
+        if (err != TEMP_SUCCESS) {
+            scheduler_sensor_id_ = 0;
+            Logger::GetInstance().Error(TAG, "Sampling scheduler registration failed");
+            return err;
+        }
+    } else {
+        monitoring_context_id_ = RegisterMonitoringContext(this);
+        if (monitoring_context_id_ == 0) {
+            Logger::GetInstance().Error(TAG, "No callback context slot available");
+            return TEMP_ERR_RESOURCE_UNAVAILABLE;
+        }
+
+        // Create hardware-agnostic periodic timer
+        if (!monitoring_timer_.Create("ntc_monitor", ContinuousMonitoringCallback,
+                                      monitoring_context_id_, period_ms, true)) {
+            UnregisterMonitoringContext(monitoring_context_id_);
+            monitoring_context_id_ = 0;
+            Logger::GetInstance().Error(TAG, "Failed to create monitoring timer");
+            return TEMP_ERR_RESOURCE_UNAVAILABLE;
+        }
     }
     
     continuous_callback_ = callback;
@@ -458,22 +499,43 @@ hf_temp_err_t NtcTemperatureHandler::StartContinuousMonitoring(hf_u32_t sample_r
 }
 
 hf_temp_err_t NtcTemperatureHandler::StopContinuousMonitoring() noexcept {
-    MutexLockGuard lock(mutex_);
-    
-    if (!monitoring_active_) {
-        return TEMP_SUCCESS;
+    TemperatureSamplingScheduler* scheduler = nullptr;
+    hf_u32_t sensor_id = 0;
+    hf_u32_t stopped_context_id = 0;
+    {
+        MutexLockGuard lock(mutex_);
+        
+        if (!monitoring_active_) {
+            return TEMP_SUCCESS;
+        }
+        
+        if (scheduler_sensor_id_ != 0) {
+            scheduler = sampling_scheduler_;
+            sensor_id = scheduler_sensor_id_;
+            scheduler_sensor_id_ = 0;
+        } else {
+            // Stop and destroy timer; a later tick resolves a stale context
+            // ID and is dropped, one already past resolving is waited for below.
+            monitoring_timer_.Stop();
+            UnregisterMonitoringContext(monitoring_context_id_);
+            stopped_context_id = monitoring_context_id_;
+            monitoring_context_id_ = 0;
+            monitoring_timer_.Destroy();
+        }
+        
+        continuous_callback_ = nullptr;
+        continuous_user_data_ = nullptr;
+        monitoring_active_ = false;
+        diagnostics_.continuous_monitoring_active = false;
     }
     
-    // Stop and destroy timer
-    monitoring_timer_.Stop();
-    UnregisterMonitoringContext(monitoring_context_id_);
-    monitoring_context_id_ = 0;
-    monitoring_timer_.Destroy();
-    
-    continuous_callback_ = nullptr;
-    continuous_user_data_ = nullptr;
-    monitoring_active_ = false;
-    diagnostics_.continuous_monitoring_active = false;
+    if (scheduler != nullptr) {
+        // Waits for an in-flight scheduled read, which takes mutex_ (as may
+        // the user callback), so mutex_ must not be held here.
+        scheduler->RemoveSensor(sensor_id);
+    }
+    // Same for an in-flight timer tick: it reads under mutex_.
+    WaitMonitoringContextIdle(stopped_context_id);
     
     Logger::GetInstance().Info(TAG, "Continuous monitoring stopped");
     return TEMP_SUCCESS;
@@ -484,6 +546,20 @@ bool NtcTemperatureHandler::IsMonitoringActive() const noexcept {
     return monitoring_active_;
 }
 
+hf_temp_err_t NtcTemperatureHandler::SetSamplingScheduler(TemperatureSamplingScheduler* scheduler) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (monitoring_active_) {
+        return TEMP_ERR_BUSY;
+    }
+    sampling_scheduler_ = scheduler;
+    return TEMP_SUCCESS;
+}
+
+hf_u32_t NtcTemperatureHandler::GetSchedulerSensorId() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return scheduler_sensor_id_;
+}
+
 hf_temp_err_t NtcTemperatureHandler::Calibrate(float reference_temperature_celsius) noexcept {
     MutexLockGuard lock(mutex_);
     
@@ -492,17 +568,18 @@ hf_temp_err_t NtcTemperatureHandler::Calibrate(float reference_temperature_celsi
     }
     
     // Read current temperature
-    float current_temperature;
-    NtcError result = ntc_thermistor_->ReadTemperatureCelsius(&current_temperature);
+    ntc_temp_handler_reading_t reading = {};
+    NtcError result = AcquireReading(&reading);
     if (result != NtcError::Success) {
         return ConvertNtcError(result);
     }
     
     // Calculate offset
-    calibration_offset_ = reference_temperature_celsius - current_temperature;
+    calibration_offset_ = reference_temperature_celsius - reading.temperature_celsius;
     
     // Apply offset to thermistor
     ntc_thermistor_->SetCalibrationOffset(calibration_offset_);
+    ResetIncrementalLocked();
     
     diagnostics_.calibration_valid = true;
     statistics_.calibration_count++;
@@ -520,6 +597,7 @@ hf_temp_err_t NtcTemperatureHandler::SetCalibrationOffset(float offset_celsius)
     
     calibration_offset_ = offset_celsius;
     ntc_thermistor_->SetCalibrationOffset(offset_celsius);
+    ResetIncrementalLocked();
     diagnostics_.calibration_valid = true;
     
     Logger::GetInstance().Info(TAG, "Calibration offset set: %.2f°C", offset_celsius);
@@ -549,6 +627,7 @@ hf_temp_err_t NtcTemperatureHandler::ResetCalibration() noexcept {
     
     calibration_offset_ = 0.0f;
     ntc_thermistor_->SetCalibrationOffset(0.0f);
+    ResetIncrementalLocked();
     diagnostics_.calibration_valid = false;
     
     Logger::GetInstance().Info(TAG, "Calibration reset");
@@ -708,12 +787,13 @@ hf_temp_err_t NtcTemperatureHandler::SelfTest() noexcept {
         return TEMP_ERR_NOT_INITIALIZED;
     }
     // Basic self-test: attempt a temperature reading and validate range
-    float temperature = 0.0f;
-    NtcError result = ntc_thermistor_->ReadTemperatureCelsius(&temperature);
+    ntc_temp_handler_reading_t reading = {};
+    NtcError result = AcquireReading(&reading);
     if (result != NtcError::Success) {
         diagnostics_.sensor_healthy = false;
         return ConvertNtcError(result);
     }
+    const float temperature = reading.temperature_celsius;
     if (temperature < config_.min_temperature || temperature > config_.max_temperature) {
         diagnostics_.sensor_healthy = false;
         return TEMP_ERR_OUT_OF_RANGE;
@@ -757,7 +837,12 @@ NtcError NtcTemperatureHandler::GetResistance(float* resistance_ohms) noexcept {
     if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
         return NtcError::NotInitialized;
     }
-    return ntc_thermistor_->GetResistance(resistance_ohms);
+    ntc_temp_handler_reading_t reading = {};
+    NtcError result = AcquireReading(&reading);
+    if (result == NtcError::Success) {
+        *resistance_ohms = reading.resistance_ohms;
+    }
+    return result;
 }
 
 NtcError NtcTemperatureHandler::GetVoltage(float* voltage_volts) noexcept {
@@ -768,7 +853,12 @@ NtcError NtcTemperatureHandler::GetVoltage(float* voltage_volts) noexcept {
     if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
         return NtcError::NotInitialized;
     }
-    return ntc_thermistor_->GetVoltage(voltage_volts);
+    ntc_temp_handler_reading_t reading = {};
+    NtcError result = AcquireReading(&reading);
+    if (result == NtcError::Success) {
+        *voltage_volts = reading.voltage_volts;
+    }
+    return result;
 }
 
 NtcError NtcTemperatureHandler::GetRawAdcValue(uint32_t* adc_value) noexcept {
@@ -779,7 +869,12 @@ NtcError NtcTemperatureHandler::GetRawAdcValue(uint32_t* adc_value) noexcept {
     if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
         return NtcError::NotInitialized;
     }
-    return ntc_thermistor_->GetRawAdcValue(adc_value);
+    ntc_temp_handler_reading_t reading = {};
+    NtcError result = AcquireReading(&reading);
+    if (result == NtcError::Success) {
+        *adc_value = reading.raw_count;
+    }
+    return result;
 }
 
 NtcError NtcTemperatureHandler::SetConversionMethod(NtcConversionMethod method) noexcept {
@@ -795,7 +890,12 @@ NtcError NtcTemperatureHandler::SetVoltageDivider(float series_resistance) noexc
     if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
         return NtcError::NotInitialized;
     }
-    return ntc_thermistor_->SetVoltageDivider(series_resistance);
+    const NtcError result = ntc_thermistor_->SetVoltageDivider(series_resistance);
+    if (result == NtcError::Success) {
+        config_.voltage_divider_series_resistance = series_resistance;
+        RevalidateLutLocked();
+    }
+    return result;
 }
 
 NtcError NtcTemperatureHandler::SetReferenceVoltage(float reference_voltage) noexcept {
@@ -803,7 +903,12 @@ NtcError NtcTemperatureHandler::SetReferenceVoltage(float reference_voltage) noe
     if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
         return NtcError::NotInitialized;
     }
-    return ntc_thermistor_->SetReferenceVoltage(reference_voltage);
+    const NtcError result = ntc_thermistor_->SetReferenceVoltage(reference_voltage);
+    if (result == NtcError::Success) {
+        config_.reference_voltage = reference_voltage;
+        RevalidateLutLocked();
+    }
+    return result;
 }
 
 NtcError NtcTemperatureHandler::SetBetaValue(float beta_value) noexcept {
@@ -831,6 +936,11 @@ NtcError NtcTemperatureHandler::SetSamplingParameters(uint32_t sample_count,
     if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
         return NtcError::NotInitialized;
     }
+    if (incremental_sampling_) {
+        // sample_count is the window length; the driver stays at one sample.
+        ResetIncrementalLocked();
+        return NtcError::Success;
+    }
     return ntc_thermistor_->SetSamplingParameters(sample_count, sample_delay_ms);
 }
 
@@ -852,6 +962,165 @@ const char* NtcTemperatureHandler::GetSensorDescription() const noexcept {
     return config_.sensor_description;
 }
 
+//--------------------------------------
+//  Incremental Sampling
+//--------------------------------------
+
+hf_temp_err_t NtcTemperatureHandler::SetIncrementalSampling(bool enable) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
+        return TEMP_ERR_NOT_INITIALIZED;
+    }
+
+    // The driver must take a single sample per acquisition in incremental
+    // mode; restore the blocking parameters when leaving it.
+    NtcError result = enable
+        ? ntc_thermistor_->SetSamplingParameters(1, 0)
+        : ntc_thermistor_->SetSamplingParameters(config_.sample_count, config_.sample_delay_ms);
+    if (result != NtcError::Success) {
+        return ConvertNtcError(result);
+    }
+
+    config_.incremental_sampling = enable;
+    incremental_sampling_ = enable;
+    ResetIncrementalLocked();
+    Logger::GetInstance().Info(TAG, "Sampling mode: %s (window %u)",
+                               enable ? "incremental" : "blocking",
+                               static_cast<unsigned>(IncrementalWindowLocked()));
+    return TEMP_SUCCESS;
+}
+
+bool NtcTemperatureHandler::IsIncrementalSampling() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return incremental_sampling_;
+}
+
+void NtcTemperatureHandler::GetIncrementalFill(uint32_t* filled, uint32_t* window) const noexcept {
+    MutexLockGuard lock(mutex_);
+    if (filled != nullptr) {
+        *filled = incremental_filled_;
+    }
+    if (window != nullptr) {
+        *window = IncrementalWindowLocked();
+    }
+}
+
+//--------------------------------------
+//  Fixed-Point LUT Conversion
+//--------------------------------------
+
+hf_temp_err_t NtcTemperatureHandler::SetFixedPointLut(const NtcFixedPointLut* lut) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (lut != nullptr &&
+        (!lut->IsValid() || !LutMatchesConfigLocked(*lut) || (initialized_ && !LutMatchesAdcLocked(*lut)))) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+    fixed_point_lut_ = lut;
+    ResetIncrementalLocked();
+    Logger::GetInstance().Info(TAG, "Conversion path: %s",
+                               lut != nullptr ? "fixed-point LUT" : "float (driver)");
+    return TEMP_SUCCESS;
+}
+
+bool NtcTemperatureHandler::LutMatchesConfigLocked(const NtcFixedPointLut& lut) const noexcept {
+    if (config_.voltage_divider_parallel_resistance > 0.0f) {
+        Logger::GetInstance().Error(TAG, "Fixed-point LUT does not model a parallel resistor");
+        return false;
+    }
+    if (!lut.MatchesConfig(config_.voltage_divider_series_resistance, config_.reference_voltage,
+                           config_.adc_resolution_bits)) {
+        Logger::GetInstance().Error(TAG, "LUT built for %.0f ohm / %.3f V / %u bits, config is %.0f ohm / %.3f V / %u bits",
+                                    static_cast<double>(lut.GetSeriesResistanceOhms()),
+                                    static_cast<double>(lut.GetReferenceVoltage()),
+                                    static_cast<unsigned>(lut.GetResolutionBits()),
+                                    static_cast<double>(config_.voltage_divider_series_resistance),
+                                    static_cast<double>(config_.reference_voltage),
+                                    static_cast<unsigned>(config_.adc_resolution_bits));
+        return false;
+    }
+    return true;
+}
+
+bool NtcTemperatureHandler::LutMatchesAdcLocked(const NtcFixedPointLut& lut) noexcept {
+    uint32_t count = 0;
+    float volts = 0.0f;
+    if (ntc_adc_adapter_ == nullptr ||
+        ntc_adc_adapter_->ReadChannelCount(config_.adc_channel, &count) != ntc::AdcError::Success ||
+        ntc_adc_adapter_->ReadChannelV(config_.adc_channel, &volts) != ntc::AdcError::Success) {
+        Logger::GetInstance().Error(TAG, "Cannot read ADC channel %u to check the LUT",
+                                    static_cast<unsigned>(config_.adc_channel));
+        return false;
+    }
+    if (!lut.MatchesAdcReading(count, volts)) {
+        Logger::GetInstance().Error(TAG, "ADC read %lu counts at %.3f V; the LUT expects %.0f counts",
+                                    static_cast<unsigned long>(count), static_cast<double>(volts),
+                                    static_cast<double>(volts * static_cast<float>(1UL << lut.GetResolutionBits()) /
+                                                        lut.GetReferenceVoltage()));
+        return false;
+    }
+    return true;
+}
+
+void NtcTemperatureHandler::RevalidateLutLocked() noexcept {
+    if (fixed_point_lut_ != nullptr && !LutMatchesConfigLocked(*fixed_point_lut_)) {
+        Logger::GetInstance().Warn(TAG, "Fixed-point LUT dropped, using the float path");
+        fixed_point_lut_ = nullptr;
+        ResetIncrementalLocked();
+    }
+}
+
+bool NtcTemperatureHandler::IsFixedPointLutActive() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return fixed_point_lut_ != nullptr;
+}
+
+hf_temp_err_t NtcTemperatureHandler::ReadTemperatureCentiCelsius(int32_t* centi_celsius) noexcept {
+    if (centi_celsius == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+
+    MutexLockGuard lock(mutex_);
+    if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
+        return TEMP_ERR_NOT_INITIALIZED;
+    }
+
+    ntc_temp_handler_reading_t reading = {};
+    hf_temp_err_t result = ReadAndRecord(&reading);
+    if (result == TEMP_SUCCESS) {
+        *centi_celsius = reading.temperature_centi_celsius;
+    }
+    return result;
+}
+
+//--------------------------------------
+//  Combined Readings
+//--------------------------------------
+
+hf_temp_err_t NtcTemperatureHandler::ReadCombined(ntc_temp_handler_reading_t* reading) noexcept {
+    if (reading == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+
+    MutexLockGuard lock(mutex_);
+    if (!EnsureInitialized() || ntc_thermistor_ == nullptr) {
+        return TEMP_ERR_NOT_INITIALIZED;
+    }
+    return ReadAndRecord(reading);
+}
+
+hf_temp_err_t NtcTemperatureHandler::GetLastReading(ntc_temp_handler_reading_t* reading) const noexcept {
+    if (reading == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+
+    MutexLockGuard lock(mutex_);
+    if (!last_reading_valid_) {
+        return TEMP_ERR_INVALID_READING;
+    }
+    *reading = last_reading_;
+    return TEMP_SUCCESS;
+}
+
 NtcThermistorConcrete* NtcTemperatureHandler::GetDriver() noexcept {
     MutexLockGuard lock(mutex_);
     if (!initialized_) return nullptr;
@@ -929,6 +1198,158 @@ void NtcTemperatureHandler::CheckThresholds(float temperature_celsius) noexcept
     }
 }
 
+NtcError NtcTemperatureHandler::AcquireReading(ntc_temp_handler_reading_t* reading) noexcept {
+    if (ntc_adc_adapter_ == nullptr || ntc_thermistor_ == nullptr) {
+        return NtcError::NotInitialized;
+    }
+
+    if (!incremental_sampling_) {
+        const uint32_t samples = (config_.sample_count > 0) ? config_.sample_count : 1U;
+        return AcquireSamples(reading, samples, config_.sample_delay_ms);
+    }
+
+    // Incremental mode: exactly one sample per call, never sleeps.
+    ntc_temp_handler_reading_t sample = {};
+    NtcError result = AcquireSamples(&sample, 1, 0);
+    if (result != NtcError::Success) {
+        return result;
+    }
+    PushIncrementalSample(sample, reading);
+    return NtcError::Success;
+}
+
+NtcError NtcTemperatureHandler::AcquireSamples(ntc_temp_handler_reading_t* reading,
+                                               uint32_t samples, uint32_t delay_ms) noexcept {
+    if (fixed_point_lut_ == nullptr) {
+        // One driver acquisition yields raw count, voltage, resistance and
+        // temperature together, so they always describe the same sample.
+        // The driver applies its own sampling parameters.
+        ntc_reading_t ntc_reading = {};
+        NtcError result = ntc_thermistor_->ReadTemperature(&ntc_reading);
+        if (result != NtcError::Success) {
+            return result;
+        }
+        const float celsius = ntc_reading.temperature_celsius;
+        reading->raw_count = ntc_reading.adc_raw_value;
+        reading->voltage_volts = ntc_reading.voltage_volts;
+        reading->resistance_ohms = ntc_reading.resistance_ohms;
+        reading->temperature_celsius = celsius;
+        reading->temperature_centi_celsius =
+            static_cast<int32_t>(celsius * 100.0f + (celsius >= 0.0f ? 0.5f : -0.5f));
+        reading->sample_count = samples;
+        reading->timestamp_us = GetCurrentTimeUs();
+        return NtcError::Success;
+    }
+
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < samples; ++i) {
+        uint32_t count = 0;
+        if (ntc_adc_adapter_->ReadChannelCount(config_.adc_channel, &count) != ntc::AdcError::Success) {
+            return NtcError::AdcReadFailed;
+        }
+        sum += count;
+        if (delay_ms > 0 && i + 1 < samples) {
+            os_delay_msec(static_cast<uint16_t>(delay_ms));
+        }
+    }
+
+    const auto average = static_cast<uint32_t>((sum + samples / 2) / samples);
+    FillLutReading(average, reading);
+    reading->sample_count = samples;
+    reading->timestamp_us = GetCurrentTimeUs();
+    return NtcError::Success;
+}
+
+void NtcTemperatureHandler::FillLutReading(uint32_t raw_count, ntc_temp_handler_reading_t* reading) const noexcept {
+    const auto offset_centi = static_cast<int32_t>(
+        calibration_offset_ * 100.0f + (calibration_offset_ >= 0.0f ? 0.5f : -0.5f));
+    const int32_t centi = fixed_point_lut_->CountToCentiCelsius(raw_count) + offset_centi;
+
+    reading->raw_count = raw_count;
+    reading->voltage_volts = fixed_point_lut_->CountToVolts(raw_count);
+    reading->resistance_ohms = fixed_point_lut_->CountToResistanceOhms(raw_count);
+    reading->temperature_centi_celsius = centi;
+    reading->temperature_celsius = static_cast<float>(centi) * 0.01f;
+}
+
+void NtcTemperatureHandler::PushIncrementalSample(const ntc_temp_handler_reading_t& sample,
+                                                  ntc_temp_handler_reading_t* reading) noexcept {
+    const uint32_t window = IncrementalWindowLocked();
+    if (incremental_filled_ > window || incremental_head_ >= window) {
+        ResetIncrementalLocked();
+    }
+
+    // Boxcar window: drop the oldest sample once full, then add the new one.
+    if (incremental_filled_ == window) {
+        incremental_raw_sum_ -= incremental_raw_[incremental_head_];
+        incremental_centi_sum_ -= incremental_centi_[incremental_head_];
+    } else {
+        ++incremental_filled_;
+    }
+    incremental_raw_[incremental_head_] = sample.raw_count;
+    incremental_centi_[incremental_head_] = sample.temperature_centi_celsius;
+    incremental_raw_sum_ += sample.raw_count;
+    incremental_centi_sum_ += sample.temperature_centi_celsius;
+    incremental_head_ = (incremental_head_ + 1U) % window;
+
+    const uint32_t filled = incremental_filled_;
+    const auto raw_average = static_cast<uint32_t>((incremental_raw_sum_ + filled / 2) / filled);
+
+    *reading = sample;
+    if (fixed_point_lut_ != nullptr) {
+        // Average counts, then convert once: identical to a blocking read.
+        FillLutReading(raw_average, reading);
+    } else {
+        // Driver path: average the converted temperatures; voltage and
+        // resistance describe the newest sample.
+        const int64_t centi_sum = incremental_centi_sum_;
+        const auto half = static_cast<int64_t>(filled / 2);
+        const auto centi = static_cast<int32_t>(
+            (centi_sum >= 0 ? centi_sum + half : centi_sum - half) / static_cast<int64_t>(filled));
+        reading->raw_count = raw_average;
+        reading->temperature_centi_celsius = centi;
+        reading->temperature_celsius = static_cast<float>(centi) * 0.01f;
+    }
+    reading->sample_count = filled;
+}
+
+uint32_t NtcTemperatureHandler::IncrementalWindowLocked() const noexcept {
+    uint32_t window = (config_.sample_count > 0) ? config_.sample_count : 1U;
+    return (window > kMaxIncrementalSamples) ? kMaxIncrementalSamples : window;
+}
+
+void NtcTemperatureHandler::ResetIncrementalLocked() noexcept {
+    incremental_raw_sum_ = 0;
+    incremental_centi_sum_ = 0;
+    incremental_head_ = 0;
+    incremental_filled_ = 0;
+}
+
+hf_temp_err_t NtcTemperatureHandler::ReadAndRecord(ntc_temp_handler_reading_t* reading) noexcept {
+    const auto start_time = os_time_get();
+    NtcError result = AcquireReading(reading);
+    const auto operation_time = static_cast<hf_u32_t>(os_time_get() - start_time);
+
+    if (result != NtcError::Success) {
+        UpdateStatistics(false, operation_time);
+        hf_temp_err_t temp_error = ConvertNtcError(result);
+        UpdateDiagnostics(temp_error);
+        return temp_error;
+    }
+
+    UpdateStatistics(true, operation_time);
+    UpdateDiagnostics(TEMP_SUCCESS);
+    diagnostics_.current_temperature_raw = static_cast<hf_u32_t>(reading->raw_count);
+    last_reading_ = *reading;
+    last_reading_valid_ = true;
+    CheckThresholds(reading->temperature_celsius);
+    return TEMP_SUCCESS;
+}
+
+hf_u64_t NtcTemperatureHandler::GetCurrentTimeUs() noexcept {
+    return RtosTime::GetCurrentTimeUs();
+}
+
 hf_temp_err_t NtcTemperatureHandler::ConvertNtcError(NtcError ntc_error) const noexcept {
     switch (ntc_error) {
         case NtcError::Success:
@@ -972,18 +1393,28 @@ hf_temp_err_t NtcTemperatureHandler::ConvertNtcError(NtcError ntc_error) const n
 void NtcTemperatureHandler::ContinuousMonitoringCallback(uint32_t arg) {
     auto* handler = ResolveMonitoringContext(arg);
     if (handler == nullptr) {
+        // Tick raced with StopContinuousMonitoring(); the ID is stale.
+        stale_callback_count_.fetch_add(1, std::memory_order_relaxed);
         return;
     }
     
-    // Read temperature
+    // The resolved tick is counted in flight: StopContinuousMonitoring() and
+    // the destructor wait for it, so the handler stays valid until released.
     hf_temp_reading_t reading = {};
     hf_temp_err_t error = handler->ReadTemperature(&reading);
     (void)error;
-    
-    // Call user callback if provided
-    if (handler->continuous_callback_ != nullptr) {
-        handler->continuous_callback_(handler, &reading, handler->continuous_user_data_);
+
+    hf_temp_reading_callback_t callback = nullptr;
+    void* user_data = nullptr;
+    {
+        MutexLockGuard lock(handler->mutex_);
+        callback = handler->continuous_callback_;
+        user_data = handler->continuous_user_data_;
+    }
+    if (callback != nullptr) {
+        callback(handler, &reading, user_data);
     }
+    ReleaseMonitoringContext(arg);
 }
 
 hf_u32_t NtcTemperatureHandler::RegisterMonitoringContext(NtcTemperatureHandler* handler) noexcept {
@@ -991,42 +1422,79 @@ hf_u32_t NtcTemperatureHandler::RegisterMonitoringContext(NtcTemperatureHandler*
         return 0;
     }
 
-    MutexLockGuard lock(callback_registry_mutex_);
-    if (!lock.IsLocked()) {
-        return 0;
-    }
-
     for (hf_u32_t idx = 0; idx < kMonitoringContextSlots; ++idx) {
-        if (callback_registry_[idx] == nullptr) {
-            callback_registry_[idx] = handler;
-            return idx + 1;  // Reserve 0 as invalid ID.
+        hf_u32_t tag = callback_registry_tags_[idx].load(std::memory_order_relaxed);
+        if ((tag & 1U) != 0) {
+            continue;
+        }
+        // Claim the slot and advance its generation in one step.
+        const hf_u32_t claimed = ((tag + 2U) | 1U) & kMonitoringTagMask;
+        if (!callback_registry_tags_[idx].compare_exchange_strong(tag, claimed, std::memory_order_acq_rel)) {
+            continue;
         }
+        callback_registry_[idx].store(handler, std::memory_order_release);
+        return (claimed << kMonitoringSlotBits) | (idx + 1);  // Never 0.
     }
     return 0;
 }
 
 void NtcTemperatureHandler::UnregisterMonitoringContext(hf_u32_t context_id) noexcept {
-    if (context_id == 0 || context_id > kMonitoringContextSlots) {
+    const hf_u32_t slot = context_id & kMonitoringSlotMask;
+    if (slot == 0 || slot > kMonitoringContextSlots) {
         return;
     }
 
-    MutexLockGuard lock(callback_registry_mutex_);
-    if (!lock.IsLocked()) {
-        return;
-    }
-
-    callback_registry_[context_id - 1] = nullptr;
+    // Only the registration that owns the current tag may release the slot.
+    // Clearing the occupied bit is enough to invalidate the ID; the pointer
+    // is left in place because a new registration may already be storing its own.
+    hf_u32_t tag = context_id >> kMonitoringSlotBits;
+    callback_registry_tags_[slot - 1].compare_exchange_strong(tag, tag & ~1U, std::memory_order_acq_rel);
 }
 
 NtcTemperatureHandler* NtcTemperatureHandler::ResolveMonitoringContext(hf_u32_t context_id) noexcept {
-    if (context_id == 0 || context_id > kMonitoringContextSlots) {
+    const hf_u32_t slot = context_id & kMonitoringSlotMask;
+    if (slot == 0 || slot > kMonitoringContextSlots) {
         return nullptr;
     }
 
-    MutexLockGuard lock(callback_registry_mutex_);
-    if (!lock.IsLocked()) {
-        return nullptr;
+    // Count the tick in flight before validating: an unregistration that
+    // clears the tag afterwards then waits for it, one that cleared it
+    // before makes the check below fail.
+    auto& in_flight = callback_registry_in_flight_[slot - 1];
+    in_flight.fetch_add(1, std::memory_order_acq_rel);
+
+    // Tag / pointer / tag: the pointer is only trusted if the slot still
+    // carries the ID's tag on both sides of the load.
+    const hf_u32_t tag = context_id >> kMonitoringSlotBits;
+    NtcTemperatureHandler* handler = nullptr;
+    if (callback_registry_tags_[slot - 1].load(std::memory_order_acquire) == tag) {
+        handler = callback_registry_[slot - 1].load(std::memory_order_acquire);
+        if (callback_registry_tags_[slot - 1].load(std::memory_order_acquire) != tag) {
+            handler = nullptr;
+        }
+    }
+    if (handler == nullptr) {
+        in_flight.fetch_sub(1, std::memory_order_release);
+    }
+    return handler;
+}
+
+void NtcTemperatureHandler::ReleaseMonitoringContext(hf_u32_t context_id) noexcept {
+    callback_registry_in_flight_[(context_id & kMonitoringSlotMask) - 1].fetch_sub(1, std::memory_order_release);
+}
+
+void NtcTemperatureHandler::WaitMonitoringContextIdle(hf_u32_t context_id) noexcept {
+    const hf_u32_t slot = context_id & kMonitoringSlotMask;
+    if (slot == 0 || slot > kMonitoringContextSlots) {
+        return;
+    }
+    // Ticks that resolve after the unregistration drop out on their own; the
+    // count only stays up while a resolved tick is still running.
+    while (callback_registry_in_flight_[slot - 1].load(std::memory_order_acquire) != 0) {
+        os_delay_msec(1);
     }
+}
 
-    return callback_registry_[context_id - 1];
+hf_u32_t NtcTemperatureHandler::GetStaleMonitoringCallbackCount() noexcept {
+    return stale_callback_count_.load(std::memory_order_relaxed);
 }
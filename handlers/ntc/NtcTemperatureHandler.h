@@ -16,12 +16,15 @@
 #include "core/hf-core-drivers/internal/hf-internal-interface-wrap/inc/base/BaseTemperature.h"
 #include "core/hf-core-drivers/internal/hf-internal-interface-wrap/inc/base/BaseAdc.h"
 #include "core/hf-core-drivers/external/hf-ntc-thermistor-driver/inc/ntc_thermistor.hpp"
+#include "NtcFixedPointLut.h"
 #include "RtosMutex.h"
 #include "core/hf-core-utils/hf-utils-rtos-wrap/include/PeriodicTimer.h"
+#include "TemperatureSamplingScheduler.h"
 
 #include <memory>
 #include <cfloat>
 #include <array>
+#include <atomic>
 
 //--------------------------------------
 //  NTC ADC Adapter (BaseAdc → ntc::AdcInterface bridge)
@@ -107,6 +110,8 @@ typedef struct {
     void* threshold_user_data;              ///< Threshold callback user data
     const char* sensor_name;                ///< Sensor name/identifier
     const char* sensor_description;         ///< Sensor description
+    bool incremental_sampling;              ///< One sample per read, sample_count-long moving window
+    uint8_t adc_resolution_bits;            ///< ADC resolution (bits, 0 = 12); checked against a fixed-point LUT
 } ntc_temp_handler_config_t;
 
 /**
@@ -133,9 +138,27 @@ typedef struct {
     .threshold_callback = nullptr, \
     .threshold_user_data = nullptr, \
     .sensor_name = "NTC_Temperature_Sensor", \
-    .sensor_description = "NTC Thermistor Temperature Sensor" \
+    .sensor_description = "NTC Thermistor Temperature Sensor", \
+    .incremental_sampling = false, \
+    .adc_resolution_bits = 12 \
 }
 
+/**
+ * @brief Combined result of one NTC acquisition.
+ *
+ * Every field is derived from the same ADC sample (or the same averaged
+ * sample set), so the raw count always matches the converted temperature.
+ */
+typedef struct {
+    uint32_t raw_count;                     ///< Raw ADC count (averaged over sample_count)
+    float voltage_volts;                    ///< Voltage at the ADC node (V)
+    float resistance_ohms;                  ///< Thermistor resistance (ohms)
+    float temperature_celsius;              ///< Temperature, calibration applied (°C)
+    int32_t temperature_centi_celsius;      ///< Temperature, calibration applied (0.01 °C)
+    uint32_t sample_count;                  ///< Samples averaged into this reading
+    hf_u64_t timestamp_us;                  ///< Acquisition timestamp (µs)
+} ntc_temp_handler_reading_t;
+
 //--------------------------------------
 //  NtcTemperatureHandler Class
 //--------------------------------------
@@ -154,6 +177,7 @@ typedef struct {
  * - Hardware-agnostic design using BaseAdc
  * - Support for multiple NTC types
  * - Dual conversion methods (lookup table and mathematical)
+ * - Optional compile-time fixed-point LUT conversion (no floating-point log)
  * - Built-in calibration and filtering
  * - Comprehensive error handling
  * - Thread-safe operations
@@ -228,6 +252,7 @@ public:
     hf_temp_err_t EnableThresholdMonitoring(hf_temp_threshold_callback_t callback, void* user_data) noexcept override;
     hf_temp_err_t DisableThresholdMonitoring() noexcept override;
     hf_temp_err_t StartContinuousMonitoring(hf_u32_t sample_rate_hz, hf_temp_reading_callback_t callback, void* user_data) noexcept override;
+    /// Waits for an in-flight monitoring tick; must not be called from the monitoring callback.
     hf_temp_err_t StopContinuousMonitoring() noexcept override;
     bool IsMonitoringActive() const noexcept override;
     hf_temp_err_t SetCalibrationOffset(float offset_celsius) noexcept override;
@@ -373,6 +398,149 @@ public:
      */
     const char* GetSensorDescription() const noexcept;
 
+    //==============================================================//
+    // COMBINED READINGS
+    //==============================================================//
+
+    /**
+     * @brief Acquire once and return raw count, voltage, resistance and temperature.
+     *
+     * This is the same acquisition every temperature read performs; statistics,
+     * diagnostics and threshold checks are updated exactly as for
+     * ReadTemperatureCelsius().
+     *
+     * @param reading Pointer to store the combined reading
+     * @return Error code
+     */
+    hf_temp_err_t ReadCombined(ntc_temp_handler_reading_t* reading) noexcept;
+
+    /**
+     * @brief Get the most recent successful reading without touching the ADC.
+     * @param reading Pointer to store the combined reading
+     * @return TEMP_SUCCESS, or TEMP_ERR_INVALID_READING if nothing was read yet
+     */
+    hf_temp_err_t GetLastReading(ntc_temp_handler_reading_t* reading) const noexcept;
+
+    //==============================================================//
+    // SHARED SAMPLING SCHEDULER
+    //==============================================================//
+
+    /**
+     * @brief Drive continuous monitoring from a shared sampling task.
+     *
+     * With a scheduler attached, StartContinuousMonitoring() registers the
+     * handler with it instead of creating a per-handler PeriodicTimer, so
+     * many sensors share one task and sensors with equal rates are read in
+     * the same wakeup. Combine with SetIncrementalSampling(true) to keep
+     * each scheduled read to a single ADC conversion.
+     *
+     * @param scheduler Scheduler (must outlive the registration), or nullptr
+     *                  for the per-handler timer
+     * @return TEMP_SUCCESS, or TEMP_ERR_BUSY while monitoring is active
+     */
+    hf_temp_err_t SetSamplingScheduler(TemperatureSamplingScheduler* scheduler) noexcept;
+
+    /**
+     * @brief Get the scheduler ID of the active monitoring registration.
+     * @return Sensor ID for TemperatureSamplingScheduler::GetSensorStats(),
+     *         or 0 when not monitoring through a scheduler
+     */
+    hf_u32_t GetSchedulerSensorId() const noexcept;
+
+    /**
+     * @brief Number of PeriodicTimer callbacks that arrived with a stale context ID.
+     *
+     * Counts timer ticks still in flight after StopContinuousMonitoring()
+     * (across all NTC handlers); they are detected and dropped.
+     *
+     * @return Stale callback count
+     */
+    static hf_u32_t GetStaleMonitoringCallbackCount() noexcept;
+
+    //==============================================================//
+    // INCREMENTAL SAMPLING
+    //==============================================================//
+
+    /**
+     * @brief Switch between blocking and incremental oversampling.
+     *
+     * Blocking (default): each read takes sample_count samples spaced
+     * sample_delay_ms apart and sleeps in between.
+     *
+     * Incremental: each read (or continuous-monitoring tick) takes exactly one
+     * sample, adds it to a moving window of sample_count samples (capped at
+     * kMaxIncrementalSamples) and returns the window average immediately.
+     * sample_delay_ms is ignored — the sample spacing is the caller's read
+     * rate. GetLastReading() always holds the latest window average.
+     *
+     * @param enable true for incremental mode
+     * @return Error code
+     */
+    hf_temp_err_t SetIncrementalSampling(bool enable) noexcept;
+
+    /**
+     * @brief Check whether incremental sampling is active.
+     * @return true in incremental mode
+     */
+    bool IsIncrementalSampling() const noexcept;
+
+    /**
+     * @brief Get the incremental window fill level.
+     * @param filled Samples currently in the window (may be nullptr)
+     * @param window Window length (may be nullptr)
+     */
+    void GetIncrementalFill(uint32_t* filled, uint32_t* window) const noexcept;
+
+    /// Longest incremental averaging window (samples).
+    static constexpr uint32_t kMaxIncrementalSamples = 32;
+
+    /// ADC resolution used when the configuration leaves adc_resolution_bits at 0.
+    static constexpr uint8_t kDefaultAdcResolutionBits = 12;
+
+    //==============================================================//
+    // FIXED-POINT LUT CONVERSION
+    //==============================================================//
+
+    /**
+     * @brief Convert readings through a fixed-point lookup table.
+     *
+     * While a table is installed, temperature reads take the raw ADC count
+     * (averaged over sample_count samples) and convert it with
+     * NtcFixedPointLut::CountToCentiCelsius() instead of the driver's Beta /
+     * Steinhart-Hart path. The calibration offset still applies; driver-side
+     * EMA filtering does not.
+     *
+     * The table must match the configuration: series resistance and reference
+     * voltage within 1%, adc_resolution_bits equal, and no parallel resistor
+     * (the table does not model one). Once initialized, one count and one
+     * voltage read from the ADC are also checked against the table's scaling
+     * (NtcFixedPointLut::MatchesAdcReading()). A table installed before
+     * Initialize() gets that check there and is dropped on mismatch.
+     *
+     * @param lut Table to use (must outlive the handler, typically a
+     *            `static constexpr` object), or nullptr for the float path.
+     * @return TEMP_SUCCESS, or TEMP_ERR_INVALID_PARAMETER if the table is
+     *         invalid or does not match the configuration or the ADC.
+     */
+    hf_temp_err_t SetFixedPointLut(const NtcFixedPointLut* lut) noexcept;
+
+    /**
+     * @brief Check whether reads are converted through a fixed-point LUT.
+     * @return true if a table is installed
+     */
+    bool IsFixedPointLutActive() const noexcept;
+
+    /**
+     * @brief Read temperature in centi-degrees Celsius (0.01 °C).
+     *
+     * Uses the fixed-point table when installed; otherwise converts the
+     * driver's float reading.
+     *
+     * @param centi_celsius Pointer to store temperature (0.01 °C)
+     * @return Error code
+     */
+    hf_temp_err_t ReadTemperatureCentiCelsius(int32_t* centi_celsius) noexcept;
+
     //==============================================================//
     // DIRECT DRIVER ACCESS
     //==============================================================//
@@ -411,7 +579,19 @@ private:
     void* continuous_user_data_;            ///< Continuous monitoring callback user data
     PeriodicTimer monitoring_timer_;        ///< Hardware-agnostic periodic timer
     hf_u32_t monitoring_context_id_;        ///< Timer callback context ID (0 = unassigned)
+    TemperatureSamplingScheduler* sampling_scheduler_; ///< Shared scheduler (nullptr = own timer)
+    hf_u32_t scheduler_sensor_id_;          ///< Scheduler registration ID (0 = none)
     float calibration_offset_;             ///< Current calibration offset
+    const NtcFixedPointLut* fixed_point_lut_; ///< Fixed-point conversion table (nullptr = float path)
+    ntc_temp_handler_reading_t last_reading_; ///< Most recent successful acquisition
+    
+    // Incremental sampling window (ring of per-sample values + running sums)
+    std::array<uint32_t, kMaxIncrementalSamples> incremental_raw_;   ///< Raw counts
+    std::array<int32_t, kMaxIncrementalSamples> incremental_centi_;  ///< Temperatures (0.01 °C)
+    uint64_t incremental_raw_sum_;          ///< Sum of incremental_raw_ in the window
+    int64_t incremental_centi_sum_;         ///< Sum of incremental_centi_ in the window
+    uint32_t incremental_head_;             ///< Next ring slot to write
+    uint32_t incremental_filled_;           ///< Samples in the window
     
     // Statistics and diagnostics
     hf_temp_statistics_t statistics_;       ///< BaseTemperature statistics
@@ -421,6 +601,8 @@ private:
     bool initialized_;                      ///< Initialization status
     bool threshold_monitoring_enabled_;     ///< Threshold monitoring status
     bool monitoring_active_;               ///< Continuous monitoring status
+    bool last_reading_valid_;              ///< last_reading_ holds a successful acquisition
+    bool incremental_sampling_;            ///< Incremental (non-blocking) sampling active
     
     //==============================================================//
     // PRIVATE HELPER METHODS
@@ -451,6 +633,60 @@ private:
      */
     bool InitializeNtcThermistor() noexcept;
     
+    /**
+     * @brief Perform one acquisition (driver float path or fixed-point LUT)
+     * @param reading Pointer to store the combined reading
+     * @return NTC error code
+     */
+    NtcError AcquireReading(ntc_temp_handler_reading_t* reading) noexcept;
+
+    /**
+     * @brief Acquire and average a block of samples (blocking path)
+     * @param reading Pointer to store the combined reading
+     * @param samples Samples to average (LUT path; the driver uses its own setting)
+     * @param delay_ms Delay between samples (ms)
+     * @return NTC error code
+     */
+    NtcError AcquireSamples(ntc_temp_handler_reading_t* reading, uint32_t samples,
+                            uint32_t delay_ms) noexcept;
+
+    /**
+     * @brief Fill raw/voltage/resistance/temperature of a reading from a raw count via the LUT
+     * @param raw_count Raw ADC count
+     * @param reading Reading to fill
+     */
+    void FillLutReading(uint32_t raw_count, ntc_temp_handler_reading_t* reading) const noexcept;
+
+    /** @brief Check a LUT against config_, logging the mismatch (caller holds mutex_). */
+    bool LutMatchesConfigLocked(const NtcFixedPointLut& lut) const noexcept;
+
+    /** @brief Check a LUT against one count / voltage read from the ADC (caller holds mutex_, initialized). */
+    bool LutMatchesAdcLocked(const NtcFixedPointLut& lut) noexcept;
+
+    /** @brief Drop the installed LUT if it no longer matches config_ (caller holds mutex_). */
+    void RevalidateLutLocked() noexcept;
+
+    /**
+     * @brief Add one sample to the incremental window and produce the window average (caller holds mutex_)
+     * @param sample Newest single-sample reading
+     * @param reading Pointer to store the averaged reading
+     */
+    void PushIncrementalSample(const ntc_temp_handler_reading_t& sample,
+                               ntc_temp_handler_reading_t* reading) noexcept;
+
+    /** @brief Current incremental window length (caller holds mutex_). */
+    uint32_t IncrementalWindowLocked() const noexcept;
+
+    /** @brief Empty the incremental window (caller holds mutex_). */
+    void ResetIncrementalLocked() noexcept;
+
+    /**
+     * @brief Acquire and update statistics, diagnostics, last reading and thresholds (caller holds mutex_)
+     * @param reading Pointer to store the combined reading
+     * @return Error code
+     */
+    hf_temp_err_t ReadAndRecord(ntc_temp_handler_reading_t* reading) noexcept;
+
     /**
      * @brief Convert NTC error to BaseTemperature error
      * @param ntc_error NTC error code
@@ -472,14 +708,37 @@ private:
 
     /**
      * @brief Register/unregister callback context IDs for timer callbacks.
+     *
+     * Lock-free: each slot pairs a handler pointer with a tag holding a
+     * generation counter and an occupied bit. A context ID encodes the slot
+     * and the tag it was issued with, so IDs of a stopped registration stay
+     * invalid even after the slot is reused.
      */
     static hf_u32_t RegisterMonitoringContext(NtcTemperatureHandler* handler) noexcept;
     static void UnregisterMonitoringContext(hf_u32_t context_id) noexcept;
     static NtcTemperatureHandler* ResolveMonitoringContext(hf_u32_t context_id) noexcept;
 
+    /**
+     * @brief In-flight accounting for resolved timer ticks.
+     *
+     * A successful ResolveMonitoringContext() counts the tick in its slot
+     * until ReleaseMonitoringContext(). WaitMonitoringContextIdle() blocks
+     * (with mutex_ not held) until an unregistered ID's ticks have finished.
+     */
+    static void ReleaseMonitoringContext(hf_u32_t context_id) noexcept;
+    static void WaitMonitoringContextIdle(hf_u32_t context_id) noexcept;
+
     static constexpr hf_u32_t kMonitoringContextSlots = 8;
-    static RtosMutex callback_registry_mutex_;
-    static std::array<NtcTemperatureHandler*, kMonitoringContextSlots> callback_registry_;
+    static constexpr hf_u32_t kMonitoringSlotBits = 4;    ///< Low ID bits: slot index + 1
+    static constexpr hf_u32_t kMonitoringSlotMask = (1U << kMonitoringSlotBits) - 1U;
+    static constexpr hf_u32_t kMonitoringTagMask = 0xFFFFFFFFU >> kMonitoringSlotBits;
+    static_assert(kMonitoringContextSlots <= kMonitoringSlotMask, "slot index must fit the ID");
+
+    /// Slot tag: (generation << 1) | occupied.
+    static std::array<std::atomic<hf_u32_t>, kMonitoringContextSlots> callback_registry_tags_;
+    static std::array<std::atomic<NtcTemperatureHandler*>, kMonitoringContextSlots> callback_registry_;
+    static std::array<std::atomic<hf_u32_t>, kMonitoringContextSlots> callback_registry_in_flight_; ///< Ticks past resolving
+    static std::atomic<hf_u32_t> stale_callback_count_;   ///< Timer ticks that resolved a stale ID
     
     /**
      * @brief Update BaseTemperature diagnostics
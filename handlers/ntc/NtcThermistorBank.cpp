@@ -0,0 +1,357 @@
+/**
+ * @file NtcThermistorBank.cpp
+ * @brief Implementation of the multi-thermistor batch scanner.
+ *
+ * @see NtcThermistorBank.h for architectural overview and Doxygen documentation.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#include "NtcThermistorBank.h"
+#include "handlers/logger/Logger.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/OsUtility.h"
+
+static const char* TAG = "NtcThermistorBank";
+
+// =====================================================================
+// NtcBankChannel
+// =====================================================================
+
+NtcBankChannel::NtcBankChannel(NtcThermistorBank& bank, uint8_t index) noexcept
+    : BaseTemperature(), bank_(bank), index_(index) {}
+
+const char* NtcBankChannel::GetSensorName() const noexcept {
+    return bank_.GetChannelName(index_);
+}
+
+bool NtcBankChannel::Initialize() noexcept {
+    return bank_.EnsureAdcInitialized();
+}
+
+bool NtcBankChannel::Deinitialize() noexcept {
+    // The bank owns the ADC access; nothing to release per view.
+    return true;
+}
+
+hf_temp_err_t NtcBankChannel::ReadTemperatureCelsiusImpl(float* temperature_celsius) noexcept {
+    if (temperature_celsius == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+    return bank_.ReadForView(index_, temperature_celsius);
+}
+
+hf_temp_err_t NtcBankChannel::GetSensorInfo(hf_temp_sensor_info_t* info) const noexcept {
+    if (info == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+    info->sensor_type = HF_TEMP_SENSOR_TYPE_THERMISTOR;
+    info->min_temp_celsius = -40.0f;
+    info->max_temp_celsius = 125.0f;
+    info->resolution_celsius = 0.01f;
+    info->accuracy_celsius = 1.0f;
+    info->response_time_ms = 100;
+    info->capabilities = HF_TEMP_CAP_NONE;
+    info->manufacturer = "Generic";
+    info->model = "NTC Thermistor (bank)";
+    info->version = "1.0";
+    return TEMP_SUCCESS;
+}
+
+hf_u32_t NtcBankChannel::GetCapabilities() const noexcept {
+    return HF_TEMP_CAP_NONE;
+}
+
+// =====================================================================
+// Construction & Configuration
+// =====================================================================
+
+NtcThermistorBank::NtcThermistorBank(BaseAdc& adc) noexcept : adc_(adc) {}
+
+hf_temp_err_t NtcThermistorBank::AddChannel(const NtcBankChannelConfig& config, uint8_t* index) noexcept {
+    if (config.lut == nullptr || !config.lut->IsValid()) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+
+    MutexLockGuard lock(mutex_);
+    if (channel_count_ >= kMaxChannels) {
+        return TEMP_ERR_OUT_OF_MEMORY;
+    }
+    // One ADC: every table must share the first channel's resolution and reference.
+    if (channel_count_ > 0 &&
+        !config.lut->MatchesConfig(config.lut->GetSeriesResistanceOhms(), luts_[0]->GetReferenceVoltage(),
+                                   luts_[0]->GetResolutionBits())) {
+        Logger::GetInstance().Error(TAG, "LUT for %.3f V / %u bits differs from the bank's %.3f V / %u bits",
+                                    static_cast<double>(config.lut->GetReferenceVoltage()),
+                                    static_cast<unsigned>(config.lut->GetResolutionBits()),
+                                    static_cast<double>(luts_[0]->GetReferenceVoltage()),
+                                    static_cast<unsigned>(luts_[0]->GetResolutionBits()));
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+
+    const uint8_t slot = channel_count_;
+    adc_channels_[slot] = config.adc_channel;
+    luts_[slot] = config.lut;
+    offset_centi_[slot] = static_cast<int32_t>(
+        config.calibration_offset_celsius * 100.0f + (config.calibration_offset_celsius >= 0.0f ? 0.5f : -0.5f));
+    names_[slot] = config.sensor_name != nullptr ? config.sensor_name : "NTC_Bank_Channel";
+    raw_counts_[slot] = 0;
+    centi_celsius_[slot] = 0;
+    views_[slot].emplace(*this, slot);
+    unchecked_mask_ |= static_cast<uint16_t>(1U << slot);
+    ++channel_count_;
+
+    // The previous scan does not cover the new channel.
+    scan_valid_ = false;
+
+    if (index != nullptr) {
+        *index = slot;
+    }
+    return TEMP_SUCCESS;
+}
+
+uint8_t NtcThermistorBank::GetChannelCount() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return channel_count_;
+}
+
+NtcBankChannel* NtcThermistorBank::GetChannel(uint8_t index) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (index >= channel_count_ || !views_[index].has_value()) {
+        return nullptr;
+    }
+    return &*views_[index];
+}
+
+hf_temp_err_t NtcThermistorBank::SetCalibrationOffset(uint8_t index, float offset_celsius) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (index >= channel_count_) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+    const int32_t new_offset = static_cast<int32_t>(
+        offset_celsius * 100.0f + (offset_celsius >= 0.0f ? 0.5f : -0.5f));
+    centi_celsius_[index] += new_offset - offset_centi_[index];
+    offset_centi_[index] = new_offset;
+    return TEMP_SUCCESS;
+}
+
+void NtcThermistorBank::SetMaxSampleAgeUs(uint32_t max_age_us) noexcept {
+    MutexLockGuard lock(mutex_);
+    max_sample_age_us_ = max_age_us;
+}
+
+// =====================================================================
+// Acquisition
+// =====================================================================
+
+hf_temp_err_t NtcThermistorBank::Scan() noexcept {
+    MutexLockGuard lock(mutex_);
+    return ScanLocked();
+}
+
+hf_temp_err_t NtcThermistorBank::ScanLocked() noexcept {
+    if (channel_count_ == 0) {
+        return TEMP_ERR_NOT_INITIALIZED;
+    }
+
+    const uint64_t start_us = RtosTime::GetCurrentTimeUs();
+
+    const hf_adc_err_t err = adc_.ReadMultipleChannels(adc_channels_.data(), channel_count_,
+                                                       raw_counts_.data(), voltages_.data());
+    if (err != hf_adc_err_t::ADC_SUCCESS) {
+        ++stats_.scan_failures;
+        return TEMP_ERR_READ_FAILED;
+    }
+
+    if (unchecked_mask_ != 0) {
+        CheckAdcScalingLocked();
+    }
+
+    const uint64_t convert_start_us = RtosTime::GetCurrentTimeUs();
+
+    // Integer-only pass over contiguous arrays: table lookup, interpolate, offset.
+    const uint8_t count = channel_count_;
+    for (uint8_t i = 0; i < count; ++i) {
+        centi_celsius_[i] = luts_[i]->CountToCentiCelsius(raw_counts_[i]) + offset_centi_[i];
+    }
+
+    const uint64_t end_us = RtosTime::GetCurrentTimeUs();
+    const auto scan_us = static_cast<uint32_t>(end_us - start_us);
+
+    last_scan_us_ = end_us;
+    scan_valid_ = true;
+    ++stats_.scan_count;
+    stats_.last_scan_us = scan_us;
+    stats_.last_convert_us = static_cast<uint32_t>(end_us - convert_start_us);
+    stats_.total_scan_us += scan_us;
+    if (scan_us > stats_.max_scan_us) {
+        stats_.max_scan_us = scan_us;
+    }
+    return TEMP_SUCCESS;
+}
+
+void NtcThermistorBank::CheckAdcScalingLocked() noexcept {
+    for (uint8_t i = 0; i < channel_count_; ++i) {
+        const auto bit = static_cast<uint16_t>(1U << i);
+        if ((unchecked_mask_ & bit) == 0) {
+            continue;
+        }
+        if (!luts_[i]->MatchesAdcReading(raw_counts_[i], voltages_[i])) {
+            mismatch_mask_ |= bit;
+            Logger::GetInstance().Error(TAG, "%s: ADC read %lu counts at %.3f V, LUT is for %.3f V / %u bits",
+                                        names_[i], static_cast<unsigned long>(raw_counts_[i]),
+                                        static_cast<double>(voltages_[i]),
+                                        static_cast<double>(luts_[i]->GetReferenceVoltage()),
+                                        static_cast<unsigned>(luts_[i]->GetResolutionBits()));
+        }
+    }
+    unchecked_mask_ = 0;
+}
+
+hf_temp_err_t NtcThermistorBank::ReadForView(uint8_t index, float* temperature_celsius) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (index >= channel_count_) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+
+    ++stats_.view_reads;
+    const bool fresh = scan_valid_ && max_sample_age_us_ != 0 &&
+                       (RtosTime::GetCurrentTimeUs() - last_scan_us_) < max_sample_age_us_;
+    if (fresh) {
+        ++stats_.view_cache_hits;
+    } else {
+        hf_temp_err_t err = ScanLocked();
+        if (err != TEMP_SUCCESS) {
+            return err;
+        }
+    }
+
+    if ((mismatch_mask_ & (1U << index)) != 0) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+    *temperature_celsius = static_cast<float>(centi_celsius_[index]) * 0.01f;
+    return TEMP_SUCCESS;
+}
+
+hf_temp_err_t NtcThermistorBank::GetCentiCelsius(uint8_t index, int32_t* centi_celsius) const noexcept {
+    if (centi_celsius == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+    MutexLockGuard lock(mutex_);
+    if (index >= channel_count_) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+    if (!scan_valid_) {
+        return TEMP_ERR_INVALID_READING;
+    }
+    if ((mismatch_mask_ & (1U << index)) != 0) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+    *centi_celsius = centi_celsius_[index];
+    return TEMP_SUCCESS;
+}
+
+hf_temp_err_t NtcThermistorBank::GetRawCount(uint8_t index, uint32_t* raw_count) const noexcept {
+    if (raw_count == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+    MutexLockGuard lock(mutex_);
+    if (index >= channel_count_) {
+        return TEMP_ERR_INVALID_PARAMETER;
+    }
+    if (!scan_valid_) {
+        return TEMP_ERR_INVALID_READING;
+    }
+    *raw_count = raw_counts_[index];
+    return TEMP_SUCCESS;
+}
+
+size_t NtcThermistorBank::CopyCentiCelsius(int32_t* centi_celsius, size_t max_count) const noexcept {
+    if (centi_celsius == nullptr) {
+        return 0;
+    }
+    MutexLockGuard lock(mutex_);
+    if (!scan_valid_) {
+        return 0;
+    }
+    const size_t count = (max_count < channel_count_) ? max_count : channel_count_;
+    for (size_t i = 0; i < count; ++i) {
+        centi_celsius[i] = centi_celsius_[i];
+    }
+    return count;
+}
+
+uint16_t NtcThermistorBank::GetAdcMismatchMask() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return mismatch_mask_;
+}
+
+hf_u64_t NtcThermistorBank::GetLastScanTimeUs() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return scan_valid_ ? last_scan_us_ : 0;
+}
+
+hf_temp_err_t NtcThermistorBank::ScanBatch(void* bank) noexcept {
+    if (bank == nullptr) {
+        return TEMP_ERR_NULL_POINTER;
+    }
+    return static_cast<NtcThermistorBank*>(bank)->Scan();
+}
+
+const char* NtcThermistorBank::GetChannelName(uint8_t index) const noexcept {
+    MutexLockGuard lock(mutex_);
+    return index < channel_count_ ? names_[index] : nullptr;
+}
+
+bool NtcThermistorBank::EnsureAdcInitialized() noexcept {
+    return adc_.EnsureInitialized();
+}
+
+// =====================================================================
+// Statistics
+// =====================================================================
+
+NtcBankStats NtcThermistorBank::GetStats() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return stats_;
+}
+
+void NtcThermistorBank::ResetStats() noexcept {
+    MutexLockGuard lock(mutex_);
+    stats_ = NtcBankStats{};
+}
+
+void NtcThermistorBank::DumpDiagnostics() const noexcept {
+    Logger::GetInstance().Info(TAG, "=== NTC THERMISTOR BANK DIAGNOSTICS ===");
+
+    MutexLockGuard lock(mutex_);
+
+    const uint32_t avg_us = stats_.scan_count
+        ? static_cast<uint32_t>(stats_.total_scan_us / stats_.scan_count)
+        : 0;
+    Logger::GetInstance().Info(TAG, "  Channels: %u/%u  Max Sample Age: %u us",
+                               static_cast<unsigned>(channel_count_),
+                               static_cast<unsigned>(kMaxChannels),
+                               static_cast<unsigned>(max_sample_age_us_));
+    Logger::GetInstance().Info(TAG, "  Scans: %u  Failures: %u  Scan(us) last=%u avg=%u max=%u convert=%u",
+                               static_cast<unsigned>(stats_.scan_count),
+                               static_cast<unsigned>(stats_.scan_failures),
+                               static_cast<unsigned>(stats_.last_scan_us),
+                               static_cast<unsigned>(avg_us),
+                               static_cast<unsigned>(stats_.max_scan_us),
+                               static_cast<unsigned>(stats_.last_convert_us));
+    Logger::GetInstance().Info(TAG, "  View Reads: %u  Served From Cache: %u",
+                               static_cast<unsigned>(stats_.view_reads),
+                               static_cast<unsigned>(stats_.view_cache_hits));
+
+    for (uint8_t i = 0; i < channel_count_; ++i) {
+        Logger::GetInstance().Info(TAG, "  [%u] %s adc_ch=%u raw=%u temp=%.2f°C",
+                                   static_cast<unsigned>(i), names_[i],
+                                   static_cast<unsigned>(adc_channels_[i]),
+                                   static_cast<unsigned>(raw_counts_[i]),
+                                   static_cast<double>(centi_celsius_[i]) * 0.01);
+    }
+
+    Logger::GetInstance().Info(TAG, "=== END NTC THERMISTOR BANK DIAGNOSTICS ===");
+}
@@ -0,0 +1,315 @@
+/**
+ * @file NtcThermistorBank.h
+ * @brief Batch scanner for many NTC thermistors sharing one BaseAdc.
+ *
+ * @details
+ * Boards with 8-16 thermistors would otherwise run one NtcTemperatureHandler
+ * per channel, each issuing its own single-channel ADC read. The bank owns
+ * all channel configurations instead and acquires them with one
+ * BaseAdc::ReadMultipleChannels() call, which lets multi-channel converters
+ * use their batch modes (ADS7952 Auto-1 scan, TMC9660 batched reads).
+ * Raw counts are then converted in a single branch-light pass over
+ * structure-of-arrays storage using each channel's NtcFixedPointLut.
+ *
+ * Consumers that expect a BaseTemperature get a per-channel view:
+ *
+ * @code
+ * static constexpr NtcFixedPointLut kLut{
+ *     MakeNtcLutParams(NtcType::NtcG163Jft103Ft1S, 10000.0f, 3.3f, 12)};
+ *
+ * NtcThermistorBank bank(adc);
+ * for (uint8_t ch = 0; ch < 12; ++ch) {
+ *     bank.AddChannel({ch, &kLut, 0.0f, "ntc"});
+ * }
+ * bank.SetMaxSampleAgeUs(10000);     // views share scans younger than 10 ms
+ *
+ * bank.Scan();                        // one ADC transaction, 12 conversions
+ * int32_t centi = 0;
+ * bank.GetCentiCelsius(3, &centi);
+ *
+ * BaseTemperature* sensor = bank.GetChannel(3);   // existing consumers
+ * @endcode
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#pragma once
+
+#include "core/hf-core-drivers/internal/hf-internal-interface-wrap/inc/base/BaseTemperature.h"
+#include "core/hf-core-drivers/internal/hf-internal-interface-wrap/inc/base/BaseAdc.h"
+#include "NtcFixedPointLut.h"
+#include "RtosMutex.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+class NtcThermistorBank;
+
+/**
+ * @brief Configuration of one thermistor in an NtcThermistorBank.
+ */
+struct NtcBankChannelConfig {
+    hf_channel_id_t adc_channel;        ///< ADC channel the divider is wired to
+    const NtcFixedPointLut* lut;        ///< Conversion table (must outlive the bank)
+    float calibration_offset_celsius;   ///< Offset added to every reading (°C)
+    const char* sensor_name;            ///< Sensor name/identifier (may be nullptr)
+};
+
+/**
+ * @brief Scan timing and error counters for an NtcThermistorBank.
+ */
+struct NtcBankStats {
+    uint32_t scan_count = 0;        ///< Successful scans
+    uint32_t scan_failures = 0;     ///< ReadMultipleChannels() failures
+    uint32_t view_reads = 0;        ///< Reads through per-channel views
+    uint32_t view_cache_hits = 0;   ///< View reads served from a fresh scan
+    uint32_t last_scan_us = 0;      ///< Duration of the last scan (acquire + convert)
+    uint32_t max_scan_us = 0;       ///< Worst scan duration
+    uint32_t last_convert_us = 0;   ///< Duration of the last conversion pass
+    uint64_t total_scan_us = 0;     ///< Sum of scan durations (for averaging)
+};
+
+//--------------------------------------
+//  NtcBankChannel (BaseTemperature view)
+//--------------------------------------
+
+/**
+ * @class NtcBankChannel
+ * @brief BaseTemperature view of one channel of an NtcThermistorBank.
+ *
+ * Reads return the channel's value from the bank's latest scan when it is
+ * younger than the bank's maximum sample age; otherwise they trigger a new
+ * scan of the whole bank.
+ */
+class NtcBankChannel : public BaseTemperature {
+public:
+    /**
+     * @brief Construct a view (created by NtcThermistorBank::AddChannel()).
+     * @param bank Owning bank
+     * @param index Channel index within the bank
+     */
+    NtcBankChannel(NtcThermistorBank& bank, uint8_t index) noexcept;
+
+    NtcBankChannel(const NtcBankChannel&) = delete;
+    NtcBankChannel& operator=(const NtcBankChannel&) = delete;
+
+    ~NtcBankChannel() noexcept override = default;
+
+    /** @brief Channel index within the owning bank. */
+    [[nodiscard]] uint8_t GetIndex() const noexcept { return index_; }
+
+    /** @brief Sensor name from the channel configuration. */
+    [[nodiscard]] const char* GetSensorName() const noexcept;
+
+protected:
+    bool Initialize() noexcept override;
+    bool Deinitialize() noexcept override;
+    hf_temp_err_t ReadTemperatureCelsiusImpl(float* temperature_celsius) noexcept override;
+    hf_temp_err_t GetSensorInfo(hf_temp_sensor_info_t* info) const noexcept override;
+    [[nodiscard]] hf_u32_t GetCapabilities() const noexcept override;
+
+private:
+    NtcThermistorBank& bank_;
+    uint8_t index_;
+};
+
+//--------------------------------------
+//  NtcThermistorBank
+//--------------------------------------
+
+/**
+ * @class NtcThermistorBank
+ * @brief Owns up to kMaxChannels thermistor channels read through one BaseAdc.
+ *
+ * @note Thread-safe. The BaseAdc and every LUT must outlive the bank.
+ */
+class NtcThermistorBank {
+public:
+    /** @brief Maximum thermistors per bank. */
+    static constexpr uint8_t kMaxChannels = 16;
+
+    /**
+     * @brief Default view cache window (µs): one tick of a default (5 ms)
+     *        TemperatureSamplingScheduler, so a scheduler group reads its
+     *        views from the ScanBatch() scan instead of rescanning per view.
+     */
+    static constexpr uint32_t kDefaultMaxSampleAgeUs = 5000;
+
+    /**
+     * @brief Construct an empty bank.
+     * @param adc ADC all channels are read from (must outlive the bank).
+     */
+    explicit NtcThermistorBank(BaseAdc& adc) noexcept;
+
+    ~NtcThermistorBank() noexcept = default;
+
+    /// Non-copyable.
+    NtcThermistorBank(const NtcThermistorBank&) = delete;
+    /// Non-copyable.
+    NtcThermistorBank& operator=(const NtcThermistorBank&) = delete;
+    /// Non-movable (views hold a reference to the bank).
+    NtcThermistorBank(NtcThermistorBank&&) = delete;
+    /// Non-movable.
+    NtcThermistorBank& operator=(NtcThermistorBank&&) = delete;
+
+    /// @name Configuration
+    /// @{
+
+    /**
+     * @brief Add a thermistor channel.
+     *
+     * All channels share one ADC, so every LUT must be built for the same
+     * resolution and reference voltage (within 1%) as the first channel's.
+     * The first scan after adding a channel also checks its count and voltage
+     * against the LUT (NtcFixedPointLut::MatchesAdcReading()); a channel that
+     * fails is logged and its reads return TEMP_ERR_INVALID_PARAMETER.
+     *
+     * @param config Channel configuration.
+     * @param index Optional pointer to receive the channel index.
+     * @return TEMP_SUCCESS, TEMP_ERR_INVALID_PARAMETER for a missing, invalid
+     *         or mismatched LUT, or TEMP_ERR_OUT_OF_MEMORY if kMaxChannels are in use.
+     */
+    hf_temp_err_t AddChannel(const NtcBankChannelConfig& config, uint8_t* index = nullptr) noexcept;
+
+    /** @brief Number of configured channels. */
+    [[nodiscard]] uint8_t GetChannelCount() const noexcept;
+
+    /**
+     * @brief Get the BaseTemperature view of a channel.
+     * @param index Channel index.
+     * @return View pointer (owned by the bank), or nullptr if out of range.
+     */
+    NtcBankChannel* GetChannel(uint8_t index) noexcept;
+
+    /**
+     * @brief Set the calibration offset of one channel.
+     * @param index Channel index.
+     * @param offset_celsius Offset (°C).
+     * @return TEMP_SUCCESS or TEMP_ERR_INVALID_PARAMETER.
+     */
+    hf_temp_err_t SetCalibrationOffset(uint8_t index, float offset_celsius) noexcept;
+
+    /**
+     * @brief Let view reads reuse a scan younger than this age.
+     * @param max_age_us Maximum sample age (µs, default kDefaultMaxSampleAgeUs);
+     *        0 makes every view read scan.
+     */
+    void SetMaxSampleAgeUs(uint32_t max_age_us) noexcept;
+
+    /// @}
+
+    /// @name Acquisition
+    /// @{
+
+    /**
+     * @brief Acquire every channel with one ReadMultipleChannels() call and convert.
+     * @return TEMP_SUCCESS, TEMP_ERR_NOT_INITIALIZED if no channels are
+     *         configured, or TEMP_ERR_READ_FAILED on ADC failure.
+     */
+    hf_temp_err_t Scan() noexcept;
+
+    /**
+     * @brief Get one channel's temperature from the latest scan.
+     * @param index Channel index.
+     * @param centi_celsius Pointer to store temperature (0.01 °C).
+     * @return TEMP_SUCCESS, TEMP_ERR_INVALID_PARAMETER (bad index, or the
+     *         ADC does not match the channel's LUT), or
+     *         TEMP_ERR_INVALID_READING if no scan has completed.
+     */
+    hf_temp_err_t GetCentiCelsius(uint8_t index, int32_t* centi_celsius) const noexcept;
+
+    /**
+     * @brief Get one channel's raw ADC count from the latest scan.
+     * @param index Channel index.
+     * @param raw_count Pointer to store the count.
+     * @return Same as GetCentiCelsius().
+     */
+    hf_temp_err_t GetRawCount(uint8_t index, uint32_t* raw_count) const noexcept;
+
+    /**
+     * @brief Copy all temperatures from the latest scan.
+     * @param centi_celsius Output array (0.01 °C).
+     * @param max_count Capacity of the output array.
+     * @return Number of channels copied (0 if no scan has completed).
+     */
+    size_t CopyCentiCelsius(int32_t* centi_celsius, size_t max_count) const noexcept;
+
+    /** @brief Channels whose ADC readings did not match their LUT (bit per index). */
+    [[nodiscard]] uint16_t GetAdcMismatchMask() const noexcept;
+
+    /** @brief Timestamp of the latest successful scan (µs, 0 if none). */
+    [[nodiscard]] hf_u64_t GetLastScanTimeUs() const noexcept;
+
+    /**
+     * @brief Batch hook for TemperatureSamplingScheduler (hf_temp_batch_acquire_t).
+     *
+     * Register every channel view with the same bank as batch context: the
+     * scheduler scans once per wakeup and the view reads are served from that
+     * scan, provided the sample age window (kDefaultMaxSampleAgeUs unless
+     * changed with SetMaxSampleAgeUs()) covers the time the group takes.
+     *
+     * @param bank NtcThermistorBank* to scan.
+     * @return Result of Scan(), or TEMP_ERR_NULL_POINTER.
+     */
+    static hf_temp_err_t ScanBatch(void* bank) noexcept;
+
+    /// @}
+
+    /// @name Statistics
+    /// @{
+
+    /** @brief Get a copy of the scan statistics. */
+    [[nodiscard]] NtcBankStats GetStats() const noexcept;
+
+    /** @brief Reset scan statistics. */
+    void ResetStats() noexcept;
+
+    /** @brief Log channel configuration, latest values and statistics at INFO level. */
+    void DumpDiagnostics() const noexcept;
+
+    /// @}
+
+private:
+    friend class NtcBankChannel;
+
+    /** @brief Scan implementation (caller holds mutex_). */
+    hf_temp_err_t ScanLocked() noexcept;
+
+    /** @brief Check newly added channels' count / voltage pairs against their LUTs (caller holds mutex_). */
+    void CheckAdcScalingLocked() noexcept;
+
+    /** @brief View read: reuse a fresh scan or scan again. */
+    hf_temp_err_t ReadForView(uint8_t index, float* temperature_celsius) noexcept;
+
+    /** @brief Sensor name of a channel (for views). */
+    const char* GetChannelName(uint8_t index) const noexcept;
+
+    /** @brief Ensure the ADC is initialized (for views). */
+    bool EnsureAdcInitialized() noexcept;
+
+    BaseAdc& adc_;                                                    ///< Shared ADC (not owned)
+
+    // Structure-of-arrays channel state: the conversion pass walks these linearly.
+    std::array<hf_channel_id_t, kMaxChannels> adc_channels_{};       ///< ADC channel per slot
+    std::array<const NtcFixedPointLut*, kMaxChannels> luts_{};       ///< Conversion table per slot
+    std::array<int32_t, kMaxChannels> offset_centi_{};               ///< Calibration offset (0.01 °C)
+    std::array<const char*, kMaxChannels> names_{};                  ///< Sensor names
+    std::array<hf_u32_t, kMaxChannels> raw_counts_{};                ///< Latest raw counts
+    std::array<float, kMaxChannels> voltages_{};                     ///< Latest voltages (from ADC)
+    std::array<int32_t, kMaxChannels> centi_celsius_{};              ///< Latest temperatures
+
+    std::array<std::optional<NtcBankChannel>, kMaxChannels> views_{}; ///< Inline BaseTemperature views
+
+    uint8_t channel_count_ = 0;      ///< Configured channels
+    uint16_t unchecked_mask_ = 0;    ///< Channels not yet checked against the ADC
+    uint16_t mismatch_mask_ = 0;     ///< Channels whose ADC scaling disagrees with the LUT
+    bool scan_valid_ = false;        ///< At least one scan completed
+    uint32_t max_sample_age_us_ = kDefaultMaxSampleAgeUs; ///< View cache window
+    hf_u64_t last_scan_us_ = 0;      ///< Timestamp of the latest scan
+    NtcBankStats stats_{};           ///< Scan statistics
+    mutable RtosMutex mutex_;        ///< Protects all state
+};
@@ -42,8 +42,8 @@ bool HalI2cPca9685Comm::Write(uint8_t addr, uint8_t reg,
     }
 
     // Frame the I2C register write: [register, data...]
-    // PCA9685 register writes are at most 4 data bytes; 8-byte buffer is sufficient.
-    constexpr size_t kMaxBuf = 8;
+    // Largest write is a 16-channel LEDn_ON/OFF burst (64 data bytes).
+    constexpr size_t kMaxBuf = 1 + 16 * 4;
     if (len + 1 > kMaxBuf) {
         return false;
     }
@@ -78,9 +78,7 @@ Pca9685Handler::Pca9685Handler(BaseI2c& i2c_device) noexcept
       i2c_adapter_(nullptr),
       pca9685_driver_(nullptr),
       initialized_(false),
-      pwm_adapter_(nullptr) {
-    gpio_registry_.fill(nullptr);
-}
+      pwm_adapter_(nullptr) {}
 
 bool Pca9685Handler::EnsureInitialized() noexcept {
     MutexLockGuard lock(handler_mutex_);
@@ -131,6 +129,8 @@ hf_pwm_err_t Pca9685Handler::initializeInternal() noexcept {
         return hf_pwm_err_t::PWM_ERR_DEVICE_NOT_RESPONDING;
     }
 
+    // The reset leaves channel registers in an unknown-to-us state.
+    shadow_valid_mask_ = 0;
     initialized_ = true;
     return hf_pwm_err_t::PWM_SUCCESS;
 }
@@ -140,8 +140,9 @@ hf_pwm_err_t Pca9685Handler::deinitializeInternal() noexcept {
         return hf_pwm_err_t::PWM_SUCCESS;
     }
 
-    // Clear GPIO registry.
-    gpio_registry_.fill(nullptr);
+    // Release GPIO pin wrappers. Owning handles held elsewhere keep their
+    // wrapper alive; pooled ones dangle.
+    gpio_registry_.Clear();
 
     // Clear PWM adapter.
     pwm_adapter_.reset();
@@ -149,6 +150,8 @@ hf_pwm_err_t Pca9685Handler::deinitializeInternal() noexcept {
     // Release driver and adapter.
     pca9685_driver_.reset();
     i2c_adapter_.reset();
+    auto_increment_enabled_ = false;
+    shadow_valid_mask_ = 0;
     initialized_ = false;
     return hf_pwm_err_t::PWM_SUCCESS;
 }
@@ -160,6 +163,7 @@ hf_pwm_err_t Pca9685Handler::deinitializeInternal() noexcept {
 bool Pca9685Handler::SetFrequency(float freq_hz) noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
+    auto_increment_enabled_ = false;  // the driver rewrites MODE1
     return pca9685_driver_->SetPwmFreq(freq_hz);
 }
 
@@ -167,7 +171,13 @@ bool Pca9685Handler::SetDuty(uint8_t channel, float duty) noexcept {
     if (!validateChannel(channel)) return false;
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
-    return pca9685_driver_->SetDuty(channel, duty);
+
+    // Zero-phase duty expressed as register words so the write goes through
+    // the shadow.
+    uint16_t on_word = 0;
+    uint16_t off_word = 0;
+    dutyToWords(duty, 0, on_word, off_word);
+    return writeChannelLocked(channel, on_word, off_word);
 }
 
 bool Pca9685Handler::SetPwm(uint8_t channel, uint16_t on_time,
@@ -175,27 +185,199 @@ bool Pca9685Handler::SetPwm(uint8_t channel, uint16_t on_time,
     if (!validateChannel(channel)) return false;
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
-    return pca9685_driver_->SetPwm(channel, on_time, off_time);
+    return writeChannelLocked(channel, on_time, off_time);
 }
 
 bool Pca9685Handler::SetAllPwm(uint16_t on_time, uint16_t off_time) noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
-    return pca9685_driver_->SetAllPwm(on_time, off_time);
+    const bool ok = pca9685_driver_->SetAllPwm(on_time, off_time);
+    for (uint8_t ch = 0; ch < 16; ++ch) {
+        recordWriteLocked(ch, on_time, off_time, ok);
+    }
+    return ok;
 }
 
 bool Pca9685Handler::SetChannelFullOn(uint8_t channel) noexcept {
     if (!validateChannel(channel)) return false;
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
-    return pca9685_driver_->SetChannelFullOn(channel);
+    return writeChannelLocked(channel, kLedFullBit, 0);
 }
 
 bool Pca9685Handler::SetChannelFullOff(uint8_t channel) noexcept {
     if (!validateChannel(channel)) return false;
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
-    return pca9685_driver_->SetChannelFullOff(channel);
+    return writeChannelLocked(channel, 0, kLedFullBit);
+}
+
+bool Pca9685Handler::WriteChannel(uint8_t channel, uint16_t on_word,
+                                  uint16_t off_word) noexcept {
+    if (!validateChannel(channel)) return false;
+    MutexLockGuard lock(handler_mutex_);
+    if (!ensureInitializedLocked()) return false;
+    return writeChannelLocked(channel, on_word, off_word);
+}
+
+bool Pca9685Handler::WriteChannels(uint16_t channel_mask, const uint16_t* on_words,
+                                   const uint16_t* off_words) noexcept {
+    if (!on_words || !off_words) return false;
+    MutexLockGuard lock(handler_mutex_);
+    if (!ensureInitializedLocked()) return false;
+
+    // Drop channels the chip already holds.
+    uint16_t changed = 0;
+    for (uint8_t ch = 0; ch < 16; ++ch) {
+        const auto bit = static_cast<uint16_t>(1U << ch);
+        if ((channel_mask & bit) != 0 && !isUnchangedLocked(ch, on_words[ch], off_words[ch])) {
+            changed = static_cast<uint16_t>(changed | bit);
+        }
+    }
+    if (changed == 0) {
+        for (uint8_t ch = 0; ch < 16; ++ch) {
+            if ((channel_mask & (1U << ch)) != 0) ++write_stats_.suppressed_writes;
+        }
+        return true;
+    }
+    if (!ensureAutoIncrementLocked()) return false;
+
+    // Burst runs of changed channels. A gap channel rides along with the value
+    // the chip already holds (the shadow, or the caller's word if it is in the
+    // mask); a gap whose value is unknown splits the run so it is never written.
+    const auto known = static_cast<uint16_t>(changed | channel_mask | shadow_valid_mask_);
+    uint16_t on[16];
+    uint16_t off[16];
+    for (uint8_t ch = 0; ch < 16; ++ch) {
+        const bool keep = (channel_mask & (1U << ch)) == 0 && (shadow_valid_mask_ & (1U << ch)) != 0;
+        on[ch] = keep ? shadow_on_[ch] : on_words[ch];
+        off[ch] = keep ? shadow_off_[ch] : off_words[ch];
+    }
+    uint16_t sent = 0;
+    uint8_t ch = 0;
+    while (ch < 16) {
+        if ((changed & (1U << ch)) == 0) {
+            ++ch;
+            continue;
+        }
+        const uint8_t first = ch;
+        uint8_t last = ch;
+        for (uint8_t next = static_cast<uint8_t>(ch + 1); next < 16 && (known & (1U << next)) != 0; ++next) {
+            if ((changed & (1U << next)) != 0) last = next;
+        }
+        for (uint8_t i = first; i <= last; ++i) {
+            sent = static_cast<uint16_t>(sent | (1U << i));
+            if ((changed & (1U << i)) == 0) ++write_stats_.filler_writes;
+        }
+        if (!writeBurstLocked(first, &on[first], &off[first], static_cast<uint8_t>(last - first + 1))) {
+            return false;
+        }
+        ch = static_cast<uint8_t>(last + 1);
+    }
+    for (uint8_t i = 0; i < 16; ++i) {
+        if ((channel_mask & ~sent & (1U << i)) != 0) ++write_stats_.suppressed_writes;
+    }
+    return true;
+}
+
+bool Pca9685Handler::writeChannelLocked(uint8_t channel, uint16_t on_word,
+                                        uint16_t off_word) noexcept {
+    if (isUnchangedLocked(channel, on_word, off_word)) {
+        ++write_stats_.suppressed_writes;
+        return true;
+    }
+
+    bool ok = false;
+    if (off_word & kLedFullBit) {
+        ok = pca9685_driver_->SetChannelFullOff(channel);
+    } else if (on_word & kLedFullBit) {
+        ok = pca9685_driver_->SetChannelFullOn(channel);
+    } else {
+        ok = pca9685_driver_->SetPwm(channel, on_word, off_word);
+    }
+    recordWriteLocked(channel, on_word, off_word, ok);
+    return ok;
+}
+
+bool Pca9685Handler::writeBurstLocked(uint8_t first_channel, const uint16_t* on_words,
+                                      const uint16_t* off_words, uint8_t count) noexcept {
+    // LEDn_ON_L, LEDn_ON_H, LEDn_OFF_L, LEDn_OFF_H per channel; bit 4 of the
+    // high bytes is the full-on / full-off flag (bit 12 of the word).
+    uint8_t frame[16 * kRegsPerChannel];
+    for (uint8_t i = 0; i < count; ++i) {
+        uint8_t* regs = &frame[i * kRegsPerChannel];
+        regs[0] = static_cast<uint8_t>(on_words[i] & 0xFF);
+        regs[1] = static_cast<uint8_t>((on_words[i] >> 8) & 0x1F);
+        regs[2] = static_cast<uint8_t>(off_words[i] & 0xFF);
+        regs[3] = static_cast<uint8_t>((off_words[i] >> 8) & 0x1F);
+    }
+
+    const auto reg = static_cast<uint8_t>(kRegLed0OnL + first_channel * kRegsPerChannel);
+    const bool ok = i2c_adapter_->Write(GetI2cAddress(), reg, frame,
+                                        static_cast<size_t>(count) * kRegsPerChannel);
+
+    for (uint8_t i = 0; i < count; ++i) {
+        recordWriteLocked(static_cast<uint8_t>(first_channel + i), on_words[i], off_words[i], ok);
+    }
+    if (ok && count > 1) {
+        ++write_stats_.burst_count;
+        write_stats_.merged_writes += static_cast<uint32_t>(count - 1);
+    }
+    return ok;
+}
+
+void Pca9685Handler::dutyToWords(float duty, uint16_t on_tick, uint16_t& on_word,
+                                 uint16_t& off_word) noexcept {
+    constexpr uint16_t kMaxTick = Pca9685PwmAdapter::kMaxRawValue;
+    if (duty >= 1.0f) {
+        on_word = kLedFullBit;
+        off_word = 0;
+    } else if (duty <= 0.0f) {
+        on_word = 0;
+        off_word = kLedFullBit;
+    } else {
+        on_word = static_cast<uint16_t>(on_tick & kMaxTick);
+        const auto off_tick = static_cast<uint16_t>(lroundf(duty * static_cast<float>(kMaxTick)));
+        off_word = static_cast<uint16_t>((on_word + off_tick) & kMaxTick);
+    }
+}
+
+bool Pca9685Handler::isUnchangedLocked(uint8_t channel, uint16_t on_word,
+                                       uint16_t off_word) const noexcept {
+    return write_suppression_enabled_ &&
+           (shadow_valid_mask_ & (1U << channel)) != 0 &&
+           shadow_on_[channel] == on_word &&
+           shadow_off_[channel] == off_word;
+}
+
+void Pca9685Handler::recordWriteLocked(uint8_t channel, uint16_t on_word,
+                                       uint16_t off_word, bool ok) noexcept {
+    const auto bit = static_cast<uint16_t>(1U << channel);
+    if (ok) {
+        shadow_on_[channel] = on_word;
+        shadow_off_[channel] = off_word;
+        shadow_valid_mask_ = static_cast<uint16_t>(shadow_valid_mask_ | bit);
+        ++write_stats_.channel_writes;
+    } else {
+        // A failed write may have partially landed -- the chip state is unknown.
+        shadow_valid_mask_ = static_cast<uint16_t>(shadow_valid_mask_ & ~bit);
+    }
+}
+
+bool Pca9685Handler::ensureAutoIncrementLocked() noexcept {
+    if (auto_increment_enabled_) return true;
+
+    const uint8_t addr = GetI2cAddress();
+    uint8_t mode1 = 0;
+    if (!i2c_adapter_->Read(addr, kRegMode1, &mode1, 1)) return false;
+
+    if ((mode1 & kMode1AutoIncrement) == 0) {
+        // Never write back RESTART: a 1 there would restart the PWM cycle.
+        auto value = static_cast<uint8_t>((mode1 & ~kMode1Restart) | kMode1AutoIncrement);
+        if (!i2c_adapter_->Write(addr, kRegMode1, &value, 1)) return false;
+    }
+    auto_increment_enabled_ = true;
+    return true;
 }
 
 // =====================================================================
@@ -205,12 +387,14 @@ bool Pca9685Handler::SetChannelFullOff(uint8_t channel) noexcept {
 bool Pca9685Handler::Sleep() noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
+    auto_increment_enabled_ = false;  // the driver rewrites MODE1
     return pca9685_driver_->Sleep();
 }
 
 bool Pca9685Handler::Wake() noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return false;
+    auto_increment_enabled_ = false;  // the driver rewrites MODE1
     return pca9685_driver_->Wake();
 }
 
@@ -253,7 +437,7 @@ std::shared_ptr<BasePwm> Pca9685Handler::GetPwmAdapter() noexcept {
     return pwm_adapter_;
 }
 
-std::shared_ptr<BaseGpio> Pca9685Handler::CreateGpioPin(
+Pca9685GpioPin* Pca9685Handler::CreateGpioPinRef(
     hf_pin_num_t channel,
     hf_gpio_active_state_t active_state,
     bool allow_existing) noexcept {
@@ -263,36 +447,85 @@ std::shared_ptr<BaseGpio> Pca9685Handler::CreateGpioPin(
     if (!ensureInitializedLocked()) return nullptr;
 
     // Check if pin already exists.
-    if (gpio_registry_[channel] != nullptr) {
-        return allow_existing
-                   ? std::static_pointer_cast<BaseGpio>(gpio_registry_[channel])
-                   : nullptr;
+    if (Pca9685GpioPin* existing = gpio_registry_.Get(channel)) {
+        return allow_existing ? existing : nullptr;
     }
 
-    auto new_pin = std::make_shared<Pca9685GpioPin>(channel, this, active_state);
+    Pca9685GpioPin* new_pin = gpio_registry_.Emplace(channel, channel, this, active_state);
     if (new_pin && new_pin->Initialize()) {
-        gpio_registry_[channel] = new_pin;
         return new_pin;
     }
+    gpio_registry_.Reset(channel);
     return nullptr;
 }
 
+Pca9685GpioPin* Pca9685Handler::GetGpioPinRef(hf_pin_num_t channel) noexcept {
+    if (channel < 0 || channel >= 16) return nullptr;
+    MutexLockGuard lock(handler_mutex_);
+    return gpio_registry_.Get(channel);
+}
+
+std::shared_ptr<BaseGpio> Pca9685Handler::CreateGpioPin(
+    hf_pin_num_t channel,
+    hf_gpio_active_state_t active_state,
+    bool allow_existing) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (CreateGpioPinRef(channel, active_state, allow_existing) == nullptr) {
+        return nullptr;
+    }
+    return gpio_registry_.Share(channel);
+}
+
 std::shared_ptr<BaseGpio> Pca9685Handler::GetGpioPin(hf_pin_num_t channel) noexcept {
     if (channel < 0 || channel >= 16) return nullptr;
     MutexLockGuard lock(handler_mutex_);
-    return gpio_registry_[channel];
+    return gpio_registry_.Share(channel);
+}
+
+uint32_t Pca9685Handler::GetPinHeapAllocations() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return gpio_registry_.GetHeapAllocations();
 }
 
 bool Pca9685Handler::IsPinCreated(hf_pin_num_t channel) const noexcept {
     if (channel < 0 || channel >= 16) return false;
     MutexLockGuard lock(handler_mutex_);
-    return gpio_registry_[channel] != nullptr;
+    return gpio_registry_.Has(channel);
 }
 
 // =====================================================================
 // Pca9685Handler -- Error Management
 // =====================================================================
 
+// =====================================================================
+// Pca9685Handler -- Write Suppression
+// =====================================================================
+
+void Pca9685Handler::SetWriteSuppression(bool enable) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    write_suppression_enabled_ = enable;
+}
+
+bool Pca9685Handler::IsWriteSuppressionEnabled() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return write_suppression_enabled_;
+}
+
+void Pca9685Handler::InvalidateWriteCache() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    shadow_valid_mask_ = 0;
+}
+
+Pca9685WriteStats Pca9685Handler::GetWriteStats() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return write_stats_;
+}
+
+void Pca9685Handler::ResetWriteStats() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    write_stats_ = Pca9685WriteStats{};
+}
+
 uint16_t Pca9685Handler::GetErrorFlags() const noexcept {
     return pca9685_driver_ ? pca9685_driver_->GetErrorFlags() : 0;
 }
@@ -317,6 +550,17 @@ void Pca9685Handler::DumpDiagnostics() const noexcept {
     Logger::GetInstance().Info(TAG, "System Health:");
     Logger::GetInstance().Info(TAG, "  Initialized: %s",
                               initialized_ ? "YES" : "NO");
+    Logger::GetInstance().Info(TAG, "  Auto-Increment: %s",
+                              auto_increment_enabled_ ? "CONFIRMED" : "UNCHECKED");
+
+    Logger::GetInstance().Info(TAG, "Channel Writes:");
+    Logger::GetInstance().Info(TAG, "  Suppression: %s (shadow valid 0x%04X)",
+                              write_suppression_enabled_ ? "ON" : "OFF", shadow_valid_mask_);
+    Logger::GetInstance().Info(TAG, "  Written: %lu  Suppressed: %lu  Merged: %lu  Bursts: %lu",
+                              static_cast<unsigned long>(write_stats_.channel_writes),
+                              static_cast<unsigned long>(write_stats_.suppressed_writes),
+                              static_cast<unsigned long>(write_stats_.merged_writes),
+                              static_cast<unsigned long>(write_stats_.burst_count));
 
     Logger::GetInstance().Info(TAG, "I2C Interface:");
     if (i2c_adapter_) {
@@ -347,17 +591,18 @@ void Pca9685Handler::DumpDiagnostics() const noexcept {
         Logger::GetInstance().Info(TAG, "  Enabled Channels: %d/16", enabled);
         Logger::GetInstance().Info(TAG, "  Frequency: %lu Hz",
                                   static_cast<unsigned long>(pwm_adapter_->current_frequency_hz_));
+        Logger::GetInstance().Info(TAG, "  Update Mode: %s (pending mask 0x%04X)",
+                                  pwm_adapter_->IsDeferredUpdates() ? "DEFERRED" : "IMMEDIATE",
+                                  pwm_adapter_->GetPendingChannelMask());
     } else {
         Logger::GetInstance().Info(TAG, "  Status: NOT_CREATED");
     }
 
     // GPIO Pin Registry
-    int gpio_count = 0;
-    for (int i = 0; i < 16; ++i) {
-        if (gpio_registry_[i] != nullptr) ++gpio_count;
-    }
+    const int gpio_count = static_cast<int>(gpio_registry_.Count());
     Logger::GetInstance().Info(TAG, "GPIO Registry:");
-    Logger::GetInstance().Info(TAG, "  Active GPIO Pins: %d/16", gpio_count);
+    Logger::GetInstance().Info(TAG, "  Active GPIO Pins: %d/16 (%s)", gpio_count,
+                              IsPinPoolEnabled() ? "inline pool" : "heap-owned");
 
     bool healthy = initialized_ && pca9685_driver_ && i2c_adapter_;
     Logger::GetInstance().Info(TAG, "System Status: %s",
@@ -369,6 +614,9 @@ void Pca9685Handler::DumpDiagnostics() const noexcept {
 Pca9685Handler::Pca9685Driver* Pca9685Handler::GetDriver() noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!ensureInitializedLocked()) return nullptr;
+    // Direct register access bypasses the shadow and may change MODE1.AI.
+    shadow_valid_mask_ = 0;
+    auto_increment_enabled_ = false;
     return pca9685_driver_.get();
 }
 
@@ -386,6 +634,8 @@ Pca9685PwmAdapter::Pca9685PwmAdapter(Pca9685Handler* parent_handler) noexcept
     duty_cache_.fill(0.0f);
     on_time_cache_.fill(0);
     channel_enabled_.fill(false);
+    staged_on_.fill(0);
+    staged_off_.fill(Pca9685Handler::kLedFullBit);
 }
 
 hf_pwm_err_t Pca9685PwmAdapter::Initialize() noexcept {
@@ -404,6 +654,11 @@ hf_pwm_err_t Pca9685PwmAdapter::Deinitialize() noexcept {
     channel_enabled_.fill(false);
     duty_cache_.fill(0.0f);
     on_time_cache_.fill(0);
+    MutexLockGuard lock(staging_mutex_);
+    staged_on_.fill(0);
+    staged_off_.fill(Pca9685Handler::kLedFullBit);
+    dirty_mask_ = 0;
+    deferred_updates_ = false;
     return hf_pwm_err_t::PWM_SUCCESS;
 }
 
@@ -411,18 +666,12 @@ hf_pwm_err_t Pca9685PwmAdapter::EnableChannel(hf_channel_id_t channel_id) noexce
     if (!validateChannel(channel_id)) return hf_pwm_err_t::PWM_ERR_INVALID_CHANNEL;
     if (!parent_handler_) return hf_pwm_err_t::PWM_ERR_NULL_POINTER;
 
-    // Restore the cached duty cycle when enabling.
-    float duty = duty_cache_[channel_id];
-    if (duty > 0.0f) {
-        if (!parent_handler_->SetDuty(static_cast<uint8_t>(channel_id), duty)) {
-            return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-        }
-    } else {
-        // Duty is 0 -- set full-off to be explicit.
-        if (!parent_handler_->SetChannelFullOff(static_cast<uint8_t>(channel_id))) {
-            return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-        }
-    }
+    // Restore the cached duty cycle when enabling (duty 0 -> explicit full-off).
+    uint16_t on_word = 0;
+    uint16_t off_word = 0;
+    dutyToWords(channel_id, duty_cache_[channel_id], on_word, off_word);
+    auto result = writeChannel(channel_id, on_word, off_word);
+    if (result != hf_pwm_err_t::PWM_SUCCESS) return result;
 
     channel_enabled_[channel_id] = true;
     return hf_pwm_err_t::PWM_SUCCESS;
@@ -433,9 +682,8 @@ hf_pwm_err_t Pca9685PwmAdapter::DisableChannel(hf_channel_id_t channel_id) noexc
     if (!parent_handler_) return hf_pwm_err_t::PWM_ERR_NULL_POINTER;
 
     // Set channel to full-off (disable output).
-    if (!parent_handler_->SetChannelFullOff(static_cast<uint8_t>(channel_id))) {
-        return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-    }
+    auto result = writeChannel(channel_id, 0, Pca9685Handler::kLedFullBit);
+    if (result != hf_pwm_err_t::PWM_SUCCESS) return result;
 
     channel_enabled_[channel_id] = false;
     return hf_pwm_err_t::PWM_SUCCESS;
@@ -453,24 +701,11 @@ hf_pwm_err_t Pca9685PwmAdapter::SetDutyCycle(hf_channel_id_t channel_id,
 
     duty_cycle = ClampDutyCycle(duty_cycle);
 
-    // Handle edge cases: full-on and full-off.
-    if (duty_cycle >= 1.0f) {
-        if (!parent_handler_->SetChannelFullOn(static_cast<uint8_t>(channel_id))) {
-            return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-        }
-    } else if (duty_cycle <= 0.0f) {
-        if (!parent_handler_->SetChannelFullOff(static_cast<uint8_t>(channel_id))) {
-            return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-        }
-    } else {
-        // Use on-time offset for phase shift, off-time for duty.
-        uint16_t on_time = on_time_cache_[channel_id];
-        auto off_tick = static_cast<uint16_t>(lroundf(duty_cycle * kMaxRawValue));
-        uint16_t off_time = (on_time + off_tick) & kMaxRawValue;
-        if (!parent_handler_->SetPwm(static_cast<uint8_t>(channel_id), on_time, off_time)) {
-            return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-        }
-    }
+    uint16_t on_word = 0;
+    uint16_t off_word = 0;
+    dutyToWords(channel_id, duty_cycle, on_word, off_word);
+    auto result = writeChannel(channel_id, on_word, off_word);
+    if (result != hf_pwm_err_t::PWM_SUCCESS) return result;
 
     duty_cache_[channel_id] = duty_cycle;
     channel_enabled_[channel_id] = true;
@@ -486,9 +721,8 @@ hf_pwm_err_t Pca9685PwmAdapter::SetDutyCycleRaw(hf_channel_id_t channel_id,
     uint16_t on_time = on_time_cache_[channel_id];
     auto off_time = static_cast<uint16_t>((on_time + raw_value) & kMaxRawValue);
 
-    if (!parent_handler_->SetPwm(static_cast<uint8_t>(channel_id), on_time, off_time)) {
-        return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-    }
+    auto result = writeChannel(channel_id, on_time, off_time);
+    if (result != hf_pwm_err_t::PWM_SUCCESS) return result;
 
     duty_cache_[channel_id] = static_cast<float>(raw_value) / static_cast<float>(kMaxRawValue);
     channel_enabled_[channel_id] = true;
@@ -529,12 +763,10 @@ hf_pwm_err_t Pca9685PwmAdapter::SetPhaseShift(hf_channel_id_t channel_id,
 
     // If channel is active, re-apply duty cycle with new phase offset.
     if (channel_enabled_[channel_id] && duty_cache_[channel_id] > 0.0f) {
-        auto off_tick = static_cast<uint16_t>(
-            lroundf(duty_cache_[channel_id] * kMaxRawValue));
-        uint16_t off_time = (on_time + off_tick) & kMaxRawValue;
-        if (!parent_handler_->SetPwm(static_cast<uint8_t>(channel_id), on_time, off_time)) {
-            return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
-        }
+        uint16_t on_word = 0;
+        uint16_t off_word = 0;
+        dutyToWords(channel_id, duty_cache_[channel_id], on_word, off_word);
+        return writeChannel(channel_id, on_word, off_word);
     }
 
     return hf_pwm_err_t::PWM_SUCCESS;
@@ -555,10 +787,84 @@ hf_pwm_err_t Pca9685PwmAdapter::StopAll() noexcept {
 }
 
 hf_pwm_err_t Pca9685PwmAdapter::UpdateAll() noexcept {
-    // PCA9685 updates immediately on register write -- no buffered output mode.
+    if (!parent_handler_) return hf_pwm_err_t::PWM_ERR_NULL_POINTER;
+
+    // Snapshot under the lock and write without it, so channels can still be
+    // staged while the burst is on the bus.
+    uint16_t written = 0;
+    std::array<uint16_t, kMaxChannels> on_words;
+    std::array<uint16_t, kMaxChannels> off_words;
+    {
+        MutexLockGuard lock(staging_mutex_);
+        if (dirty_mask_ == 0) return hf_pwm_err_t::PWM_SUCCESS;
+        written = dirty_mask_;
+        on_words = staged_on_;
+        off_words = staged_off_;
+    }
+
+    // The handler drops unchanged channels and sends the rest in one burst
+    // spanning them, split only where a gap channel's value is unknown. On
+    // failure everything stays dirty; channels that did land are suppressed
+    // on the retry.
+    if (!parent_handler_->WriteChannels(written, on_words.data(), off_words.data())) {
+        return hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
+    }
+
+    // A channel restaged with new words during the write stays dirty.
+    MutexLockGuard lock(staging_mutex_);
+    for (uint8_t ch = 0; ch < kMaxChannels; ++ch) {
+        const auto bit = static_cast<uint16_t>(1U << ch);
+        if ((written & bit) != 0 && (staged_on_[ch] != on_words[ch] || staged_off_[ch] != off_words[ch])) {
+            written = static_cast<uint16_t>(written & ~bit);
+        }
+    }
+    dirty_mask_ = static_cast<uint16_t>(dirty_mask_ & ~written);
     return hf_pwm_err_t::PWM_SUCCESS;
 }
 
+hf_pwm_err_t Pca9685PwmAdapter::SetDeferredUpdates(bool enable) noexcept {
+    bool was_deferred = false;
+    {
+        MutexLockGuard lock(staging_mutex_);
+        was_deferred = deferred_updates_;
+        deferred_updates_ = enable;
+    }
+    if (!enable && was_deferred) {
+        // Writes from here on go straight out; flush what was staged before.
+        auto result = UpdateAll();
+        if (result != hf_pwm_err_t::PWM_SUCCESS) {
+            MutexLockGuard lock(staging_mutex_);
+            deferred_updates_ = true;
+            return result;
+        }
+    }
+    return hf_pwm_err_t::PWM_SUCCESS;
+}
+
+void Pca9685PwmAdapter::dutyToWords(hf_channel_id_t channel_id, float duty_cycle,
+                                    uint16_t& on_word, uint16_t& off_word) const noexcept {
+    // Use on-time offset for phase shift, off-time for duty.
+    Pca9685Handler::dutyToWords(duty_cycle, on_time_cache_[channel_id], on_word, off_word);
+}
+
+hf_pwm_err_t Pca9685PwmAdapter::writeChannel(hf_channel_id_t channel_id,
+                                             uint16_t on_word, uint16_t off_word) noexcept {
+    {
+        MutexLockGuard lock(staging_mutex_);
+        staged_on_[channel_id] = on_word;
+        staged_off_[channel_id] = off_word;
+
+        if (deferred_updates_) {
+            dirty_mask_ = static_cast<uint16_t>(dirty_mask_ | (1U << channel_id));
+            return hf_pwm_err_t::PWM_SUCCESS;
+        }
+    }
+
+    return parent_handler_->WriteChannel(static_cast<uint8_t>(channel_id), on_word, off_word)
+               ? hf_pwm_err_t::PWM_SUCCESS
+               : hf_pwm_err_t::PWM_ERR_COMMUNICATION_FAILURE;
+}
+
 hf_pwm_err_t Pca9685PwmAdapter::SetComplementaryOutput(
     hf_channel_id_t /*primary_channel*/,
     hf_channel_id_t /*complementary_channel*/,
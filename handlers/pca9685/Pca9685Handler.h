@@ -43,10 +43,14 @@
  * - One HalI2cPca9685Comm (I2C communication adapter)
  * - One typed pca9685::PCA9685<HalI2cPca9685Comm> driver instance
  * - One Pca9685PwmAdapter (created on demand)
- * - Up to 16 Pca9685GpioPin wrappers (created on demand via pin registry)
+ * - Up to 16 Pca9685GpioPin wrappers (created on demand in a GpioPinRegistry)
  *
  * External managers (PwmManager, GpioManager) obtain shared_ptr references via
- * GetPwmAdapter() and CreateGpioPin().
+ * GetPwmAdapter() and CreateGpioPin(). By default GPIO pin wrappers are
+ * heap-allocated and co-owned by those handles. Builds with
+ * HF_CORE_EXPANDER_PIN_POOL=ON construct them in an inline pool instead (no
+ * heap allocation); the CreateGpioPin() handles are then non-owning and valid
+ * only until EnsureDeinitialized() or handler destruction.
  *
  * ## Initialization Sequence
  *
@@ -95,6 +99,7 @@
 #include "base/BaseI2c.h"
 #include "core/hf-core-drivers/external/hf-pca9685-driver/inc/pca9685.hpp"
 #include "RtosMutex.h"
+#include "handlers/common/GpioPinRegistry.h"
 
 // Forward declarations
 class Pca9685Handler;
@@ -209,6 +214,16 @@ private:
  *
  * - **No complementary outputs**: SetComplementaryOutput() is unsupported.
  *
+ * ## Deferred Updates
+ *
+ * By default every SetDutyCycle() is its own I2C transaction. With
+ * SetDeferredUpdates(true), all channel writes (duty, raw duty, phase shift,
+ * enable/disable) only stage LEDn_ON/OFF register words in the adapter.
+ * UpdateAll() then writes every dirty channel with a single auto-increment
+ * burst from the lowest to the highest dirty channel; clean channels in
+ * between are re-sent with their current value. Outputs latch on the I2C STOP (MODE2.OCH = 0), so every
+ * channel in a burst changes in the same PWM period.
+ *
  * @note Created via Pca9685Handler::GetPwmAdapter(). The handler owns this instance.
  */
 class Pca9685PwmAdapter : public BasePwm {
@@ -326,8 +341,15 @@ public:
     hf_pwm_err_t StopAll() noexcept override;
 
     /**
-     * @brief No-op (PCA9685 updates immediately on register write).
-     * @return PWM_SUCCESS.
+     * @brief Flush staged channel values (deferred mode).
+     *
+     * Writes the dirty channels with one auto-increment burst over
+     * LEDn_ON_L..LEDn_OFF_H, from the lowest to the highest dirty channel
+     * (clean channels in between are re-sent unchanged). On failure the
+     * channels stay dirty so a later call can retry. No-op when nothing is staged (always the
+     * case in immediate mode).
+     *
+     * @return PWM_SUCCESS or PWM_ERR_COMMUNICATION_FAILURE.
      */
     hf_pwm_err_t UpdateAll() noexcept override;
 
@@ -355,6 +377,33 @@ public:
 
     /// @}
 
+    /// @name Deferred Update Mode
+    /// @{
+
+    /**
+     * @brief Enable or disable deferred (buffered) channel updates.
+     *
+     * Disabling flushes any staged channels before returning.
+     *
+     * @param enable true to stage writes until UpdateAll(), false for immediate writes.
+     * @return PWM_SUCCESS or the UpdateAll() error when flushing fails.
+     */
+    hf_pwm_err_t SetDeferredUpdates(bool enable) noexcept;
+
+    /** @brief Check if deferred updates are enabled. */
+    bool IsDeferredUpdates() const noexcept {
+        MutexLockGuard lock(staging_mutex_);
+        return deferred_updates_;
+    }
+
+    /** @brief Bitmask of channels staged but not yet written (bit N = channel N). */
+    uint16_t GetPendingChannelMask() const noexcept {
+        MutexLockGuard lock(staging_mutex_);
+        return dirty_mask_;
+    }
+
+    /// @}
+
     /// Allow handler to access internals.
     friend class Pca9685Handler;
 
@@ -368,12 +417,35 @@ private:
     std::array<bool, kMaxChannels> channel_enabled_;    ///< Channel enable state.
     /// @}
 
+    /// @name Staged Register Words
+    /// @brief LEDn_ON / LEDn_OFF values as written to the chip (bit 12 = full on/off).
+    ///        Guarded by staging_mutex_: UpdateAll() may run on another task
+    ///        (e.g. a servo trajectory timer) than the one staging channels.
+    /// @{
+    mutable RtosMutex staging_mutex_;                   ///< Guards the staging state below.
+    std::array<uint16_t, kMaxChannels> staged_on_;      ///< LEDn_ON word per channel.
+    std::array<uint16_t, kMaxChannels> staged_off_;     ///< LEDn_OFF word per channel.
+    uint16_t dirty_mask_ = 0;                           ///< Channels staged but not written.
+    bool deferred_updates_ = false;                     ///< Stage writes until UpdateAll().
+    /// @}
+
     hf_frequency_hz_t current_frequency_hz_ = 200;     ///< Current global frequency.
 
     /** @brief Validate channel ID is in range 0-15. */
     bool validateChannel(hf_channel_id_t channel_id) const noexcept {
         return channel_id < kMaxChannels;
     }
+
+    /** @brief Compute the ON/OFF register words for a duty cycle using the channel's phase offset. */
+    void dutyToWords(hf_channel_id_t channel_id, float duty_cycle,
+                     uint16_t& on_word, uint16_t& off_word) const noexcept;
+
+    /**
+     * @brief Write (immediate mode) or stage (deferred mode) one channel's register words.
+     * @return PWM_SUCCESS or PWM_ERR_COMMUNICATION_FAILURE.
+     */
+    hf_pwm_err_t writeChannel(hf_channel_id_t channel_id,
+                              uint16_t on_word, uint16_t off_word) noexcept;
 };
 
 /// @} // end of PCA9685_HAL_PwmAdapter
@@ -402,8 +474,8 @@ private:
  * This is useful for controlling LEDs, relays, or enable pins where simple
  * on/off control is sufficient without PWM.
  *
- * @note Pin instances are created via Pca9685Handler::CreateGpioPin() and stored
- *       in the handler's pin registry as shared_ptr.
+ * @note Pin instances are created via Pca9685Handler::CreateGpioPin() or
+ *       CreateGpioPinRef() and stored in the handler's pin registry.
  */
 class Pca9685GpioPin : public BaseGpio {
 public:
@@ -498,6 +570,17 @@ private:
 /// @{
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief Channel register write statistics (see Pca9685Handler::GetWriteStats()).
+ */
+struct Pca9685WriteStats {
+    uint32_t channel_writes = 0;    ///< Channel ON/OFF register sets sent to the chip.
+    uint32_t suppressed_writes = 0; ///< Writes skipped because the chip already held the value.
+    uint32_t merged_writes = 0;     ///< Channel writes that shared a burst with a preceding channel.
+    uint32_t burst_count = 0;       ///< Multi-channel auto-increment transactions.
+    uint32_t filler_writes = 0;     ///< Unchanged channels re-sent to keep a burst contiguous.
+};
+
 /**
  * @class Pca9685Handler
  * @brief Unified, non-templated handler for a single PCA9685 PWM controller.
@@ -522,6 +605,16 @@ private:
  *   Using both simultaneously for the same channel is allowed but the last
  *   write wins.
  *
+ * - **Write suppression**: The handler shadows the LEDn_ON/OFF words it last
+ *   wrote for each channel. A channel write identical to the shadow is skipped,
+ *   and multi-channel flushes (Pca9685PwmAdapter::UpdateAll()) send only the
+ *   changed channels, as one burst from the lowest to the highest changed
+ *   channel (unchanged channels in between are re-sent as filler).
+ *   The shadow is invalidated on (re)initialization and whenever GetDriver()
+ *   hands out the driver for direct register access. The cached MODE1.AI
+ *   state is dropped there too (and by SetFrequency(), Sleep() and Wake()),
+ *   so the next burst re-reads MODE1.
+ *
  * @see HalI2cPca9685Comm    I2C communication adapter
  * @see Pca9685PwmAdapter    Multi-channel BasePwm wrapper
  * @see Pca9685GpioPin       Per-channel BaseGpio wrapper
@@ -624,11 +717,38 @@ public:
     std::shared_ptr<BasePwm> GetPwmAdapter() noexcept;
 
     /**
-     * @brief Create or retrieve a BaseGpio pin wrapper for a channel.
+     * @brief Create or retrieve a pin wrapper for a channel (non-owning handle).
      *
      * Uses the channel as a digital output (fully on / fully off).
      * If a wrapper for the channel already exists and allow_existing is true,
-     * the existing instance is returned.
+     * the existing instance is returned. The pointer does no reference
+     * counting and is valid until EnsureDeinitialized() or handler destruction.
+     *
+     * @param channel        Channel number (0-15).
+     * @param active_state   Active polarity (default: active high).
+     * @param allow_existing If true, returns existing wrapper; if false, fails if exists.
+     * @return Pointer to the pin wrapper, or nullptr on failure.
+     */
+    Pca9685GpioPin* CreateGpioPinRef(
+        hf_pin_num_t channel,
+        hf_gpio_active_state_t active_state =
+            hf_gpio_active_state_t::HF_GPIO_ACTIVE_HIGH,
+        bool allow_existing = true) noexcept;
+
+    /**
+     * @brief Get an existing pin wrapper by channel number (non-owning handle).
+     * @param channel Channel number (0-15).
+     * @return Pointer to the pin wrapper, or nullptr if not created.
+     */
+    Pca9685GpioPin* GetGpioPinRef(hf_pin_num_t channel) noexcept;
+
+    /**
+     * @brief Create or retrieve a BaseGpio pin wrapper for a channel.
+     *
+     * Same as CreateGpioPinRef(), returning a shared_ptr. By default it
+     * co-owns the wrapper. With the pin pool enabled it is a non-owning
+     * handle without a control block (copies do no atomic reference
+     * counting) that must not outlive the handler or an EnsureDeinitialized() call.
      *
      * @param channel        Channel number (0-15).
      * @param active_state   Active polarity (default: active high).
@@ -644,10 +764,22 @@ public:
     /**
      * @brief Get an existing GPIO pin wrapper by channel number.
      * @param channel Channel number (0-15).
-     * @return shared_ptr<BaseGpio> or nullptr if not created.
+     * @return shared_ptr<BaseGpio> (non-owning with the pin pool enabled) or nullptr if not created.
      */
     std::shared_ptr<BaseGpio> GetGpioPin(hf_pin_num_t channel) noexcept;
 
+    /**
+     * @brief Whether GPIO pin wrappers are constructed in an inline pool (build
+     *        option HF_CORE_EXPANDER_PIN_POOL) instead of on the heap.
+     *
+     * Pooled wrappers cost no heap allocation, but CreateGpioPin() / GetGpioPin()
+     * then return non-owning handles that dangle after EnsureDeinitialized().
+     */
+    static constexpr bool IsPinPoolEnabled() noexcept { return decltype(gpio_registry_)::kPooled; }
+
+    /** @brief GPIO pin wrappers allocated on the heap since construction (stays 0 while pooled). */
+    uint32_t GetPinHeapAllocations() const noexcept;
+
     /**
      * @brief Check if a GPIO pin wrapper has been created for a channel.
      * @param channel Channel number (0-15).
@@ -676,6 +808,37 @@ public:
 
     /// @}
 
+    //==========================================================================
+    /// @name Write Suppression
+    /// @{
+    //==========================================================================
+
+    /**
+     * @brief Enable or disable skipping of writes that match the register shadow.
+     * @param enable true to suppress identical writes (default), false to always write.
+     */
+    void SetWriteSuppression(bool enable) noexcept;
+
+    /** @brief Check if identical-write suppression is enabled. */
+    bool IsWriteSuppressionEnabled() const noexcept;
+
+    /**
+     * @brief Forget the shadowed channel register values.
+     *
+     * Call after changing LEDn registers behind the handler's back (e.g. a
+     * device reset from another master) so the next write to each channel is
+     * always sent.
+     */
+    void InvalidateWriteCache() noexcept;
+
+    /** @brief Get channel write / suppression / merge counters. */
+    Pca9685WriteStats GetWriteStats() const noexcept;
+
+    /** @brief Reset the write counters. */
+    void ResetWriteStats() noexcept;
+
+    /// @}
+
     //==========================================================================
     /// @name Diagnostics
     /// @{
@@ -695,6 +858,10 @@ public:
 
     /**
      * @brief Get the underlying PCA9685 driver for advanced register-level operations.
+     *
+     * Invalidates the write-suppression shadow, since the caller may change
+     * channel registers directly.
+     *
      * @return Pointer to the CRTP driver, or nullptr if not initialized.
      */
     [[nodiscard]] Pca9685Driver* GetDriver() noexcept;
@@ -735,6 +902,67 @@ private:
     bool SetOutputInvert(bool invert) noexcept;
     bool SetOutputDriverMode(bool totem_pole) noexcept;
 
+    /**
+     * @brief Write one channel's LEDn_ON/OFF words (suppressed if unchanged).
+     * @param channel  Channel (0-15).
+     * @param on_word  LEDn_ON word (bit 12 = full on).
+     * @param off_word LEDn_OFF word (bit 12 = full off).
+     * @return true if written or suppressed.
+     */
+    bool WriteChannel(uint8_t channel, uint16_t on_word, uint16_t off_word) noexcept;
+
+    /**
+     * @brief Write a set of channels, skipping unchanged ones and bursting the rest.
+     *
+     * The changed channels are sent as one auto-increment burst over
+     * LEDn_ON_L..LEDn_OFF_H, from the lowest to the highest changed channel.
+     * Channels in between keep their value: the shadow is re-sent when valid,
+     * the caller's word when the channel is in @p channel_mask. A gap channel
+     * with neither splits the burst, so a channel whose value is unknown is
+     * never written.
+     *
+     * @param channel_mask Channels to write (bit N = channel N).
+     * @param on_words     16-entry array of LEDn_ON words (bit 12 = full on).
+     * @param off_words    16-entry array of LEDn_OFF words (bit 12 = full off).
+     * @return true if every changed channel was written.
+     */
+    bool WriteChannels(uint16_t channel_mask, const uint16_t* on_words,
+                       const uint16_t* off_words) noexcept;
+
+    /** @brief Single-channel write with suppression (mutex held, initialized). */
+    bool writeChannelLocked(uint8_t channel, uint16_t on_word, uint16_t off_word) noexcept;
+
+    /** @brief Burst-write consecutive channels (mutex held, initialized, MODE1.AI set). */
+    bool writeBurstLocked(uint8_t first_channel, const uint16_t* on_words,
+                          const uint16_t* off_words, uint8_t count) noexcept;
+
+    /** @brief Check if the shadow says the chip already holds these words (mutex held). */
+    bool isUnchangedLocked(uint8_t channel, uint16_t on_word, uint16_t off_word) const noexcept;
+
+    /** @brief Record a channel write result in the shadow (mutex held). */
+    void recordWriteLocked(uint8_t channel, uint16_t on_word, uint16_t off_word, bool ok) noexcept;
+
+    /** @brief Make sure MODE1.AI is set so bursts walk the register map (mutex held). */
+    bool ensureAutoIncrementLocked() noexcept;
+
+    /**
+     * @brief ON/OFF register words for a duty cycle starting at @p on_tick.
+     *
+     * duty >= 1 -> full-on, duty <= 0 -> full-off, otherwise the off edge is
+     * lroundf(duty * 4095) ticks after @p on_tick (wrapping at 4096).
+     */
+    static void dutyToWords(float duty, uint16_t on_tick, uint16_t& on_word, uint16_t& off_word) noexcept;
+
+    /// @name Register Map (burst writes)
+    /// @{
+    static constexpr uint8_t kRegMode1 = 0x00;             ///< MODE1 register.
+    static constexpr uint8_t kRegLed0OnL = 0x06;           ///< LED0_ON_L, first channel register.
+    static constexpr uint8_t kRegsPerChannel = 4;          ///< ON_L, ON_H, OFF_L, OFF_H.
+    static constexpr uint8_t kMode1Restart = 0x80;         ///< MODE1.RESTART (write 1 restarts).
+    static constexpr uint8_t kMode1AutoIncrement = 0x20;   ///< MODE1.AI.
+    static constexpr uint16_t kLedFullBit = 0x1000;        ///< Full on/off flag in LEDn words.
+    /// @}
+
     //==========================================================================
     // Private Members
     //==========================================================================
@@ -745,13 +973,23 @@ private:
     std::unique_ptr<HalI2cPca9685Comm> i2c_adapter_;   ///< I2C adapter (created in init).
     std::unique_ptr<Pca9685Driver> pca9685_driver_;    ///< Typed driver (created in init).
     bool initialized_ = false;                          ///< Initialization state.
+    bool auto_increment_enabled_ = false;               ///< MODE1.AI confirmed set.
     mutable RtosMutex handler_mutex_;                   ///< Thread safety for all operations.
     /// @}
 
     /// @name Wrapper Registry
     /// @{
     std::shared_ptr<Pca9685PwmAdapter> pwm_adapter_;                 ///< PWM adapter (lazy).
-    std::array<std::shared_ptr<Pca9685GpioPin>, 16> gpio_registry_;  ///< GPIO pin registry.
+    GpioPinRegistry<Pca9685GpioPin, 16> gpio_registry_;              ///< GPIO pin wrappers (kDefaultGpioPinStorage).
+    /// @}
+
+    /// @name Channel Register Shadow
+    /// @{
+    std::array<uint16_t, 16> shadow_on_{};   ///< Last LEDn_ON word written per channel.
+    std::array<uint16_t, 16> shadow_off_{};  ///< Last LEDn_OFF word written per channel.
+    uint16_t shadow_valid_mask_ = 0;         ///< Channels whose shadow matches the chip.
+    bool write_suppression_enabled_ = true;  ///< Skip writes that match the shadow.
+    Pca9685WriteStats write_stats_{};        ///< Write / suppression / merge counters.
     /// @}
 };
 
@@ -0,0 +1,498 @@
+/**
+ * @file Pca9685ServoTrajectory.cpp
+ * @brief Implementation of the PCA9685 servo trajectory engine.
+ *
+ * @see Pca9685ServoTrajectory.h  for architectural overview and Doxygen documentation.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ */
+
+#include "Pca9685ServoTrajectory.h"
+#include "Pca9685Handler.h"
+#include "handlers/logger/Logger.h"
+#include "OsUtility.h"
+
+#include <cstdlib>
+
+namespace {
+
+constexpr int32_t kQ16One = 1 << 16;
+
+/// Integer square root (floor) of a 64-bit value.
+uint64_t IntegerSqrt(uint64_t value) noexcept {
+    uint64_t result = 0;
+    uint64_t bit = uint64_t{1} << 62;
+    while (bit > value) bit >>= 2;
+    while (bit != 0) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return result;
+}
+
+int32_t SaturateInt32(int64_t value) noexcept {
+    if (value > INT32_MAX) return INT32_MAX;
+    if (value < INT32_MIN) return INT32_MIN;
+    return static_cast<int32_t>(value);
+}
+
+} // namespace
+
+RtosMutex Pca9685ServoTrajectory::timer_registry_mutex_{};
+std::array<Pca9685ServoTrajectory*, Pca9685ServoTrajectory::kTimerContextSlots>
+    Pca9685ServoTrajectory::timer_registry_ = {};
+
+// =====================================================================
+// Construction & Destruction
+// =====================================================================
+
+Pca9685ServoTrajectory::Pca9685ServoTrajectory(Pca9685PwmAdapter& pwm) noexcept
+    : pwm_(pwm) {}
+
+Pca9685ServoTrajectory::~Pca9685ServoTrajectory() noexcept {
+    Stop();
+}
+
+// =====================================================================
+// Channel Configuration
+// =====================================================================
+
+hf_pwm_err_t Pca9685ServoTrajectory::ConfigureChannel(uint8_t channel,
+                                                      const Pca9685ServoConfig& config) noexcept {
+    if (channel >= kMaxChannels) return hf_pwm_err_t::PWM_ERR_INVALID_CHANNEL;
+    if (config.min_pulse_us >= config.max_pulse_us || config.max_pulse_us > kMaxPulseUs) {
+        return hf_pwm_err_t::PWM_ERR_INVALID_PARAMETER;
+    }
+
+    MutexLockGuard lock(mutex_);
+    Channel& ch = channels_[channel];
+    ch.config = config;
+    ch.enabled = true;
+    updateStepsLocked(ch);
+
+    // Keep a known position inside the (possibly narrower) new window.
+    if (ch.has_position) {
+        const int32_t lo = static_cast<int32_t>(config.min_pulse_us) * kQ16One;
+        const int32_t hi = static_cast<int32_t>(config.max_pulse_us) * kQ16One;
+        if (ch.target_q16 < lo) ch.target_q16 = lo;
+        if (ch.target_q16 > hi) ch.target_q16 = hi;
+    }
+    return hf_pwm_err_t::PWM_SUCCESS;
+}
+
+hf_pwm_err_t Pca9685ServoTrajectory::ReleaseChannel(uint8_t channel) noexcept {
+    if (channel >= kMaxChannels) return hf_pwm_err_t::PWM_ERR_INVALID_CHANNEL;
+    MutexLockGuard lock(mutex_);
+    channels_[channel] = Channel{};
+    return hf_pwm_err_t::PWM_SUCCESS;
+}
+
+hf_pwm_err_t Pca9685ServoTrajectory::SetTarget(uint8_t channel, uint16_t pulse_us) noexcept {
+    if (channel >= kMaxChannels) return hf_pwm_err_t::PWM_ERR_INVALID_CHANNEL;
+    MutexLockGuard lock(mutex_);
+    Channel& ch = channels_[channel];
+    if (!ch.enabled) return hf_pwm_err_t::PWM_ERR_NOT_INITIALIZED;
+
+    ch.target_q16 = clampPulseQ16(ch, pulse_us);
+    if (!ch.has_position) {
+        // Nothing to ramp from -- the servo's real position is unknown.
+        ch.position_q16 = ch.target_q16;
+        ch.velocity_q16 = 0;
+        ch.has_position = true;
+    }
+    return hf_pwm_err_t::PWM_SUCCESS;
+}
+
+hf_pwm_err_t Pca9685ServoTrajectory::SetPosition(uint8_t channel, uint16_t pulse_us) noexcept {
+    if (channel >= kMaxChannels) return hf_pwm_err_t::PWM_ERR_INVALID_CHANNEL;
+    MutexLockGuard lock(mutex_);
+    Channel& ch = channels_[channel];
+    if (!ch.enabled) return hf_pwm_err_t::PWM_ERR_NOT_INITIALIZED;
+
+    ch.target_q16 = clampPulseQ16(ch, pulse_us);
+    ch.position_q16 = ch.target_q16;
+    ch.velocity_q16 = 0;
+    ch.has_position = true;
+    return hf_pwm_err_t::PWM_SUCCESS;
+}
+
+uint16_t Pca9685ServoTrajectory::GetPosition(uint8_t channel) const noexcept {
+    if (channel >= kMaxChannels) return 0;
+    MutexLockGuard lock(mutex_);
+    const Channel& ch = channels_[channel];
+    if (!ch.has_position) return 0;
+    return static_cast<uint16_t>((ch.position_q16 + kQ16One / 2) >> 16);
+}
+
+bool Pca9685ServoTrajectory::IsMoving(uint8_t channel) const noexcept {
+    if (channel >= kMaxChannels) return false;
+    MutexLockGuard lock(mutex_);
+    const Channel& ch = channels_[channel];
+    return ch.enabled && ch.has_position &&
+           (ch.position_q16 != ch.target_q16 || ch.velocity_q16 != 0);
+}
+
+bool Pca9685ServoTrajectory::IsAnyMoving() const noexcept {
+    for (uint8_t i = 0; i < kMaxChannels; ++i) {
+        if (IsMoving(i)) return true;
+    }
+    return false;
+}
+
+void Pca9685ServoTrajectory::updateStepsLocked(Channel& channel) const noexcept {
+    // us/s -> Q16 us/frame, and us/s^2 -> Q16 us/frame^2 (two divisions keep
+    // the intermediate inside 64 bits for any 32-bit limit and period).
+    const auto period = static_cast<int64_t>(frame_period_us_);
+    const int64_t vel = static_cast<int64_t>(channel.config.max_velocity_us_per_s) * kQ16One;
+    const int64_t acc = static_cast<int64_t>(channel.config.max_accel_us_per_s2) * kQ16One;
+
+    channel.max_step_q16 = SaturateInt32(vel * period / 1000000);
+    channel.accel_step_q16 = SaturateInt32(acc * period / 1000000 * period / 1000000);
+
+    // A non-zero limit must never round down to "unlimited".
+    if (channel.config.max_velocity_us_per_s != 0 && channel.max_step_q16 == 0) {
+        channel.max_step_q16 = 1;
+    }
+    if (channel.config.max_accel_us_per_s2 != 0 && channel.accel_step_q16 == 0) {
+        channel.accel_step_q16 = 1;
+    }
+}
+
+int32_t Pca9685ServoTrajectory::clampPulseQ16(const Channel& channel, uint16_t pulse_us) noexcept {
+    if (pulse_us < channel.config.min_pulse_us) pulse_us = channel.config.min_pulse_us;
+    if (pulse_us > channel.config.max_pulse_us) pulse_us = channel.config.max_pulse_us;
+    return static_cast<int32_t>(pulse_us) * kQ16One;
+}
+
+// =====================================================================
+// Fixed-Point Kinematics
+// =====================================================================
+
+void Pca9685ServoTrajectory::StepAxis(int32_t& position_q16, int32_t& velocity_q16,
+                                      int32_t target_q16, int32_t max_step_q16,
+                                      int32_t accel_step_q16) noexcept {
+    const int64_t error = static_cast<int64_t>(target_q16) - position_q16;
+
+    if (max_step_q16 <= 0 && accel_step_q16 <= 0) {
+        position_q16 = target_q16;
+        velocity_q16 = 0;
+        return;
+    }
+
+    const int64_t v_max = max_step_q16 > 0 ? max_step_q16 : INT32_MAX;
+    const int64_t distance = error >= 0 ? error : -error;
+
+    if (accel_step_q16 <= 0) {
+        // Velocity-limited: constant speed, land exactly on the target.
+        const int64_t step = distance < v_max ? distance : v_max;
+        velocity_q16 = static_cast<int32_t>(error >= 0 ? step : -step);
+        position_q16 = static_cast<int32_t>(position_q16 + velocity_q16);
+        return;
+    }
+
+    const int64_t accel = accel_step_q16;
+    int64_t velocity = velocity_q16;
+    if (error == 0 && (velocity >= -accel && velocity <= accel)) {
+        velocity_q16 = 0;
+        return;
+    }
+
+    // Fastest speed from which the axis can still stop at the target:
+    // v^2 = 2 * a * d (Q16 * Q16 = Q32, sqrt -> Q16).
+    int64_t v_desired = static_cast<int64_t>(
+        IntegerSqrt(static_cast<uint64_t>(2 * accel) * static_cast<uint64_t>(distance)));
+    if (v_desired > v_max) v_desired = v_max;
+    if (error < 0) v_desired = -v_desired;
+
+    // Approach the desired velocity within the acceleration limit.
+    if (velocity < v_desired) {
+        velocity = (velocity + accel < v_desired) ? velocity + accel : v_desired;
+    } else {
+        velocity = (velocity - accel > v_desired) ? velocity - accel : v_desired;
+    }
+
+    int64_t next = static_cast<int64_t>(position_q16) + velocity;
+    if ((error > 0 && next >= target_q16) || (error < 0 && next <= target_q16)) {
+        // Arrived: discrete integration would otherwise overshoot slightly.
+        next = target_q16;
+        velocity = 0;
+    }
+    position_q16 = static_cast<int32_t>(next);
+    velocity_q16 = static_cast<int32_t>(velocity);
+}
+
+uint16_t Pca9685ServoTrajectory::PulseToTicks(int32_t pulse_q16, uint32_t frequency_hz) noexcept {
+    if (pulse_q16 <= 0 || frequency_hz == 0) return 0;
+    // ticks = pulse_us * f * 4096 / 1e6, with pulse_us = pulse_q16 / 65536.
+    constexpr uint64_t kDenominator = uint64_t{1000000} << 16;
+    const uint64_t ticks =
+        (static_cast<uint64_t>(pulse_q16) * frequency_hz * 4096 + kDenominator / 2) / kDenominator;
+    return ticks > Pca9685PwmAdapter::kMaxRawValue
+               ? Pca9685PwmAdapter::kMaxRawValue
+               : static_cast<uint16_t>(ticks);
+}
+
+// =====================================================================
+// Frame Scheduling
+// =====================================================================
+
+hf_pwm_err_t Pca9685ServoTrajectory::SetFramePeriodUs(uint32_t period_us) noexcept {
+    if (period_us == 0) return hf_pwm_err_t::PWM_ERR_INVALID_PARAMETER;
+    MutexLockGuard lock(mutex_);
+    if (timer_context_id_ != 0) return hf_pwm_err_t::PWM_ERR_INVALID_STATE;
+
+    frame_period_us_ = period_us;
+    last_frame_start_us_ = 0;
+    for (auto& ch : channels_) {
+        if (ch.enabled) updateStepsLocked(ch);
+    }
+    return hf_pwm_err_t::PWM_SUCCESS;
+}
+
+hf_pwm_err_t Pca9685ServoTrajectory::RunFrame() noexcept {
+    MutexLockGuard lock(mutex_);
+    const uint64_t frame_start_us = RtosTime::GetCurrentTimeUs();
+
+    if (last_frame_start_us_ != 0) {
+        const int64_t interval = static_cast<int64_t>(frame_start_us - last_frame_start_us_);
+        const auto jitter = static_cast<uint32_t>(
+            std::llabs(interval - static_cast<int64_t>(frame_period_us_)));
+        stats_.last_jitter_us = jitter;
+        stats_.total_jitter_us += jitter;
+        if (jitter > stats_.max_jitter_us) stats_.max_jitter_us = jitter;
+    }
+    last_frame_start_us_ = frame_start_us;
+
+    captureDeferredStateLocked();
+    if (!pwm_.IsDeferredUpdates()) {
+        pwm_.SetDeferredUpdates(true);
+    }
+
+    // Advance every channel and stage changed outputs.
+    const uint32_t frequency_hz = pwm_.GetFrequency(0);
+    for (uint8_t i = 0; i < kMaxChannels; ++i) {
+        Channel& ch = channels_[i];
+        if (!ch.enabled || !ch.has_position) continue;
+
+        StepAxis(ch.position_q16, ch.velocity_q16, ch.target_q16,
+                 ch.max_step_q16, ch.accel_step_q16);
+
+        const uint16_t ticks = PulseToTicks(ch.position_q16, frequency_hz);
+        if (ticks != ch.last_ticks &&
+            pwm_.SetDutyCycleRaw(i, ticks) == hf_pwm_err_t::PWM_SUCCESS) {
+            ch.last_ticks = ticks;
+        }
+    }
+    const uint64_t compute_end_us = RtosTime::GetCurrentTimeUs();
+
+    // One burst for everything staged this frame.
+    const hf_pwm_err_t result = pwm_.UpdateAll();
+    const uint64_t frame_end_us = RtosTime::GetCurrentTimeUs();
+
+    ++stats_.frame_count;
+    if (result != hf_pwm_err_t::PWM_SUCCESS) {
+        ++stats_.write_failures;
+    }
+    stats_.last_compute_us = static_cast<uint32_t>(compute_end_us - frame_start_us);
+    if (stats_.last_compute_us > stats_.max_compute_us) {
+        stats_.max_compute_us = stats_.last_compute_us;
+    }
+    stats_.last_frame_us = static_cast<uint32_t>(frame_end_us - frame_start_us);
+    stats_.total_frame_us += stats_.last_frame_us;
+    if (stats_.last_frame_us > stats_.max_frame_us) {
+        stats_.max_frame_us = stats_.last_frame_us;
+    }
+    return result;
+}
+
+void Pca9685ServoTrajectory::captureDeferredStateLocked() noexcept {
+    if (!deferred_captured_) {
+        prior_deferred_ = pwm_.IsDeferredUpdates();
+        deferred_captured_ = true;
+    }
+}
+
+hf_pwm_err_t Pca9685ServoTrajectory::Start(uint32_t frame_hz) noexcept {
+    if (frame_hz == 0 || frame_hz > 1000) return hf_pwm_err_t::PWM_ERR_INVALID_PARAMETER;
+
+    MutexLockGuard lock(mutex_);
+    if (timer_context_id_ != 0) return hf_pwm_err_t::PWM_ERR_INVALID_STATE;
+
+    // The timer runs on whole milliseconds; do the motion math on the real period.
+    const uint32_t period_ms = 1000 / frame_hz;
+    frame_period_us_ = period_ms * 1000;
+    last_frame_start_us_ = 0;
+    for (auto& ch : channels_) {
+        if (ch.enabled) updateStepsLocked(ch);
+    }
+    captureDeferredStateLocked();
+
+    timer_context_id_ = RegisterTimerContext(this);
+    if (timer_context_id_ == 0) {
+        return hf_pwm_err_t::PWM_ERR_OUT_OF_MEMORY;
+    }
+    if (!frame_timer_.Create("pca9685_traj", FrameTimerCallback,
+                             timer_context_id_, period_ms, true)) {
+        UnregisterTimerContext(timer_context_id_);
+        timer_context_id_ = 0;
+        return hf_pwm_err_t::PWM_ERR_FAILURE;
+    }
+    return hf_pwm_err_t::PWM_SUCCESS;
+}
+
+hf_pwm_err_t Pca9685ServoTrajectory::Stop() noexcept {
+    uint32_t context_id = 0;
+    {
+        MutexLockGuard lock(mutex_);
+        context_id = timer_context_id_;
+        timer_context_id_ = 0;
+    }
+    if (context_id != 0) {
+        // Unregister first so a late callback resolves to nothing, then let
+        // a frame that already resolved this engine finish.
+        UnregisterTimerContext(context_id);
+        frame_timer_.Stop();
+        frame_timer_.Destroy();
+        while (frames_in_flight_.load(std::memory_order_acquire) != 0) {
+            os_delay_msec(1);
+        }
+    }
+
+    MutexLockGuard lock(mutex_);
+    if (!deferred_captured_) {
+        return hf_pwm_err_t::PWM_SUCCESS;
+    }
+    deferred_captured_ = false;
+    return pwm_.SetDeferredUpdates(prior_deferred_);
+}
+
+bool Pca9685ServoTrajectory::IsRunning() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return timer_context_id_ != 0;
+}
+
+void Pca9685ServoTrajectory::FrameTimerCallback(uint32_t arg) {
+    auto* engine = ResolveTimerContext(arg);
+    if (engine == nullptr) {
+        return;
+    }
+    engine->RunFrame();
+    engine->frames_in_flight_.fetch_sub(1, std::memory_order_release);
+}
+
+uint32_t Pca9685ServoTrajectory::RegisterTimerContext(Pca9685ServoTrajectory* engine) noexcept {
+    if (engine == nullptr) {
+        return 0;
+    }
+
+    MutexLockGuard lock(timer_registry_mutex_);
+    if (!lock.IsLocked()) {
+        return 0;
+    }
+
+    for (uint32_t idx = 0; idx < kTimerContextSlots; ++idx) {
+        if (timer_registry_[idx] == nullptr) {
+            timer_registry_[idx] = engine;
+            return idx + 1;  // Reserve 0 as invalid ID.
+        }
+    }
+    return 0;
+}
+
+void Pca9685ServoTrajectory::UnregisterTimerContext(uint32_t context_id) noexcept {
+    if (context_id == 0 || context_id > kTimerContextSlots) {
+        return;
+    }
+
+    MutexLockGuard lock(timer_registry_mutex_);
+    if (!lock.IsLocked()) {
+        return;
+    }
+
+    timer_registry_[context_id - 1] = nullptr;
+}
+
+Pca9685ServoTrajectory* Pca9685ServoTrajectory::ResolveTimerContext(uint32_t context_id) noexcept {
+    if (context_id == 0 || context_id > kTimerContextSlots) {
+        return nullptr;
+    }
+
+    MutexLockGuard lock(timer_registry_mutex_);
+    if (!lock.IsLocked()) {
+        return nullptr;
+    }
+
+    // Counted under the registry mutex so Stop() cannot miss this frame.
+    Pca9685ServoTrajectory* engine = timer_registry_[context_id - 1];
+    if (engine != nullptr) {
+        engine->frames_in_flight_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return engine;
+}
+
+// =====================================================================
+// Statistics
+// =====================================================================
+
+Pca9685TrajectoryStats Pca9685ServoTrajectory::GetStats() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return stats_;
+}
+
+void Pca9685ServoTrajectory::ResetStats() noexcept {
+    MutexLockGuard lock(mutex_);
+    stats_ = Pca9685TrajectoryStats{};
+    last_frame_start_us_ = 0;
+}
+
+void Pca9685ServoTrajectory::DumpDiagnostics() const noexcept {
+    static constexpr const char* TAG = "Pca9685ServoTrajectory";
+
+    Logger::GetInstance().Info(TAG, "=== PCA9685 SERVO TRAJECTORY DIAGNOSTICS ===");
+
+    MutexLockGuard lock(mutex_);
+
+    Logger::GetInstance().Info(TAG, "  Frame Timer: %s  Period: %lu us",
+                              timer_context_id_ != 0 ? "RUNNING" : "STOPPED",
+                              static_cast<unsigned long>(frame_period_us_));
+
+    const uint32_t frames = stats_.frame_count;
+    const uint32_t intervals = frames > 1 ? frames - 1 : 0;
+    Logger::GetInstance().Info(TAG, "  Frames: %lu  Write Failures: %lu",
+                              static_cast<unsigned long>(frames),
+                              static_cast<unsigned long>(stats_.write_failures));
+    Logger::GetInstance().Info(TAG, "  Jitter(us) last=%lu avg=%lu max=%lu",
+                              static_cast<unsigned long>(stats_.last_jitter_us),
+                              static_cast<unsigned long>(
+                                  intervals ? stats_.total_jitter_us / intervals : 0),
+                              static_cast<unsigned long>(stats_.max_jitter_us));
+    Logger::GetInstance().Info(TAG, "  Compute(us) last=%lu max=%lu  Frame(us) last=%lu avg=%lu max=%lu",
+                              static_cast<unsigned long>(stats_.last_compute_us),
+                              static_cast<unsigned long>(stats_.max_compute_us),
+                              static_cast<unsigned long>(stats_.last_frame_us),
+                              static_cast<unsigned long>(
+                                  frames ? stats_.total_frame_us / frames : 0),
+                              static_cast<unsigned long>(stats_.max_frame_us));
+
+    for (uint8_t i = 0; i < kMaxChannels; ++i) {
+        const Channel& ch = channels_[i];
+        if (!ch.enabled) continue;
+        Logger::GetInstance().Info(
+            TAG, "  [%u] pos=%ld us target=%ld us vmax=%lu us/s amax=%lu us/s^2 %s",
+            static_cast<unsigned>(i),
+            static_cast<long>(ch.position_q16 >> 16),
+            static_cast<long>(ch.target_q16 >> 16),
+            static_cast<unsigned long>(ch.config.max_velocity_us_per_s),
+            static_cast<unsigned long>(ch.config.max_accel_us_per_s2),
+            !ch.has_position ? "UNKNOWN"
+                : (ch.position_q16 != ch.target_q16 ? "MOVING" : "SETTLED"));
+    }
+
+    Logger::GetInstance().Info(TAG, "=== END PCA9685 SERVO TRAJECTORY DIAGNOSTICS ===");
+}
@@ -0,0 +1,340 @@
+/**
+ * @file Pca9685ServoTrajectory.h
+ * @brief Fixed-point servo trajectory engine layered over Pca9685PwmAdapter.
+ *
+ * @details
+ * ## Purpose
+ *
+ * Streaming servo positions from application code gives jittery, uneven
+ * motion and one I2C transaction per servo per update. This engine owns the
+ * motion instead: each channel gets a target pulse width plus optional velocity
+ * and acceleration limits, and a single periodic frame advances every channel
+ * and pushes the result to the PCA9685 in one burst:
+ *
+ * @code
+ *  PeriodicTimer (frame_hz) ──> RunFrame()
+ *    for each enabled channel:
+ *      StepAxis()       -- Q16.16 integer kinematics, no floats
+ *      PulseToTicks()   -- pulse width -> 12-bit off tick at current frequency
+ *      SetDutyCycleRaw  -- staged in the adapter (deferred mode)
+ *    UpdateAll()        -- one auto-increment burst, unchanged channels suppressed
+ * @endcode
+ *
+ * StepAxis() and PulseToTicks() are static and hardware-free, so the motion
+ * math can be exercised without a device.
+ *
+ * ## Motion Profile
+ *
+ * - No limits: the channel jumps to the target on the next frame.
+ * - Velocity limit only: constant-speed move, clamped at the target.
+ * - Velocity + acceleration: trapezoidal (or triangular) profile. Each frame
+ *   the speed is limited to what still allows stopping at the target.
+ *
+ * ## Usage
+ *
+ * @code
+ * auto pwm = std::static_pointer_cast<Pca9685PwmAdapter>(handler.GetPwmAdapter());
+ * pwm->SetFrequency(0, 50);
+ *
+ * Pca9685ServoTrajectory servos(*pwm);
+ * Pca9685ServoConfig cfg;
+ * cfg.max_velocity_us_per_s = 2000;   // full 1000 us sweep in 0.5 s
+ * cfg.max_accel_us_per_s2 = 8000;
+ * servos.ConfigureChannel(0, cfg);
+ * servos.SetPosition(0, 1500);        // known start point
+ * servos.Start(50);                   // 50 frames/s
+ * servos.SetTarget(0, 2000);
+ * @endcode
+ *
+ * ## Lifetime Requirements
+ *
+ * The adapter (and its Pca9685Handler) must outlive the engine. The engine
+ * switches the adapter to deferred updates; other writes through the same
+ * adapter are flushed with the next frame.
+ *
+ * @see Pca9685PwmAdapter  Deferred-update BasePwm adapter driven by this class.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ */
+
+#ifndef COMPONENT_HANDLER_PCA9685_SERVO_TRAJECTORY_H_
+#define COMPONENT_HANDLER_PCA9685_SERVO_TRAJECTORY_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include "base/BasePwm.h"
+#include "RtosMutex.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/PeriodicTimer.h"
+
+// Forward declaration to avoid including the full handler header.
+class Pca9685PwmAdapter;
+
+/**
+ * @brief Per-channel servo limits.
+ *
+ * A limit of 0 means "unlimited". Pulse widths are in microseconds.
+ */
+struct Pca9685ServoConfig {
+    uint16_t min_pulse_us = 500;          ///< Lowest commandable pulse width.
+    uint16_t max_pulse_us = 2500;         ///< Highest commandable pulse width.
+    uint32_t max_velocity_us_per_s = 0;   ///< Pulse-width slew limit (0 = unlimited).
+    uint32_t max_accel_us_per_s2 = 0;     ///< Slew acceleration limit (0 = velocity-only).
+};
+
+/**
+ * @brief Frame timing statistics collected by Pca9685ServoTrajectory.
+ *
+ * Jitter is the deviation of the measured interval between frame starts from
+ * the nominal frame period. Compute time covers the kinematics only; frame time
+ * additionally includes the I2C burst.
+ */
+struct Pca9685TrajectoryStats {
+    uint32_t frame_count = 0;       ///< Frames run.
+    uint32_t write_failures = 0;    ///< Frames whose burst write failed.
+    uint32_t last_jitter_us = 0;    ///< Jitter of the most recent frame.
+    uint32_t max_jitter_us = 0;     ///< Worst observed jitter.
+    uint64_t total_jitter_us = 0;   ///< Sum of jitter (for averaging).
+    uint32_t last_compute_us = 0;   ///< Kinematics time of the most recent frame.
+    uint32_t max_compute_us = 0;    ///< Worst kinematics time.
+    uint32_t last_frame_us = 0;     ///< Total time of the most recent frame.
+    uint32_t max_frame_us = 0;      ///< Worst total frame time.
+    uint64_t total_frame_us = 0;    ///< Sum of frame times (for averaging).
+};
+
+/**
+ * @class Pca9685ServoTrajectory
+ * @brief Interpolates up to 16 servo channels and pushes one burst per frame.
+ *
+ * @details
+ * Positions are kept as Q16.16 microseconds, velocities as Q16.16 microseconds
+ * per frame. Per-frame velocity and acceleration steps are precomputed whenever
+ * the frame period or a channel's limits change, so RunFrame() uses integer
+ * arithmetic only.
+ *
+ * Frames can be driven by the built-in PeriodicTimer (Start()/Stop()) or by
+ * calling RunFrame() from an application task at a fixed rate after
+ * SetFramePeriodUs().
+ *
+ * @note All methods are thread-safe; RunFrame() and the setters share one mutex.
+ */
+class Pca9685ServoTrajectory {
+public:
+    /** @brief Number of servo channels (one per PCA9685 output). */
+    static constexpr uint8_t kMaxChannels = 16;
+
+    /** @brief Highest accepted pulse width (keeps Q16.16 positions in int32). */
+    static constexpr uint16_t kMaxPulseUs = 20000;
+
+    /** @brief Default frame period (50 Hz, one servo PWM period). */
+    static constexpr uint32_t kDefaultFramePeriodUs = 20000;
+
+    /**
+     * @brief Construct the engine.
+     * @param pwm PCA9685 PWM adapter. Must outlive the engine.
+     */
+    explicit Pca9685ServoTrajectory(Pca9685PwmAdapter& pwm) noexcept;
+
+    /** @brief Destructor. Stops the frame timer and restores the adapter's deferred-update mode. */
+    ~Pca9685ServoTrajectory() noexcept;
+
+    /// Non-copyable.
+    Pca9685ServoTrajectory(const Pca9685ServoTrajectory&) = delete;
+    /// Non-copyable.
+    Pca9685ServoTrajectory& operator=(const Pca9685ServoTrajectory&) = delete;
+
+    /// Non-movable.
+    Pca9685ServoTrajectory(Pca9685ServoTrajectory&&) = delete;
+    /// Non-movable.
+    Pca9685ServoTrajectory& operator=(Pca9685ServoTrajectory&&) = delete;
+
+    /// @name Channel Configuration
+    /// @{
+
+    /**
+     * @brief Enable a channel under trajectory control with the given limits.
+     *
+     * The channel does not move until its position is known: call
+     * SetPosition() or SetTarget() (the first target snaps immediately).
+     *
+     * @param channel Channel (0-15).
+     * @param config  Pulse range and motion limits.
+     * @return PWM_SUCCESS, PWM_ERR_INVALID_CHANNEL, or PWM_ERR_INVALID_PARAMETER
+     *         for an empty or out-of-range pulse window.
+     */
+    hf_pwm_err_t ConfigureChannel(uint8_t channel, const Pca9685ServoConfig& config) noexcept;
+
+    /**
+     * @brief Release a channel from trajectory control (its output is left as is).
+     * @param channel Channel (0-15).
+     * @return PWM_SUCCESS or PWM_ERR_INVALID_CHANNEL.
+     */
+    hf_pwm_err_t ReleaseChannel(uint8_t channel) noexcept;
+
+    /**
+     * @brief Set the pulse width to move towards (clamped to the channel window).
+     * @param channel  Configured channel (0-15).
+     * @param pulse_us Target pulse width in microseconds.
+     * @return PWM_SUCCESS, PWM_ERR_INVALID_CHANNEL, or PWM_ERR_NOT_INITIALIZED
+     *         if the channel is not configured.
+     */
+    hf_pwm_err_t SetTarget(uint8_t channel, uint16_t pulse_us) noexcept;
+
+    /**
+     * @brief Jump to a pulse width on the next frame (no ramp, velocity reset).
+     * @param channel  Configured channel (0-15).
+     * @param pulse_us Pulse width in microseconds (clamped to the channel window).
+     * @return Same as SetTarget().
+     */
+    hf_pwm_err_t SetPosition(uint8_t channel, uint16_t pulse_us) noexcept;
+
+    /** @brief Current commanded pulse width in microseconds (0 if unknown). */
+    uint16_t GetPosition(uint8_t channel) const noexcept;
+
+    /** @brief Check if a channel has not yet settled on its target. */
+    bool IsMoving(uint8_t channel) const noexcept;
+
+    /** @brief Check if any configured channel is still moving. */
+    bool IsAnyMoving() const noexcept;
+
+    /// @}
+
+    /// @name Frame Scheduling
+    /// @{
+
+    /**
+     * @brief Set the frame period used for the motion math (manual RunFrame() mode).
+     * @param period_us Frame period in microseconds (> 0).
+     * @return PWM_SUCCESS, PWM_ERR_INVALID_PARAMETER, or PWM_ERR_INVALID_STATE
+     *         while the frame timer is running.
+     */
+    hf_pwm_err_t SetFramePeriodUs(uint32_t period_us) noexcept;
+
+    /**
+     * @brief Advance every channel by one frame and push all outputs in one burst.
+     *
+     * Switches the adapter to deferred updates; the mode it had before the
+     * first frame is restored by Stop().
+     * @return PWM_SUCCESS or the adapter's UpdateAll() error.
+     */
+    hf_pwm_err_t RunFrame() noexcept;
+
+    /**
+     * @brief Start periodic frames on a PeriodicTimer.
+     * @param frame_hz Frame rate (1-1000 Hz; the period is rounded to whole ms).
+     * @return PWM_SUCCESS, PWM_ERR_INVALID_PARAMETER, PWM_ERR_INVALID_STATE if
+     *         already running, or PWM_ERR_OUT_OF_MEMORY if no timer slot is free.
+     */
+    hf_pwm_err_t Start(uint32_t frame_hz = 1000000 / kDefaultFramePeriodUs) noexcept;
+
+    /**
+     * @brief Stop periodic frames and restore the adapter's deferred-update mode.
+     *
+     * Waits for a frame already running on the timer task to finish, so
+     * must not be called from RunFrame()'s context. Also ends manual
+     * RunFrame() mode: the next frame switches deferred updates on again.
+     * @return PWM_SUCCESS, or the adapter's error when restoring immediate
+     *         updates fails to flush.
+     */
+    hf_pwm_err_t Stop() noexcept;
+
+    /** @brief Check if the frame timer is running. */
+    bool IsRunning() const noexcept;
+
+    /// @}
+
+    /// @name Statistics
+    /// @{
+
+    /** @brief Get a copy of the frame timing statistics. */
+    Pca9685TrajectoryStats GetStats() const noexcept;
+
+    /** @brief Reset the frame timing statistics. */
+    void ResetStats() noexcept;
+
+    /** @brief Log channel state and frame statistics at INFO level. */
+    void DumpDiagnostics() const noexcept;
+
+    /// @}
+
+    /// @name Fixed-Point Kinematics (hardware-free)
+    /// @{
+
+    /**
+     * @brief Advance one axis by one frame.
+     * @param[in,out] position_q16 Position, Q16.16 microseconds.
+     * @param[in,out] velocity_q16 Velocity, Q16.16 microseconds per frame.
+     * @param target_q16     Target position, Q16.16 microseconds.
+     * @param max_step_q16   Velocity limit per frame (<= 0 = unlimited).
+     * @param accel_step_q16 Velocity change limit per frame (<= 0 = velocity-only).
+     */
+    static void StepAxis(int32_t& position_q16, int32_t& velocity_q16, int32_t target_q16,
+                         int32_t max_step_q16, int32_t accel_step_q16) noexcept;
+
+    /**
+     * @brief Convert a Q16.16 pulse width to a 12-bit PCA9685 off tick.
+     * @param pulse_q16    Pulse width, Q16.16 microseconds.
+     * @param frequency_hz PWM frequency.
+     * @return Tick count (0-4095, rounded and clamped).
+     */
+    static uint16_t PulseToTicks(int32_t pulse_q16, uint32_t frequency_hz) noexcept;
+
+    /// @}
+
+private:
+    /** @brief Motion state of one channel. */
+    struct Channel {
+        Pca9685ServoConfig config{};
+        int32_t position_q16 = 0;     ///< Current commanded position.
+        int32_t velocity_q16 = 0;     ///< Signed velocity per frame.
+        int32_t target_q16 = 0;       ///< Target position.
+        int32_t max_step_q16 = 0;     ///< Velocity limit per frame (0 = unlimited).
+        int32_t accel_step_q16 = 0;   ///< Acceleration limit per frame (0 = none).
+        uint16_t last_ticks = 0xFFFF; ///< Last tick value staged (0xFFFF = none).
+        bool enabled = false;         ///< Under trajectory control.
+        bool has_position = false;    ///< Position known (SetPosition / first target).
+    };
+
+    /** @brief Recompute per-frame limits for one channel (mutex held). */
+    void updateStepsLocked(Channel& channel) const noexcept;
+
+    /** @brief Clamp a pulse width to the channel window and convert to Q16.16. */
+    static int32_t clampPulseQ16(const Channel& channel, uint16_t pulse_us) noexcept;
+
+    /** @brief Remember the adapter's deferred-update mode before the first frame (mutex held). */
+    void captureDeferredStateLocked() noexcept;
+
+    /**
+     * @brief Static callback for the frame timer.
+     * @param arg Registered context ID.
+     */
+    static void FrameTimerCallback(uint32_t arg);
+
+    /// @name Timer Context Registry
+    /// @brief Maps PeriodicTimer uint32_t arguments back to engine instances.
+    /// @{
+    static uint32_t RegisterTimerContext(Pca9685ServoTrajectory* engine) noexcept;
+    static void UnregisterTimerContext(uint32_t context_id) noexcept;
+    /** @brief Look up an engine and count a frame in flight on it (released by FrameTimerCallback). */
+    static Pca9685ServoTrajectory* ResolveTimerContext(uint32_t context_id) noexcept;
+
+    static constexpr uint32_t kTimerContextSlots = 4;
+    static RtosMutex timer_registry_mutex_;
+    static std::array<Pca9685ServoTrajectory*, kTimerContextSlots> timer_registry_;
+    /// @}
+
+    Pca9685PwmAdapter& pwm_;                          ///< Output adapter (not owned).
+    std::array<Channel, kMaxChannels> channels_{};   ///< Per-channel motion state.
+    uint32_t frame_period_us_ = kDefaultFramePeriodUs; ///< Nominal frame period.
+    uint64_t last_frame_start_us_ = 0;               ///< Start of previous frame (0 = none).
+    Pca9685TrajectoryStats stats_{};                 ///< Frame timing statistics.
+    PeriodicTimer frame_timer_;                      ///< Frame scheduler.
+    uint32_t timer_context_id_ = 0;                  ///< Timer context ID (0 = not running).
+    std::atomic<uint32_t> frames_in_flight_{0};      ///< Timer callbacks running RunFrame().
+    bool prior_deferred_ = false;                    ///< Adapter mode before the first frame.
+    bool deferred_captured_ = false;                 ///< prior_deferred_ is valid.
+    mutable RtosMutex mutex_;                        ///< Protects channels and statistics.
+};
+
+#endif // COMPONENT_HANDLER_PCA9685_SERVO_TRAJECTORY_H_
@@ -86,7 +86,6 @@ Pcal95555Handler::Pcal95555Handler(BaseI2c& i2c_device,
       initialized_(false),
       interrupt_pin_(interrupt_pin),
       interrupt_configured_(false) {
-    pin_registry_.fill(nullptr);
     pull_mode_cache_.fill(hf_gpio_pull_mode_t::HF_GPIO_PULL_MODE_FLOATING);
 }
 
@@ -177,6 +176,11 @@ hf_gpio_err_t Pcal95555Handler::Initialize() noexcept {
         // If read fails, cache stays at default (FLOATING) -- non-fatal.
     }
 
+    // A shared-INT aggregator needs the mask state to skip idle expanders.
+    if (shared_interrupt_attached_) {
+        seedInterruptMaskLocked();
+    }
+
     initialized_ = true;
     return hf_gpio_err_t::GPIO_SUCCESS;
 }
@@ -193,9 +197,12 @@ hf_gpio_err_t Pcal95555Handler::Deinitialize() noexcept {
             hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_NONE);
         interrupt_configured_ = false;
     }
+    unmasked_interrupt_pins_ = 0;
+    interrupt_mask_known_ = false;
 
-    // Clear pin registry (handler_mutex_ already held by caller).
-    pin_registry_.fill(nullptr);
+    // Release pin wrappers (handler_mutex_ already held by caller). Owning
+    // handles held elsewhere keep their wrapper alive; pooled ones dangle.
+    pin_registry_.Clear();
 
     // Release driver and adapter.
     pcal95555_driver_.reset();
@@ -393,13 +400,17 @@ hf_gpio_err_t Pcal95555Handler::GetAllInterruptMasks(uint16_t& mask) noexcept {
         return hf_gpio_err_t::GPIO_ERR_UNSUPPORTED_OPERATION;
     }
 
-    // The driver doesn't expose a GetInterruptMask() getter.
-    // Default: report all masked. Handler-level callers should track
-    // which pins have been enabled via ConfigureInterrupt().
-    mask = 0xFFFF;
+    // The driver has no mask readback; this is the mask the handler last wrote.
+    // Before the first write that is the power-on state (every pin masked).
+    mask = static_cast<uint16_t>(~unmasked_interrupt_pins_);
     return hf_gpio_err_t::GPIO_SUCCESS;
 }
 
+bool Pcal95555Handler::IsInterruptMaskKnown() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return pcal95555_driver_ && pcal95555_driver_->HasAgileIO() && interrupt_mask_known_;
+}
+
 hf_gpio_err_t Pcal95555Handler::GetAllInterruptStatus(uint16_t& status) noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!EnsureInitializedLocked()) return hf_gpio_err_t::GPIO_ERR_NOT_INITIALIZED;
@@ -427,12 +438,13 @@ hf_gpio_err_t Pcal95555Handler::RegisterPinInterrupt(
         return hf_gpio_err_t::GPIO_ERR_NOT_INITIALIZED;
     }
 
-    // Callback-based interrupt dispatch requires a wired hardware INT pin.
-    if (!interrupt_pin_) {
+    // Callback-based interrupt dispatch requires a wired hardware INT pin,
+    // either dedicated or shared through a Pcal95555InterruptAggregator.
+    if (!HasInterruptSupport()) {
         return hf_gpio_err_t::GPIO_ERR_UNSUPPORTED_OPERATION;
     }
 
-    auto& gpio_pin = pin_registry_[pin];
+    Pcal95555GpioPin* gpio_pin = pin_registry_.Get(pin);
     if (!gpio_pin) return hf_gpio_err_t::GPIO_ERR_PIN_NOT_FOUND;
 
     // Store interrupt data in the pin object.
@@ -453,8 +465,12 @@ hf_gpio_err_t Pcal95555Handler::RegisterPinInterrupt(
         }
     }
 
-    // Enable interrupt for this pin in the driver (unmask it).
+    // Enable interrupt for this pin in the driver (unmask it). The first mask
+    // write also masks every pin the handler has not enabled, so the shadow is
+    // known from here on.
+    seedInterruptMaskLocked();
     if (!pcal95555_driver_->ConfigureInterrupt(pin, InterruptState::Enabled)) {
+        interrupt_mask_known_ = false;  // The write may or may not have landed.
         // Roll back pin callback state when driver-side configuration fails.
         gpio_pin->interrupt_callback_ = nullptr;
         gpio_pin->interrupt_user_data_ = nullptr;
@@ -466,6 +482,7 @@ hf_gpio_err_t Pcal95555Handler::RegisterPinInterrupt(
                    ? hf_gpio_err_t::GPIO_ERR_FAILURE
                    : hf_gpio_err_t::GPIO_ERR_UNSUPPORTED_OPERATION;
     }
+    unmasked_interrupt_pins_ |= static_cast<uint16_t>(1U << pin);
 
     return hf_gpio_err_t::GPIO_SUCCESS;
 }
@@ -475,7 +492,7 @@ hf_gpio_err_t Pcal95555Handler::UnregisterPinInterrupt(hf_pin_num_t pin) noexcep
 
     MutexLockGuard lock(handler_mutex_);
 
-    auto& gpio_pin = pin_registry_[pin];
+    Pcal95555GpioPin* gpio_pin = pin_registry_.Get(pin);
     if (!gpio_pin) return hf_gpio_err_t::GPIO_ERR_PIN_NOT_FOUND;
 
     // Clear interrupt data.
@@ -487,11 +504,14 @@ hf_gpio_err_t Pcal95555Handler::UnregisterPinInterrupt(hf_pin_num_t pin) noexcep
 
     // Mask interrupt for this pin in the driver.
     if (pcal95555_driver_) {
+        seedInterruptMaskLocked();
         if (!pcal95555_driver_->ConfigureInterrupt(pin, InterruptState::Disabled)) {
+            interrupt_mask_known_ = false;
             return pcal95555_driver_->HasAgileIO()
                        ? hf_gpio_err_t::GPIO_ERR_FAILURE
                        : hf_gpio_err_t::GPIO_ERR_UNSUPPORTED_OPERATION;
         }
+        unmasked_interrupt_pins_ &= static_cast<uint16_t>(~(1U << pin));
     }
 
     return hf_gpio_err_t::GPIO_SUCCESS;
@@ -533,12 +553,12 @@ bool Pcal95555Handler::DrainPendingInterrupts() noexcept {
     return true;
 }
 
-void Pcal95555Handler::ProcessInterrupts() noexcept {
-    if (!pcal95555_driver_) return;
+uint16_t Pcal95555Handler::ProcessInterrupts() noexcept {
+    if (!pcal95555_driver_) return 0;
 
     // Read interrupt status (this clears the interrupt condition on the chip).
     uint16_t status = pcal95555_driver_->GetInterruptStatus();
-    if (status == 0) return;
+    if (status == 0) return 0;
 
     // Read current pin input levels for edge detection.
     uint16_t current_state = pcal95555_driver_->ReadAllInputs();
@@ -554,7 +574,7 @@ void Pcal95555Handler::ProcessInterrupts() noexcept {
     for (int pin = 0; pin < 16; ++pin) {
         if (!(status & (1U << pin))) continue;
 
-        auto& gpio_pin = pin_registry_[pin];
+        Pcal95555GpioPin* gpio_pin = pin_registry_.Get(pin);
         if (!gpio_pin || !gpio_pin->interrupt_enabled_ ||
             !gpio_pin->interrupt_callback_) {
             continue;
@@ -585,14 +605,76 @@ void Pcal95555Handler::ProcessInterrupts() noexcept {
                     ? hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_RISING_EDGE
                     : hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_FALLING_EDGE;
             gpio_pin->interrupt_callback_(
-                gpio_pin.get(), actual, gpio_pin->interrupt_user_data_);
+                gpio_pin, actual, gpio_pin->interrupt_user_data_);
+        }
+    }
+    return status;
+}
+
+// =====================================================================
+// Pcal95555Handler -- Shared-INT Aggregator Hooks
+// =====================================================================
+
+hf_gpio_err_t Pcal95555Handler::AttachSharedInterrupt() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    // A dedicated INT pin and a shared line are mutually exclusive.
+    if (interrupt_pin_ != nullptr) {
+        return hf_gpio_err_t::GPIO_ERR_INVALID_PARAMETER;
+    }
+    shared_interrupt_attached_ = true;
+    if (initialized_) {
+        seedInterruptMaskLocked();
+    }
+    return hf_gpio_err_t::GPIO_SUCCESS;
+}
+
+void Pcal95555Handler::DetachSharedInterrupt() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    shared_interrupt_attached_ = false;
+}
+
+bool Pcal95555Handler::IsInterruptSourceIdle() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!pcal95555_driver_) return true;
+    return pcal95555_driver_->HasAgileIO() && interrupt_mask_known_ &&
+           unmasked_interrupt_pins_ == 0;
+}
+
+uint16_t Pcal95555Handler::ServiceSharedInterrupt() noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (!initialized_) return 0;
+    return ProcessInterrupts();
+}
+
+bool Pcal95555Handler::seedInterruptMaskLocked() noexcept {
+    if (interrupt_mask_known_) return true;
+    if (!pcal95555_driver_ || !pcal95555_driver_->HasAgileIO()) return false;
+
+    // The driver has no mask readback, and the chip may have kept unmasked
+    // pins across an MCU reset (or direct driver access may have changed
+    // them): write the whole mask in one driver call, leaving unmasked only
+    // the pins the handler itself enabled. If the write fails the shadow
+    // stays unknown (never "idle").
+    uint16_t unmasked = unmasked_interrupt_pins_;
+    for (uint8_t pin = 0; pin < 16; ++pin) {
+        const Pcal95555GpioPin* gpio_pin = pin_registry_.Get(pin);
+        if (gpio_pin && gpio_pin->interrupt_enabled_) {
+            unmasked |= static_cast<uint16_t>(1U << pin);
         }
     }
+    if (!pcal95555_driver_->ConfigureInterruptMask(static_cast<uint16_t>(~unmasked))) {
+        return false;
+    }
+    unmasked_interrupt_pins_ = unmasked;
+    interrupt_mask_known_ = true;
+    return true;
 }
 
 Pcal95555Handler::Pcal95555Driver* Pcal95555Handler::GetDriver() noexcept {
     MutexLockGuard lock(handler_mutex_);
     if (!EnsureInitializedLocked()) return nullptr;
+    // Direct register access may change the interrupt mask behind the shadow.
+    interrupt_mask_known_ = false;
     return pcal95555_driver_.get();
 }
 
@@ -609,7 +691,7 @@ uint8_t Pcal95555Handler::GetI2cAddress() const noexcept {
     return pcal95555_driver_ ? pcal95555_driver_->GetAddress() : 0;
 }
 
-std::shared_ptr<BaseGpio> Pcal95555Handler::CreateGpioPin(
+Pcal95555GpioPin* Pcal95555Handler::CreateGpioPinRef(
     hf_pin_num_t pin,
     hf_gpio_direction_t direction,
     hf_gpio_active_state_t active_state,
@@ -622,41 +704,63 @@ std::shared_ptr<BaseGpio> Pcal95555Handler::CreateGpioPin(
     if (!EnsureInitializedLocked()) return nullptr;
 
     // Check if pin already exists.
-    if (pin_registry_[pin] != nullptr) {
-        return allow_existing
-                   ? std::static_pointer_cast<BaseGpio>(pin_registry_[pin])
-                   : nullptr;
+    if (Pcal95555GpioPin* existing = pin_registry_.Get(pin)) {
+        return allow_existing ? existing : nullptr;
     }
 
-    // Create a new Pcal95555GpioPin with handler reference (not driver pointer).
-    auto new_pin = std::make_shared<Pcal95555GpioPin>(
-        pin, this, direction, active_state, output_mode, pull_mode);
-
+    // Create the pin with handler reference (not driver pointer).
+    Pcal95555GpioPin* new_pin = pin_registry_.Emplace(
+        pin, pin, this, direction, active_state, output_mode, pull_mode);
     if (new_pin && new_pin->Initialize()) {
-        pin_registry_[pin] = new_pin;
         return new_pin;
     }
 
+    pin_registry_.Reset(pin);
     return nullptr;
 }
 
+Pcal95555GpioPin* Pcal95555Handler::GetGpioPinRef(hf_pin_num_t pin) noexcept {
+    if (pin >= 16) return nullptr;
+    MutexLockGuard lock(handler_mutex_);
+    return pin_registry_.Get(pin);
+}
+
+std::shared_ptr<BaseGpio> Pcal95555Handler::CreateGpioPin(
+    hf_pin_num_t pin,
+    hf_gpio_direction_t direction,
+    hf_gpio_active_state_t active_state,
+    hf_gpio_output_mode_t output_mode,
+    hf_gpio_pull_mode_t pull_mode,
+    bool allow_existing) noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    if (CreateGpioPinRef(pin, direction, active_state, output_mode, pull_mode, allow_existing) == nullptr) {
+        return nullptr;
+    }
+    return pin_registry_.Share(pin);
+}
+
 std::shared_ptr<BaseGpio> Pcal95555Handler::GetGpioPin(hf_pin_num_t pin) noexcept {
     if (pin >= 16) return nullptr;
     MutexLockGuard lock(handler_mutex_);
-    return pin_registry_[pin];
+    return pin_registry_.Share(pin);
+}
+
+uint32_t Pcal95555Handler::GetPinHeapAllocations() const noexcept {
+    MutexLockGuard lock(handler_mutex_);
+    return pin_registry_.GetHeapAllocations();
 }
 
 bool Pcal95555Handler::IsPinCreated(hf_pin_num_t pin) const noexcept {
     if (pin >= 16) return false;
     MutexLockGuard lock(handler_mutex_);
-    return pin_registry_[pin] != nullptr;
+    return pin_registry_.Has(pin);
 }
 
 uint16_t Pcal95555Handler::GetCreatedPinMask() const noexcept {
     MutexLockGuard lock(handler_mutex_);
     uint16_t mask = 0;
     for (hf_pin_num_t i = 0; i < 16; ++i) {
-        if (pin_registry_[i] != nullptr) {
+        if (pin_registry_.Has(i)) {
             mask |= (1U << i);
         }
     }
@@ -694,9 +798,17 @@ hf_gpio_err_t Pcal95555Handler::SetInterruptMask(hf_pin_num_t pin, bool mask) no
     if (!EnsureInitializedLocked()) return hf_gpio_err_t::GPIO_ERR_NOT_INITIALIZED;
 
     InterruptState state = mask ? InterruptState::Disabled : InterruptState::Enabled;
-    return pcal95555_driver_->ConfigureInterrupt(pin, state)
-               ? hf_gpio_err_t::GPIO_SUCCESS
-               : hf_gpio_err_t::GPIO_ERR_COMMUNICATION_FAILURE;
+    seedInterruptMaskLocked();
+    if (!pcal95555_driver_->ConfigureInterrupt(pin, state)) {
+        interrupt_mask_known_ = false;
+        return hf_gpio_err_t::GPIO_ERR_COMMUNICATION_FAILURE;
+    }
+    if (mask) {
+        unmasked_interrupt_pins_ &= static_cast<uint16_t>(~(1U << pin));
+    } else {
+        unmasked_interrupt_pins_ |= static_cast<uint16_t>(1U << pin);
+    }
+    return hf_gpio_err_t::GPIO_SUCCESS;
 }
 
 hf_gpio_err_t Pcal95555Handler::GetInterruptStatus(hf_pin_num_t pin, bool& status) noexcept {
@@ -746,6 +858,7 @@ hf_gpio_err_t Pcal95555Handler::ResetToDefault() noexcept {
 
     pcal95555_driver_->ResetToDefault();  // void return
     pull_mode_cache_.fill(hf_gpio_pull_mode_t::HF_GPIO_PULL_MODE_FLOATING);
+    unmasked_interrupt_pins_ = 0;  // Power-on default masks every pin.
     return hf_gpio_err_t::GPIO_SUCCESS;
 }
 
@@ -814,15 +927,16 @@ void Pcal95555Handler::DumpDiagnostics() const noexcept {
     Logger::GetInstance().Info(TAG, "Pin Registry:");
     int active_pins = 0;
     int interrupt_pins = 0;
-    for (size_t i = 0; i < pin_registry_.size(); ++i) {
-        if (pin_registry_[i] != nullptr) {
+    for (size_t i = 0; i < pin_registry_.kSize; ++i) {
+        if (const Pcal95555GpioPin* gpio_pin = pin_registry_.Get(i)) {
             active_pins++;
-            if (pin_registry_[i]->interrupt_enabled_) {
+            if (gpio_pin->interrupt_enabled_) {
                 interrupt_pins++;
             }
         }
     }
-    Logger::GetInstance().Info(TAG, "  Active Pin Objects: %d/16", active_pins);
+    Logger::GetInstance().Info(TAG, "  Active Pin Objects: %d/16 (%s)", active_pins,
+                              IsPinPoolEnabled() ? "inline pool" : "heap-owned");
     Logger::GetInstance().Info(TAG, "  Pins with Interrupts: %d", interrupt_pins);
 
     // Interrupt Configuration
@@ -831,16 +945,21 @@ void Pcal95555Handler::DumpDiagnostics() const noexcept {
                               interrupt_pin_ ? "CONFIGURED" : "NOT_CONFIGURED");
     Logger::GetInstance().Info(TAG, "  Interrupt System: %s",
                               interrupt_configured_ ? "ENABLED" : "DISABLED");
+    Logger::GetInstance().Info(TAG, "  Shared INT Aggregator: %s",
+                              shared_interrupt_attached_ ? "ATTACHED" : "NONE");
+    Logger::GetInstance().Info(TAG, "  Unmasked Pins: 0x%04X",
+                              unmasked_interrupt_pins_);
 
     // Active Pin Details
     Logger::GetInstance().Info(TAG, "Active Pin Details:");
     int shown = 0;
-    for (size_t i = 0; i < pin_registry_.size(); ++i) {
-        if (!pin_registry_[i]) continue;
+    for (size_t i = 0; i < pin_registry_.kSize; ++i) {
+        const Pcal95555GpioPin* gpio_pin = pin_registry_.Get(i);
+        if (!gpio_pin) continue;
         ++shown;
 
         const char* trigger_str = "NONE";
-        auto t = pin_registry_[i]->interrupt_trigger_;
+        auto t = gpio_pin->interrupt_trigger_;
         if (t == hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_RISING_EDGE) {
             trigger_str = "RISING";
         } else if (t == hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_FALLING_EDGE) {
@@ -852,7 +971,7 @@ void Pcal95555Handler::DumpDiagnostics() const noexcept {
         Logger::GetInstance().Info(
             TAG, "  Pin %d: Int=%s Trigger=%s",
             static_cast<int>(i),
-            pin_registry_[i]->interrupt_enabled_ ? "ON" : "OFF",
+            gpio_pin->interrupt_enabled_ ? "ON" : "OFF",
             trigger_str);
     }
     if (shown == 0) {
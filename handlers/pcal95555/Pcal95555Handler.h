@@ -39,10 +39,13 @@
  * The handler owns all its internal resources:
  * - One HalI2cPcal95555Comm (I2C communication adapter)
  * - One typed pcal95555::PCAL95555<HalI2cPcal95555Comm> driver instance
- * - Up to 16 Pcal95555GpioPin wrappers (created on demand via pin registry)
+ * - Up to 16 Pcal95555GpioPin wrappers (created on demand in a GpioPinRegistry)
  *
  * External managers (GpioManager) obtain shared_ptr<BaseGpio> references to
- * pins via CreateGpioPin(). The handler and pin registry co-own the pin objects.
+ * pins via CreateGpioPin(). By default the handler and pin registry co-own the
+ * pin objects. Builds with HF_CORE_EXPANDER_PIN_POOL=ON instead construct the
+ * wrappers in an inline pool (no heap allocation); the shared_ptr handles are
+ * then non-owning and valid only until EnsureDeinitialized() or handler destruction.
  *
  * ## Initialization Sequence
  *
@@ -91,6 +94,7 @@
 #include "base/BaseI2c.h"
 #include "core/hf-core-drivers/external/hf-pcal95555-driver/inc/pcal95555.hpp"
 #include "RtosMutex.h"
+#include "handlers/common/GpioPinRegistry.h"
 
 // Forward declarations
 class Pcal95555Handler;
@@ -220,8 +224,8 @@ private:
  * - Polarity inversion
  * - Interrupt configuration (delegates to handler for centralized management)
  *
- * @note Pin instances are created via Pcal95555Handler::CreateGpioPin() and
- *       stored in the handler's pin registry as shared_ptr.
+ * @note Pin instances are created via Pcal95555Handler::CreateGpioPin() or
+ *       CreateGpioPinRef() and stored in the handler's pin registry.
  */
 class Pcal95555GpioPin : public BaseGpio {
 public:
@@ -394,9 +398,10 @@ private:
  *   not in the constructor. The driver itself also uses lazy initialization
  *   (auto-detecting chip variant on first I2C access).
  *
- * - **Pin factory pattern**: Pins are created on demand via CreateGpioPin() and
- *   stored in a shared_ptr registry. Multiple calls for the same pin return the
- *   same instance.
+ * - **Pin factory pattern**: Pins are created on demand via CreateGpioPin() /
+ *   CreateGpioPinRef() and stored in a shared_ptr registry, or in a fixed
+ *   16-slot inline pool with HF_CORE_EXPANDER_PIN_POOL=ON. Multiple calls for the
+ *   same pin return the same instance.
  *
  * - **Chip variant awareness**: After initialization, HasAgileIO() reports
  *   whether PCAL9555A features (pull resistors, drive strength, interrupts,
@@ -589,9 +594,18 @@ public:
 
     /**
      * @brief Check if hardware interrupt support is available.
-     * @return true if an interrupt pin was provided at construction.
+     * @return true if an interrupt pin was provided at construction, or the
+     *         handler is attached to a Pcal95555InterruptAggregator.
      */
-    bool HasInterruptSupport() const noexcept { return interrupt_pin_ != nullptr; }
+    bool HasInterruptSupport() const noexcept {
+        return interrupt_pin_ != nullptr || shared_interrupt_attached_;
+    }
+
+    /**
+     * @brief Check if this handler is serviced by a shared-INT aggregator.
+     * @return true if registered with a Pcal95555InterruptAggregator.
+     */
+    bool IsSharedInterruptAttached() const noexcept { return shared_interrupt_attached_; }
 
     /**
      * @brief Check if hardware interrupt is configured and enabled.
@@ -613,11 +627,27 @@ public:
     /**
      * @brief Get the interrupt mask for all 16 pins.
      * @param[out] mask 16-bit mask (0=enabled, 1=masked per PCAL9555A convention).
-     * @return GPIO_SUCCESS or error code.
-     * @note Requires PCAL9555A.
+     * @return GPIO_SUCCESS, or GPIO_ERR_UNSUPPORTED_OPERATION on PCA9555.
+     * @note Requires PCAL9555A. The driver has no readback: the mask is the
+     *       handler's write-through shadow, 0xFFFF (the power-on state) until
+     *       the first mask write. Use IsInterruptMaskKnown() to tell whether
+     *       the chip is known to match it.
      */
     hf_gpio_err_t GetAllInterruptMasks(uint16_t& mask) noexcept;
 
+    /**
+     * @brief Whether the chip's interrupt mask is known to match GetAllInterruptMasks().
+     *
+     * The mask is seeded (one write covering every pin, unmasking only the
+     * pins the handler enabled) by the first per-pin mask change, or on
+     * initialization while the handler is registered with a
+     * Pcal95555InterruptAggregator. It is unknown before that, after a
+     * failed mask write and after GetDriver(), until the next mask change.
+     *
+     * @return true on a PCAL9555A whose mask shadow is known.
+     */
+    [[nodiscard]] bool IsInterruptMaskKnown() const noexcept;
+
     /**
      * @brief Get the interrupt status for all 16 pins.
      *
@@ -647,12 +677,46 @@ public:
     uint8_t GetI2cAddress() const noexcept;
 
     /**
-     * @brief Create or retrieve an existing BaseGpio pin wrapper.
+     * @brief Create or retrieve an existing pin wrapper (non-owning handle).
      *
      * If a wrapper for the given pin already exists in the registry and
      * allow_existing is true, the existing instance is returned. Otherwise
      * a new Pcal95555GpioPin is created, initialized, and registered.
      *
+     * The returned pointer does no reference counting and is valid until
+     * EnsureDeinitialized() or destruction of the handler.
+     *
+     * @param pin            Pin number (0-15).
+     * @param direction      Initial direction (ignored if pin exists).
+     * @param active_state   Active polarity (ignored if pin exists).
+     * @param output_mode    Output mode (ignored if pin exists).
+     * @param pull_mode      Pull resistor mode (ignored if pin exists).
+     * @param allow_existing If true, returns existing pin; if false, fails if exists.
+     * @return Pointer to the pin wrapper, or nullptr on failure.
+     */
+    Pcal95555GpioPin* CreateGpioPinRef(
+        hf_pin_num_t pin,
+        hf_gpio_direction_t direction = hf_gpio_direction_t::HF_GPIO_DIRECTION_INPUT,
+        hf_gpio_active_state_t active_state = hf_gpio_active_state_t::HF_GPIO_ACTIVE_HIGH,
+        hf_gpio_output_mode_t output_mode = hf_gpio_output_mode_t::HF_GPIO_OUTPUT_MODE_PUSH_PULL,
+        hf_gpio_pull_mode_t pull_mode = hf_gpio_pull_mode_t::HF_GPIO_PULL_MODE_FLOATING,
+        bool allow_existing = true) noexcept;
+
+    /**
+     * @brief Get an existing pin wrapper by number (non-owning handle).
+     * @param pin Pin number (0-15).
+     * @return Pointer to the pin wrapper, or nullptr if pin not created.
+     */
+    Pcal95555GpioPin* GetGpioPinRef(hf_pin_num_t pin) noexcept;
+
+    /**
+     * @brief Create or retrieve an existing BaseGpio pin wrapper.
+     *
+     * Same as CreateGpioPinRef(), returning a shared_ptr. By default it
+     * co-owns the wrapper. With the pin pool enabled it is a non-owning
+     * handle without a control block (copies do no atomic reference
+     * counting) that must not outlive the handler or an EnsureDeinitialized() call.
+     *
      * @param pin            Pin number (0-15).
      * @param direction      Initial direction (ignored if pin exists).
      * @param active_state   Active polarity (ignored if pin exists).
@@ -672,10 +736,22 @@ public:
     /**
      * @brief Get an existing GPIO pin wrapper by number.
      * @param pin Pin number (0-15).
-     * @return shared_ptr<BaseGpio> or nullptr if pin not created.
+     * @return shared_ptr<BaseGpio> (non-owning with the pin pool enabled) or nullptr if pin not created.
      */
     std::shared_ptr<BaseGpio> GetGpioPin(hf_pin_num_t pin) noexcept;
 
+    /**
+     * @brief Whether pin wrappers are constructed in an inline pool (build option
+     *        HF_CORE_EXPANDER_PIN_POOL) instead of on the heap.
+     *
+     * Pooled wrappers cost no heap allocation, but CreateGpioPin() / GetGpioPin()
+     * then return non-owning handles that dangle after EnsureDeinitialized().
+     */
+    static constexpr bool IsPinPoolEnabled() noexcept { return decltype(pin_registry_)::kPooled; }
+
+    /** @brief Pin wrappers allocated on the heap since construction (stays 0 while pooled). */
+    uint32_t GetPinHeapAllocations() const noexcept;
+
     /**
      * @brief Check if a pin wrapper has been created.
      * @param pin Pin number (0-15).
@@ -808,6 +884,9 @@ public:
     /// Allow Pcal95555GpioPin to access private interrupt methods.
     friend class Pcal95555GpioPin;
 
+    /// Allow the shared-INT aggregator to attach and service this handler.
+    friend class Pcal95555InterruptAggregator;
+
 private:
     //==========================================================================
     // Private Methods
@@ -872,8 +951,55 @@ private:
 
     /**
      * @brief Process pending interrupts by reading status and dispatching callbacks.
+     * @return Interrupt status bitmask that was read (0 if nothing was pending).
+     */
+    uint16_t ProcessInterrupts() noexcept;
+
+    /**
+     * @brief Write the whole mask in one driver call so the shadow is known (mutex held).
+     *
+     * Pins with a registered interrupt, and pins the handler unmasked earlier,
+     * stay unmasked; every other pin is masked.
+     * @return true if the shadow is known (already, or after the write).
+     */
+    bool seedInterruptMaskLocked() noexcept;
+
+    /// @name Shared-INT Aggregator Hooks
+    /// @brief Called by Pcal95555InterruptAggregator only.
+    /// @{
+
+    /**
+     * @brief Mark this handler as serviced by a shared INT line.
+     * @return GPIO_SUCCESS, or GPIO_ERR_INVALID_PARAMETER if the handler already
+     *         owns a dedicated interrupt pin.
+     */
+    hf_gpio_err_t AttachSharedInterrupt() noexcept;
+
+    /** @brief Detach from the shared INT line (per-pin callbacks are kept). */
+    void DetachSharedInterrupt() noexcept;
+
+    /**
+     * @brief Check whether the expander can currently be asserting INT.
+     *
+     * On PCAL9555A, an expander with every pin interrupt masked can never pull
+     * INT low, so its status register does not need to be read. PCA9555 has no
+     * interrupt mask and is therefore never considered idle.
+     *
+     * Uses the handler's mask shadow: attaching to the aggregator (or
+     * initializing while attached) masks every pin, and a failed mask write
+     * leaves the shadow unknown, which is never idle.
+     *
+     * @return true if the expander is known not to be asserting INT.
      */
-    void ProcessInterrupts() noexcept;
+    bool IsInterruptSourceIdle() const noexcept;
+
+    /**
+     * @brief Read status and dispatch callbacks on behalf of the aggregator.
+     * @return Interrupt status bitmask that was read (0 if nothing was pending).
+     */
+    uint16_t ServiceSharedInterrupt() noexcept;
+
+    /// @}
 
     //==========================================================================
     /// @name Direct Driver Access
@@ -882,6 +1008,11 @@ private:
 
     /**
      * @brief Get the underlying PCAL95555 driver for advanced register-level operations.
+     *
+     * Direct register access can change the interrupt mask, so the mask shadow
+     * becomes unknown; the next mask change rewrites the whole mask from the
+     * handler's registered pins.
+     *
      * @return Pointer to the CRTP driver, or nullptr if not initialized.
      */
     [[nodiscard]] Pcal95555Driver* GetDriver() noexcept;
@@ -904,7 +1035,7 @@ private:
 
     /// @name Pin Registry
     /// @{
-    std::array<std::shared_ptr<Pcal95555GpioPin>, 16> pin_registry_; ///< Created pin wrappers.
+    GpioPinRegistry<Pcal95555GpioPin, 16> pin_registry_; ///< Created pin wrappers (kDefaultGpioPinStorage).
     /// @}
 
     /// @name Interrupt Management
@@ -912,6 +1043,10 @@ private:
     BaseGpio* interrupt_pin_;       ///< Hardware INT pin (optional, not owned).
     bool interrupt_configured_;     ///< Whether hardware interrupt is active.
     std::atomic<bool> interrupt_pending_{false}; ///< Deferred interrupt flag (set in ISR, cleared in task context).
+    bool shared_interrupt_attached_ = false;  ///< Serviced by a Pcal95555InterruptAggregator.
+    uint16_t unmasked_interrupt_pins_ = 0;    ///< Pins whose interrupt mask bit is cleared on the chip.
+    bool interrupt_mask_known_ = false;       ///< unmasked_interrupt_pins_ matches the chip.
+
     /// @}
 
     /// @name Internal Pull Mode Tracking
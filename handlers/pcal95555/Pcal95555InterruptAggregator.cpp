@@ -0,0 +1,273 @@
+/**
+ * @file Pcal95555InterruptAggregator.cpp
+ * @brief Implementation of the shared-INT aggregator for PCAL95555 expanders.
+ *
+ * @see Pcal95555InterruptAggregator.h  for architectural overview and Doxygen documentation.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ */
+
+#include "Pcal95555InterruptAggregator.h"
+#include "Pcal95555Handler.h"
+#include "handlers/logger/Logger.h"
+#include "OsUtility.h"
+
+// =====================================================================
+// Construction & Destruction
+// =====================================================================
+
+Pcal95555InterruptAggregator::Pcal95555InterruptAggregator(BaseGpio& shared_int_pin) noexcept
+    : shared_int_pin_(shared_int_pin) {}
+
+Pcal95555InterruptAggregator::~Pcal95555InterruptAggregator() noexcept {
+    DisableInterrupt();
+    MutexLockGuard lock(mutex_);
+    for (size_t i = 0; i < slot_count_; ++i) {
+        slots_[i].handler->DetachSharedInterrupt();
+        slots_[i] = Slot{};
+    }
+    slot_count_ = 0;
+}
+
+// =====================================================================
+// Registration
+// =====================================================================
+
+hf_gpio_err_t Pcal95555InterruptAggregator::RegisterExpander(Pcal95555Handler& handler,
+                                                             uint8_t priority) noexcept {
+    MutexLockGuard lock(mutex_);
+
+    if (FindSlotLocked(&handler) >= 0) {
+        return hf_gpio_err_t::GPIO_ERR_INVALID_PARAMETER;
+    }
+    if (slot_count_ >= kMaxExpanders) {
+        return hf_gpio_err_t::GPIO_ERR_OUT_OF_MEMORY;
+    }
+
+    auto result = handler.AttachSharedInterrupt();
+    if (result != hf_gpio_err_t::GPIO_SUCCESS) {
+        return result;
+    }
+
+    // Insert after every slot of equal or higher priority so that equal
+    // priorities are serviced in registration order.
+    size_t pos = slot_count_;
+    while (pos > 0 && slots_[pos - 1].priority < priority) {
+        slots_[pos] = slots_[pos - 1];
+        --pos;
+    }
+    slots_[pos] = Slot{&handler, priority, {}};
+    ++slot_count_;
+    return hf_gpio_err_t::GPIO_SUCCESS;
+}
+
+hf_gpio_err_t Pcal95555InterruptAggregator::UnregisterExpander(Pcal95555Handler& handler) noexcept {
+    MutexLockGuard lock(mutex_);
+
+    int idx = FindSlotLocked(&handler);
+    if (idx < 0) {
+        return hf_gpio_err_t::GPIO_ERR_PIN_NOT_FOUND;
+    }
+
+    handler.DetachSharedInterrupt();
+    for (size_t i = static_cast<size_t>(idx); i + 1 < slot_count_; ++i) {
+        slots_[i] = slots_[i + 1];
+    }
+    --slot_count_;
+    slots_[slot_count_] = Slot{};
+    return hf_gpio_err_t::GPIO_SUCCESS;
+}
+
+size_t Pcal95555InterruptAggregator::GetExpanderCount() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return slot_count_;
+}
+
+int Pcal95555InterruptAggregator::FindSlotLocked(const Pcal95555Handler* handler) const noexcept {
+    for (size_t i = 0; i < slot_count_; ++i) {
+        if (slots_[i].handler == handler) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+// =====================================================================
+// Interrupt Control
+// =====================================================================
+
+hf_gpio_err_t Pcal95555InterruptAggregator::EnableInterrupt() noexcept {
+    MutexLockGuard lock(mutex_);
+
+    // PCAL95555 INT outputs are active-low, open-drain -- trigger on falling edge.
+    auto result = shared_int_pin_.ConfigureInterrupt(
+        hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_FALLING_EDGE,
+        SharedInterruptCallback,
+        this);
+    if (result == hf_gpio_err_t::GPIO_SUCCESS) {
+        interrupt_enabled_ = true;
+        // An expander may already be holding the line low; no edge will come.
+        if (IsLineAsserted()) {
+            pending_.store(true, std::memory_order_release);
+        }
+    }
+    return result;
+}
+
+hf_gpio_err_t Pcal95555InterruptAggregator::DisableInterrupt() noexcept {
+    MutexLockGuard lock(mutex_);
+    if (!interrupt_enabled_) {
+        return hf_gpio_err_t::GPIO_SUCCESS;
+    }
+    auto result = shared_int_pin_.ConfigureInterrupt(
+        hf_gpio_interrupt_trigger_t::HF_GPIO_INTERRUPT_TRIGGER_NONE);
+    interrupt_enabled_ = false;
+    pending_.store(false, std::memory_order_release);
+    return result;
+}
+
+void Pcal95555InterruptAggregator::SharedInterruptCallback(
+    BaseGpio* /*gpio*/,
+    hf_gpio_interrupt_trigger_t /*trigger*/,
+    void* user_data) noexcept {
+    // Called in ISR context -- only set atomic flag, defer I2C work.
+    auto* aggregator = static_cast<Pcal95555InterruptAggregator*>(user_data);
+    if (aggregator) {
+        aggregator->pending_.store(true, std::memory_order_release);
+    }
+}
+
+bool Pcal95555InterruptAggregator::IsLineAsserted() const noexcept {
+    // Shared pin is configured active-low: IsActive() = some expander pulls INT low.
+    bool is_active = true;
+    if (shared_int_pin_.IsActive(is_active) != hf_gpio_err_t::GPIO_SUCCESS) {
+        return true;  // Assume asserted on read error so the pass is not skipped.
+    }
+    return is_active;
+}
+
+bool Pcal95555InterruptAggregator::DrainPendingInterrupts() noexcept {
+    if (!pending_.exchange(false, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    MutexLockGuard lock(mutex_);
+    ++drain_count_;
+
+    bool line_asserted = true;
+    for (uint8_t pass = 0; pass < kMaxPassesPerDrain && line_asserted; ++pass) {
+        ++pass_count_;
+        const uint64_t pass_start_us = RtosTime::GetCurrentTimeUs();
+
+        for (size_t i = 0; i < slot_count_; ++i) {
+            Slot& slot = slots_[i];
+            if (slot.handler->IsInterruptSourceIdle()) {
+                ++slot.stats.skipped_idle;
+                continue;
+            }
+
+            const uint16_t status = slot.handler->ServiceSharedInterrupt();
+            const auto latency_us = static_cast<uint32_t>(
+                RtosTime::GetCurrentTimeUs() - pass_start_us);
+
+            ++slot.stats.service_count;
+            if (status != 0) {
+                ++slot.stats.active_count;
+            }
+            slot.stats.last_latency_us = latency_us;
+            slot.stats.total_latency_us += latency_us;
+            if (latency_us > slot.stats.max_latency_us) {
+                slot.stats.max_latency_us = latency_us;
+            }
+        }
+
+        line_asserted = IsLineAsserted();
+    }
+
+    if (line_asserted) {
+        // Still held low: re-arm so the next drain keeps servicing.
+        ++stuck_line_count_;
+        pending_.store(true, std::memory_order_release);
+    }
+    return true;
+}
+
+// =====================================================================
+// Statistics
+// =====================================================================
+
+bool Pcal95555InterruptAggregator::GetExpanderStats(const Pcal95555Handler& handler,
+                                                    Pcal95555InterruptStats& stats) const noexcept {
+    MutexLockGuard lock(mutex_);
+    int idx = FindSlotLocked(&handler);
+    if (idx < 0) {
+        return false;
+    }
+    stats = slots_[static_cast<size_t>(idx)].stats;
+    return true;
+}
+
+uint32_t Pcal95555InterruptAggregator::GetDrainCount() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return drain_count_;
+}
+
+uint32_t Pcal95555InterruptAggregator::GetPassCount() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return pass_count_;
+}
+
+uint32_t Pcal95555InterruptAggregator::GetStuckLineCount() const noexcept {
+    MutexLockGuard lock(mutex_);
+    return stuck_line_count_;
+}
+
+void Pcal95555InterruptAggregator::ResetStats() noexcept {
+    MutexLockGuard lock(mutex_);
+    for (size_t i = 0; i < slot_count_; ++i) {
+        slots_[i].stats = Pcal95555InterruptStats{};
+    }
+    drain_count_ = 0;
+    pass_count_ = 0;
+    stuck_line_count_ = 0;
+}
+
+void Pcal95555InterruptAggregator::DumpDiagnostics() const noexcept {
+    static constexpr const char* TAG = "Pcal95555IntAggregator";
+
+    Logger::GetInstance().Info(TAG, "=== PCAL95555 INTERRUPT AGGREGATOR DIAGNOSTICS ===");
+
+    MutexLockGuard lock(mutex_);
+
+    Logger::GetInstance().Info(TAG, "  Shared Interrupt: %s",
+                              interrupt_enabled_ ? "ENABLED" : "DISABLED");
+    Logger::GetInstance().Info(TAG, "  Expanders: %u/%u",
+                              static_cast<unsigned>(slot_count_),
+                              static_cast<unsigned>(kMaxExpanders));
+    Logger::GetInstance().Info(TAG, "  Drains: %u  Passes: %u  Stuck Line: %u",
+                              static_cast<unsigned>(drain_count_),
+                              static_cast<unsigned>(pass_count_),
+                              static_cast<unsigned>(stuck_line_count_));
+
+    for (size_t i = 0; i < slot_count_; ++i) {
+        const Slot& slot = slots_[i];
+        const uint32_t avg_us = slot.stats.service_count
+            ? static_cast<uint32_t>(slot.stats.total_latency_us / slot.stats.service_count)
+            : 0;
+        Logger::GetInstance().Info(
+            TAG, "  [%u] addr=0x%02X prio=%u reads=%u active=%u skipped=%u "
+                 "latency(us) last=%u avg=%u max=%u",
+            static_cast<unsigned>(i),
+            slot.handler->GetI2cAddress(),
+            static_cast<unsigned>(slot.priority),
+            static_cast<unsigned>(slot.stats.service_count),
+            static_cast<unsigned>(slot.stats.active_count),
+            static_cast<unsigned>(slot.stats.skipped_idle),
+            static_cast<unsigned>(slot.stats.last_latency_us),
+            static_cast<unsigned>(avg_us),
+            static_cast<unsigned>(slot.stats.max_latency_us));
+    }
+
+    Logger::GetInstance().Info(TAG, "=== END PCAL95555 INTERRUPT AGGREGATOR DIAGNOSTICS ===");
+}
@@ -0,0 +1,245 @@
+/**
+ * @file Pcal95555InterruptAggregator.h
+ * @brief Shared open-drain INT line servicing for multiple PCAL95555 expanders.
+ *
+ * @details
+ * ## Purpose
+ *
+ * PCA9555 / PCAL9555A INT outputs are open-drain, so boards commonly wire
+ * several expanders onto one MCU GPIO. When every Pcal95555Handler configures
+ * that GPIO on its own, one falling edge wakes every handler and each of them
+ * reads its status registers over I2C, even those that cannot be the source.
+ *
+ * The aggregator owns the shared INT GPIO instead. Registered handlers are
+ * constructed without an interrupt pin and are attached to the aggregator,
+ * which then services all of them from one DrainPendingInterrupts() call:
+ *
+ * @code
+ *  INT (shared, active-low) ──ISR──> pending_ flag
+ *                                      │
+ *  DrainPendingInterrupts() ───────────┘
+ *    repeat until INT deasserts:
+ *      for each expander, highest priority first:
+ *        - skip if known idle (PCAL9555A with every pin interrupt masked)
+ *        - otherwise read status + dispatch per-pin callbacks
+ * @endcode
+ *
+ * ## Usage
+ *
+ * @code
+ * Pcal95555Handler exp_a(i2c_dev_a);   // no per-handler interrupt pin
+ * Pcal95555Handler exp_b(i2c_dev_b);
+ * Pcal95555InterruptAggregator aggregator(shared_int_gpio);
+ *
+ * aggregator.RegisterExpander(exp_a, 10);  // serviced first
+ * aggregator.RegisterExpander(exp_b, 0);
+ * aggregator.EnableInterrupt();
+ *
+ * // Per-pin callbacks are configured through the handlers as usual.
+ * exp_a.CreateGpioPin(3)->ConfigureInterrupt(trigger, callback, ctx);
+ *
+ * // Task context:
+ * aggregator.DrainPendingInterrupts();
+ * @endcode
+ *
+ * ## Lifetime Requirements
+ *
+ * The shared INT GPIO and every registered handler must outlive the
+ * aggregator (or be unregistered first).
+ *
+ * @see Pcal95555Handler  Per-device handler serviced by this class.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ */
+
+#ifndef COMPONENT_HANDLER_PCAL95555_INTERRUPT_AGGREGATOR_H_
+#define COMPONENT_HANDLER_PCAL95555_INTERRUPT_AGGREGATOR_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "base/BaseGpio.h"
+#include "RtosMutex.h"
+
+// Forward declaration to avoid including the full handler header.
+class Pcal95555Handler;
+
+/**
+ * @brief Per-expander service statistics collected by the aggregator.
+ *
+ * Latency is measured from the start of a drain pass to the moment this
+ * expander's callbacks have been dispatched, so it includes the time spent
+ * servicing higher-priority expanders in the same pass.
+ */
+struct Pcal95555InterruptStats {
+    uint32_t service_count = 0;    ///< Status reads performed for this expander.
+    uint32_t active_count = 0;     ///< Status reads that returned a non-zero status.
+    uint32_t skipped_idle = 0;     ///< Passes where the status read was skipped (known idle).
+    uint32_t last_latency_us = 0;  ///< Latency of the most recent service.
+    uint32_t max_latency_us = 0;   ///< Worst observed service latency.
+    uint64_t total_latency_us = 0; ///< Sum of all service latencies (for averaging).
+};
+
+/**
+ * @class Pcal95555InterruptAggregator
+ * @brief Owns a shared INT GPIO and services every registered PCAL95555 in one pass.
+ *
+ * @details
+ * Expanders are kept sorted by descending priority; equal priorities keep
+ * their registration order. Each drain keeps making passes over the
+ * expanders until the shared line reads inactive, bounded by
+ * kMaxPassesPerDrain so a stuck line cannot starve the calling task.
+ *
+ * @note All methods except the ISR callback must be called from task context.
+ */
+class Pcal95555InterruptAggregator {
+public:
+    /** @brief Maximum expanders on one INT line (PCAL9555A address range 0x20-0x27). */
+    static constexpr size_t kMaxExpanders = 8;
+
+    /** @brief Upper bound on service passes per DrainPendingInterrupts() call. */
+    static constexpr uint8_t kMaxPassesPerDrain = 4;
+
+    /**
+     * @brief Construct the aggregator.
+     * @param shared_int_pin GPIO wired to the shared INT line, configured as an
+     *                       active-low input. Must outlive the aggregator.
+     */
+    explicit Pcal95555InterruptAggregator(BaseGpio& shared_int_pin) noexcept;
+
+    /** @brief Destructor. Disables the shared interrupt and detaches all handlers. */
+    ~Pcal95555InterruptAggregator() noexcept;
+
+    /// Non-copyable.
+    Pcal95555InterruptAggregator(const Pcal95555InterruptAggregator&) = delete;
+    /// Non-copyable.
+    Pcal95555InterruptAggregator& operator=(const Pcal95555InterruptAggregator&) = delete;
+
+    /// Non-movable.
+    Pcal95555InterruptAggregator(Pcal95555InterruptAggregator&&) = delete;
+    /// Non-movable.
+    Pcal95555InterruptAggregator& operator=(Pcal95555InterruptAggregator&&) = delete;
+
+    /// @name Registration
+    /// @{
+
+    /**
+     * @brief Register an expander on the shared line.
+     * @param handler  Handler constructed without a dedicated interrupt pin.
+     * @param priority Service priority (higher values are serviced first).
+     * @return GPIO_SUCCESS, GPIO_ERR_INVALID_PARAMETER if the handler owns its
+     *         own interrupt pin or is already registered, or
+     *         GPIO_ERR_OUT_OF_MEMORY if kMaxExpanders are already registered.
+     */
+    hf_gpio_err_t RegisterExpander(Pcal95555Handler& handler, uint8_t priority = 0) noexcept;
+
+    /**
+     * @brief Remove an expander from the shared line.
+     * @param handler Previously registered handler.
+     * @return GPIO_SUCCESS or GPIO_ERR_PIN_NOT_FOUND.
+     */
+    hf_gpio_err_t UnregisterExpander(Pcal95555Handler& handler) noexcept;
+
+    /** @brief Number of registered expanders. */
+    size_t GetExpanderCount() const noexcept;
+
+    /// @}
+
+    /// @name Interrupt Control
+    /// @{
+
+    /**
+     * @brief Configure the shared GPIO for falling-edge interrupts.
+     * @return GPIO error code from BaseGpio::ConfigureInterrupt().
+     */
+    hf_gpio_err_t EnableInterrupt() noexcept;
+
+    /**
+     * @brief Disable the shared GPIO interrupt.
+     * @return GPIO error code from BaseGpio::ConfigureInterrupt().
+     */
+    hf_gpio_err_t DisableInterrupt() noexcept;
+
+    /** @brief Check if the shared interrupt is currently enabled. */
+    bool IsInterruptEnabled() const noexcept { return interrupt_enabled_; }
+
+    /**
+     * @brief Service every registered expander if an edge is pending.
+     *
+     * Makes passes over the expanders in priority order until the shared line
+     * deasserts. If the line is still asserted after kMaxPassesPerDrain passes,
+     * the pending flag is re-armed so the next call continues servicing.
+     *
+     * @return true if an interrupt was processed, false if none was pending.
+     */
+    bool DrainPendingInterrupts() noexcept;
+
+    /// @}
+
+    /// @name Statistics
+    /// @{
+
+    /**
+     * @brief Get service statistics for one expander.
+     * @param handler    Registered handler.
+     * @param[out] stats Copy of the expander's statistics.
+     * @return true if the handler is registered.
+     */
+    bool GetExpanderStats(const Pcal95555Handler& handler,
+                          Pcal95555InterruptStats& stats) const noexcept;
+
+    /** @brief Number of drains that processed a pending edge. */
+    uint32_t GetDrainCount() const noexcept;
+
+    /** @brief Total service passes across all drains. */
+    uint32_t GetPassCount() const noexcept;
+
+    /** @brief Drains that hit kMaxPassesPerDrain with the line still asserted. */
+    uint32_t GetStuckLineCount() const noexcept;
+
+    /** @brief Reset all per-expander and aggregate statistics. */
+    void ResetStats() noexcept;
+
+    /** @brief Log registration, priority order, and statistics at INFO level. */
+    void DumpDiagnostics() const noexcept;
+
+    /// @}
+
+private:
+    /** @brief One registered expander. */
+    struct Slot {
+        Pcal95555Handler* handler = nullptr;
+        uint8_t priority = 0;
+        Pcal95555InterruptStats stats{};
+    };
+
+    /**
+     * @brief Static ISR callback for the shared INT pin.
+     * @param gpio      The GPIO pin that triggered.
+     * @param trigger   Trigger type.
+     * @param user_data Pointer to the Pcal95555InterruptAggregator instance.
+     */
+    static void SharedInterruptCallback(BaseGpio* gpio,
+                                        hf_gpio_interrupt_trigger_t trigger,
+                                        void* user_data) noexcept;
+
+    /** @brief Read the shared line (true = asserted). Read errors count as asserted. */
+    bool IsLineAsserted() const noexcept;
+
+    /** @brief Find the slot index of a handler (caller holds mutex_). */
+    int FindSlotLocked(const Pcal95555Handler* handler) const noexcept;
+
+    BaseGpio& shared_int_pin_;                     ///< Shared INT GPIO (not owned).
+    std::array<Slot, kMaxExpanders> slots_{};       ///< Sorted by descending priority.
+    size_t slot_count_ = 0;                        ///< Number of used slots.
+    bool interrupt_enabled_ = false;               ///< Shared GPIO interrupt configured.
+    std::atomic<bool> pending_{false};             ///< Set in ISR, cleared in task context.
+    uint32_t drain_count_ = 0;                     ///< Drains that found a pending edge.
+    uint32_t pass_count_ = 0;                      ///< Total service passes.
+    uint32_t stuck_line_count_ = 0;                ///< Drains that ran out of passes.
+    mutable RtosMutex mutex_;                      ///< Protects slots and statistics.
+};
+
+#endif // COMPONENT_HANDLER_PCAL95555_INTERRUPT_AGGREGATOR_H_
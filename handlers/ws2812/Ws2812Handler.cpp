@@ -6,9 +6,45 @@
 
 #include "Ws2812Handler.h"
 #include "Logger.h"
+#include "core/hf-core-utils/hf-utils-rtos-wrap/include/OsUtility.h"
+
+#include <cstring>
+#include <new>
+#include <utility>
+
+#if defined(ESP_PLATFORM)
+#include "driver/rmt_encoder.h"
+#endif
 
 static constexpr const char* TAG = "WS2812";
 
+/// RMT memory per frame-path channel, in symbols (refilled from the lookup table as it drains).
+static constexpr size_t kFrameMemBlockSymbols = 64;
+
+/// Frames the RMT driver may queue; PresentFrame() keeps at most one in flight.
+static constexpr size_t kFrameQueueDepth = 2;
+
+static constexpr size_t BytesPerLed(LedType type) noexcept {
+    return type == LedType::RGBW ? 4 : 3;
+}
+
+#if defined(ESP_PLATFORM)
+/**
+ * RMT simple-encoder callback: fills the channel memory from the lookup table.
+ * Runs in the RMT interrupt once the transfer has started.
+ */
+static size_t EncodeFrameChunk(const void* data, size_t data_size, size_t symbols_written, size_t symbols_free,
+                               rmt_symbol_word_t* symbols, bool* done, void* arg) {
+    static_assert(sizeof(rmt_symbol_word_t) == sizeof(uint32_t), "unexpected RMT symbol layout");
+    const auto* encoder = static_cast<const Ws2812SymbolEncoder*>(arg);
+    bool finished = false;
+    const size_t written = encoder->EncodeChunk(static_cast<const uint8_t*>(data), data_size, symbols_written,
+                                                symbols_free, reinterpret_cast<uint32_t*>(symbols), finished);
+    *done = finished;
+    return written;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Ws2812Handler Implementation
 ///////////////////////////////////////////////////////////////////////////////
@@ -36,6 +72,20 @@ esp_err_t Ws2812Handler::Initialize() noexcept {
         return ESP_OK;
     }
 
+    if (config_.use_frame_buffers) {
+        const esp_err_t err = InitializeFramesLocked();
+        if (err != ESP_OK) {
+            Logger::GetInstance().Error(TAG, "Failed to init frame path: 0x%x", err);
+            return err;
+        }
+        initialized_ = true;
+        Logger::GetInstance().Info(TAG, "WS2812 frame path initialized (%lu LEDs, %u bytes/frame, ~%lu us/frame)",
+                                   static_cast<unsigned long>(config_.num_leds),
+                                   static_cast<unsigned>(frame_bytes_),
+                                   static_cast<unsigned long>(frame_stats_.wire_time_us));
+        return ESP_OK;
+    }
+
     // Create the LED strip (all types in global scope)
     strip_ = std::make_unique<WS2812Strip>(
         config_.gpio_pin,
@@ -78,7 +128,7 @@ bool Ws2812Handler::EnsureInitialized() noexcept {
 }
 
 bool Ws2812Handler::EnsureInitializedLocked() noexcept {
-    if (initialized_ && strip_ && animator_) {
+    if (initialized_ && (config_.use_frame_buffers ? frame_storage_ != nullptr : (strip_ && animator_))) {
         return true;
     }
     return Initialize() == ESP_OK;
@@ -88,6 +138,8 @@ bool Ws2812Handler::Deinitialize() noexcept {
     MutexLockGuard lock(mutex_);
     if (!initialized_) return true;
 
+    DeinitializeFramesLocked();
+
     // Turn off all LEDs
     if (strip_) {
         for (uint32_t i = 0; i < config_.num_leds; ++i) {
@@ -138,6 +190,202 @@ const WS2812Animator* Ws2812Handler::GetAnimator() const noexcept {
     return self->GetAnimator();
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Double-Buffered Frames
+///////////////////////////////////////////////////////////////////////////////
+
+esp_err_t Ws2812Handler::InitializeFramesLocked() noexcept {
+#if defined(ESP_PLATFORM)
+    if (config_.num_leds == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t frame_bytes = static_cast<size_t>(config_.num_leds) * BytesPerLed(config_.led_type);
+    std::unique_ptr<Ws2812SymbolEncoder> encoder(new (std::nothrow) Ws2812SymbolEncoder());
+    std::unique_ptr<uint8_t[]> storage(new (std::nothrow) uint8_t[2 * frame_bytes]());
+    if (!encoder || !storage) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (!encoder->Configure(config_.resolution_hz, config_.t0h, config_.t0l, config_.t1h, config_.t1l,
+                            config_.reset_us)) {
+        Logger::GetInstance().Error(TAG, "Bit timings do not fit RMT symbols at %lu Hz",
+                                    static_cast<unsigned long>(config_.resolution_hz));
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    rmt_tx_channel_config_t channel_config = {};
+    channel_config.gpio_num = config_.gpio_pin;
+    channel_config.clk_src = RMT_CLK_SRC_DEFAULT;
+    channel_config.resolution_hz = config_.resolution_hz;
+    channel_config.mem_block_symbols = kFrameMemBlockSymbols;
+    channel_config.trans_queue_depth = kFrameQueueDepth;
+    rmt_channel_handle_t channel = nullptr;
+    esp_err_t err = rmt_new_tx_channel(&channel_config, &channel);
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    // One byte (8 symbols) of free space is always enough for progress: a byte or the reset symbol.
+    rmt_simple_encoder_config_t encoder_config = {};
+    encoder_config.callback = &EncodeFrameChunk;
+    encoder_config.arg = encoder.get();
+    encoder_config.min_chunk_size = Ws2812SymbolEncoder::kSymbolsPerByte;
+    rmt_encoder_handle_t rmt_encoder = nullptr;
+    err = rmt_new_simple_encoder(&encoder_config, &rmt_encoder);
+    if (err == ESP_OK) {
+        err = rmt_enable(channel);
+    }
+    if (err != ESP_OK) {
+        if (rmt_encoder != nullptr) {
+            rmt_del_encoder(rmt_encoder);
+        }
+        rmt_del_channel(channel);
+        return err;
+    }
+
+    frame_channel_ = channel;
+    frame_encoder_ = rmt_encoder;
+    frame_bytes_ = frame_bytes;
+    front_ = storage.get();
+    back_ = storage.get() + frame_bytes;
+    frame_storage_ = std::move(storage);
+    symbol_encoder_ = std::move(encoder);
+    frame_stats_ = Ws2812FrameStats{};
+    frame_stats_.frame_bytes = static_cast<uint32_t>(frame_bytes);
+    frame_stats_.wire_time_us = symbol_encoder_->GetFrameTimeUs(frame_bytes);
+
+    // Clear all LEDs on init. initialized_ stays false on failure, so Deinitialize()
+    // would never release the channel and encoder: release them here.
+    err = TransmitFrontLocked();
+    if (err != ESP_OK) {
+        DeinitializeFramesLocked();
+    }
+    return err;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void Ws2812Handler::DeinitializeFramesLocked() noexcept {
+#if defined(ESP_PLATFORM)
+    if (frame_channel_ != nullptr) {
+        // Turn off all LEDs
+        if (WaitFrameDoneLocked(kDefaultFrameTimeoutMs) == ESP_OK) {
+            std::memset(back_, 0, frame_bytes_);
+            std::swap(front_, back_);
+            if (TransmitFrontLocked() == ESP_OK) {
+                (void)WaitFrameDoneLocked(kDefaultFrameTimeoutMs);
+            }
+        }
+        rmt_disable(frame_channel_);
+        rmt_del_encoder(frame_encoder_);
+        rmt_del_channel(frame_channel_);
+    }
+#endif
+    frame_channel_ = nullptr;
+    frame_encoder_ = nullptr;
+    front_ = nullptr;
+    back_ = nullptr;
+    frame_bytes_ = 0;
+    frame_storage_.reset();
+    symbol_encoder_.reset();
+}
+
+esp_err_t Ws2812Handler::TransmitFrontLocked() noexcept {
+#if defined(ESP_PLATFORM)
+    rmt_transmit_config_t transmit_config = {};
+    const esp_err_t err = rmt_transmit(frame_channel_, frame_encoder_, front_, frame_bytes_, &transmit_config);
+    if (err == ESP_OK) {
+        ++frame_stats_.frames;
+    } else {
+        ++frame_stats_.transmit_errors;
+    }
+    return err;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t Ws2812Handler::WaitFrameDoneLocked(uint32_t timeout_ms) noexcept {
+#if defined(ESP_PLATFORM)
+    return rmt_tx_wait_all_done(frame_channel_, static_cast<int>(timeout_ms));
+#else
+    (void)timeout_ms;
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+uint8_t* Ws2812Handler::GetBackBuffer() noexcept {
+    if (back_ == nullptr && (!config_.use_frame_buffers || !EnsureInitialized())) {
+        return nullptr;
+    }
+    return back_;
+}
+
+bool Ws2812Handler::SetFramePixel(uint32_t index, uint32_t rgbw) noexcept {
+    uint8_t* frame = GetBackBuffer();
+    if (frame == nullptr || index >= config_.num_leds) {
+        return false;
+    }
+    const size_t bytes_per_led = BytesPerLed(config_.led_type);
+    const uint32_t scale = config_.brightness + 1U;
+    const auto channel = [scale, rgbw](unsigned shift) {
+        return static_cast<uint8_t>((((rgbw >> shift) & 0xFFU) * scale) >> 8);
+    };
+    uint8_t* led = frame + static_cast<size_t>(index) * bytes_per_led;
+    led[0] = channel(8);    // G
+    led[1] = channel(16);   // R
+    led[2] = channel(0);    // B
+    if (bytes_per_led == 4) {
+        led[3] = channel(24);  // W
+    }
+    return true;
+}
+
+void Ws2812Handler::ClearFrame() noexcept {
+    uint8_t* frame = GetBackBuffer();
+    if (frame != nullptr) {
+        std::memset(frame, 0, frame_bytes_);
+    }
+}
+
+esp_err_t Ws2812Handler::PresentFrame(uint32_t timeout_ms) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (!config_.use_frame_buffers || !EnsureInitializedLocked()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Frame N must leave the wire before its buffer becomes the back buffer again
+    const uint64_t start_us = RtosTime::GetCurrentTimeUs();
+    const esp_err_t err = WaitFrameDoneLocked(timeout_ms);
+    frame_stats_.last_wait_us = static_cast<uint32_t>(RtosTime::GetCurrentTimeUs() - start_us);
+    if (frame_stats_.last_wait_us > frame_stats_.max_wait_us) {
+        frame_stats_.max_wait_us = frame_stats_.last_wait_us;
+    }
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    std::swap(front_, back_);
+    return TransmitFrontLocked();
+}
+
+esp_err_t Ws2812Handler::WaitFrameDone(uint32_t timeout_ms) noexcept {
+    MutexLockGuard lock(mutex_);
+    if (!config_.use_frame_buffers || !initialized_ || frame_storage_ == nullptr) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return WaitFrameDoneLocked(timeout_ms);
+}
+
+bool Ws2812Handler::GetFrameStats(Ws2812FrameStats& stats) const noexcept {
+    MutexLockGuard lock(mutex_);
+    if (!config_.use_frame_buffers) {
+        return false;
+    }
+    stats = frame_stats_;
+    return true;
+}
+
 void Ws2812Handler::DumpDiagnostics() noexcept {
     MutexLockGuard lock(mutex_);
     auto& log = Logger::GetInstance();
@@ -151,6 +399,16 @@ void Ws2812Handler::DumpDiagnostics() noexcept {
     if (strip_) {
         log.Info(TAG, "  Strip Length: %lu", static_cast<unsigned long>(strip_->Length()));
     }
+    if (config_.use_frame_buffers) {
+        log.Info(TAG, "  Frame path: %lu Hz ticks, %u bytes/frame, ~%lu us/frame",
+                 static_cast<unsigned long>(config_.resolution_hz), static_cast<unsigned>(frame_bytes_),
+                 static_cast<unsigned long>(frame_stats_.wire_time_us));
+        log.Info(TAG, "  Frames: %lu (errors %lu), last wait %lu us, max wait %lu us",
+                 static_cast<unsigned long>(frame_stats_.frames),
+                 static_cast<unsigned long>(frame_stats_.transmit_errors),
+                 static_cast<unsigned long>(frame_stats_.last_wait_us),
+                 static_cast<unsigned long>(frame_stats_.max_wait_us));
+    }
     log.Info(TAG, "=== End WS2812 Diagnostics ===");
 }
 
@@ -9,10 +9,36 @@
  * - Direct access to underlying WS2812Strip and WS2812Animator objects
  * - Lazy initialization pattern
  * - Comprehensive diagnostics
+ * - Optional double-buffered frame path with a lookup-table RMT encoder
  *
  * All pixel operations and animation effects should be performed through
  * GetStrip() and GetAnimator() which expose the full driver API.
  *
+ * ## Double-Buffered Frames
+ *
+ * With Config::use_frame_buffers the handler drives the RMT channel itself
+ * instead of creating WS2812Strip / WS2812Animator. The application renders
+ * into a back buffer while the previous frame is still being transmitted.
+ * PresentFrame() waits for that transmission, swaps the buffers and starts
+ * the next one asynchronously. Bytes become RMT symbols through a 256-entry
+ * table built from the configured bit timings (see Ws2812SymbolEncoder.h),
+ * filled in by the RMT driver as its memory drains.
+ *
+ * @code
+ * Ws2812Handler::Config cfg{};
+ * cfg.gpio_pin = GPIO_NUM_48;
+ * cfg.num_leds = 300;
+ * cfg.use_frame_buffers = true;
+ * Ws2812Handler leds(cfg);
+ *
+ * while (running) {
+ *     for (uint32_t i = 0; i < 300; ++i) {
+ *         leds.SetFramePixel(i, Render(i, frame));   // frame N+1 while frame N is on the wire
+ *     }
+ *     leds.PresentFrame();
+ * }
+ * @endcode
+ *
  * ## Usage Example
  *
  * @code
@@ -43,6 +69,7 @@
 #ifndef COMPONENT_HANDLER_WS2812_HANDLER_H_
 #define COMPONENT_HANDLER_WS2812_HANDLER_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <type_traits>
@@ -50,11 +77,15 @@
 #include "core/hf-core-drivers/external/hf-ws2812-rmt-driver/inc/ws2812_cpp.hpp"
 #include "core/hf-core-drivers/external/hf-ws2812-rmt-driver/inc/ws2812_effects.hpp"
 #include "RtosMutex.h"
+#include "Ws2812SymbolEncoder.h"
 
 #if defined(ESP_PLATFORM)
 #include "driver/gpio.h"
+#include "driver/rmt_tx.h"
 #else
 using gpio_num_t = int;
+using rmt_channel_handle_t = void*;
+using rmt_encoder_handle_t = void*;
 #endif
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -62,6 +93,18 @@ using gpio_num_t = int;
 /// @{
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief Double-buffered frame path statistics.
+ */
+struct Ws2812FrameStats {
+    uint32_t frames;            ///< Frames handed to the RMT driver
+    uint32_t transmit_errors;   ///< rmt_transmit() failures
+    uint32_t frame_bytes;       ///< Bytes per frame
+    uint32_t wire_time_us;      ///< Estimated wire time per frame (incl. reset)
+    uint32_t last_wait_us;      ///< Time the last PresentFrame() waited for the previous frame
+    uint32_t max_wait_us;       ///< Longest such wait
+};
+
 /**
  * @class Ws2812Handler
  * @brief Unified handler for WS2812 addressable LED strips.
@@ -83,8 +126,14 @@ public:
         uint16_t t1h{800};                    ///< T1H timing in nanoseconds
         uint16_t t0l{850};                    ///< T0L timing in nanoseconds
         uint16_t t1l{450};                    ///< T1L timing in nanoseconds
+        bool use_frame_buffers{false};        ///< Double-buffered frame path instead of WS2812Strip/Animator
+        uint32_t resolution_hz{Ws2812SymbolEncoder::kDefaultResolutionHz};  ///< RMT tick rate (frame path)
+        uint32_t reset_us{Ws2812SymbolEncoder::kDefaultResetUs};            ///< Latch time (frame path)
     };
 
+    /** @brief Default PresentFrame() / WaitFrameDone() timeout in milliseconds. */
+    static constexpr uint32_t kDefaultFrameTimeoutMs = 100;
+
     //=========================================================================
     // Construction
     //=========================================================================
@@ -197,6 +246,64 @@ public:
         return fn(*animator_);
     }
 
+    //=========================================================================
+    // Double-Buffered Frames (Config::use_frame_buffers)
+    //=========================================================================
+
+    /**
+     * @brief Back buffer to render the next frame into.
+     *
+     * Bytes are in wire order, GRB (GRBW for LedType::RGBW) per LED, GetFrameBytes() long.
+     * After PresentFrame() the back buffer holds the frame before the one
+     * just presented; redraw every pixel or keep your own state.
+     *
+     * @return Buffer, or nullptr if the frame path is not enabled / initialized.
+     * @note The back buffer and SetFramePixel()/ClearFrame() belong to the
+     *       rendering task (the one calling PresentFrame()); they do not lock.
+     */
+    [[nodiscard]] uint8_t* GetBackBuffer() noexcept;
+
+    /** @brief Bytes per frame (LEDs * 3, or * 4 for RGBW); 0 without the frame path. */
+    [[nodiscard]] size_t GetFrameBytes() const noexcept { return frame_bytes_; }
+
+    /**
+     * @brief Write one LED into the back buffer, scaled by the configured brightness.
+     * @param index LED index
+     * @param rgbw Colour as 0xRRGGBB (0xWWRRGGBB for RGBW strips)
+     * @return false if out of range or the frame path is not ready
+     */
+    bool SetFramePixel(uint32_t index, uint32_t rgbw) noexcept;
+
+    /** @brief Set every LED in the back buffer to off. */
+    void ClearFrame() noexcept;
+
+    /**
+     * @brief Wait for the previous frame, swap buffers and start transmitting the back buffer.
+     *
+     * Returns as soon as the transfer is queued; the frame is encoded from
+     * the lookup table while it goes out.
+     *
+     * @param timeout_ms Longest wait for the previous frame
+     * @return ESP_OK, ESP_ERR_TIMEOUT (previous frame still busy, nothing swapped),
+     *         ESP_ERR_INVALID_STATE (frame path not enabled) or the RMT error.
+     */
+    esp_err_t PresentFrame(uint32_t timeout_ms = kDefaultFrameTimeoutMs) noexcept;
+
+    /**
+     * @brief Block until the frame being transmitted has left the wire.
+     * @return ESP_OK, ESP_ERR_TIMEOUT or ESP_ERR_INVALID_STATE
+     */
+    esp_err_t WaitFrameDone(uint32_t timeout_ms = kDefaultFrameTimeoutMs) noexcept;
+
+    /**
+     * @brief Copy frame path statistics.
+     * @return false if the frame path is not enabled
+     */
+    bool GetFrameStats(Ws2812FrameStats& stats) const noexcept;
+
+    /** @brief The lookup-table encoder of the frame path (nullptr until initialized). */
+    [[nodiscard]] const Ws2812SymbolEncoder* GetSymbolEncoder() const noexcept { return symbol_encoder_.get(); }
+
     /** @brief Dump diagnostics to logger. */
     void DumpDiagnostics() noexcept;
 
@@ -214,6 +321,10 @@ public:
 
 private:
     bool EnsureInitializedLocked() noexcept;
+    esp_err_t InitializeFramesLocked() noexcept;
+    void DeinitializeFramesLocked() noexcept;
+    esp_err_t TransmitFrontLocked() noexcept;
+    esp_err_t WaitFrameDoneLocked(uint32_t timeout_ms) noexcept;
 
     Config config_;
     bool initialized_{false};
@@ -221,6 +332,16 @@ private:
     std::unique_ptr<WS2812Strip> strip_;
     std::unique_ptr<WS2812Animator> animator_;
     char description_[64]{};   ///< Human-readable handler description.
+
+    // Double-buffered frame path
+    std::unique_ptr<Ws2812SymbolEncoder> symbol_encoder_;   ///< Byte-to-symbol lookup table
+    std::unique_ptr<uint8_t[]> frame_storage_;              ///< Both frame buffers
+    uint8_t* front_{nullptr};                               ///< Frame on the wire
+    uint8_t* back_{nullptr};                                ///< Frame being rendered
+    size_t frame_bytes_{0};                                 ///< Bytes per frame
+    rmt_channel_handle_t frame_channel_{nullptr};           ///< RMT TX channel
+    rmt_encoder_handle_t frame_encoder_{nullptr};           ///< Simple encoder calling the lookup table
+    Ws2812FrameStats frame_stats_{};                        ///< Frame path counters
 };
 
 /// @}
@@ -0,0 +1,215 @@
+/**
+ * @file Ws2812SymbolEncoder.h
+ * @brief Lookup-table WS2812 byte to RMT symbol encoder, independent of the RMT driver.
+ *
+ * @details
+ * Every WS2812 data bit is one RMT symbol: a high pulse followed by a low
+ * pulse whose lengths (T0H/T0L for 0, T1H/T1L for 1) come from
+ * Ws2812Handler::Config. Converting bits one at a time costs a branch and a
+ * shift per bit, which for a 300-LED strip (7200 bits) is in the same range
+ * as the 9 ms the frame spends on the wire.
+ *
+ * Ws2812SymbolEncoder instead builds, once per configuration, a 256-entry
+ * table holding the 8 symbols of every possible byte (8 KiB). Encoding a
+ * byte is then one 32-byte copy.
+ *
+ * Symbols use the ESP-IDF `rmt_symbol_word_t` layout as plain 32-bit words:
+ *
+ * @code
+ *  [14:0] duration0  [15] level0  [30:16] duration1  [31] level1
+ * @endcode
+ *
+ * The class does not include any ESP-IDF header, so it can be exercised
+ * and benchmarked on a host. EncodeChunk() follows the RMT simple-encoder
+ * callback contract, and Ws2812Handler forwards that callback to it.
+ *
+ * @author HardFOC Team
+ * @date 2026
+ * @copyright HardFOC
+ */
+
+#ifndef COMPONENT_HANDLER_WS2812_SYMBOL_ENCODER_H_
+#define COMPONENT_HANDLER_WS2812_SYMBOL_ENCODER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief WS2812 byte-to-symbol encoder backed by a per-configuration lookup table.
+ *
+ * @note Configure() rebuilds the table; do not call it while a transfer that
+ *       uses this encoder is in flight. Encoding is const and reentrant.
+ */
+class Ws2812SymbolEncoder {
+public:
+    /** @brief RMT symbols per data byte (one per bit). */
+    static constexpr size_t kSymbolsPerByte = 8;
+
+    /** @brief Default RMT tick rate (100 ns per tick). */
+    static constexpr uint32_t kDefaultResolutionHz = 10000000;
+
+    /** @brief Default latch (reset) low time in microseconds; >= 280 us suits current WS2812B parts. */
+    static constexpr uint32_t kDefaultResetUs = 280;
+
+    /** @brief Largest duration field of one symbol half. */
+    static constexpr uint32_t kMaxTicks = 0x7FFF;
+
+    /** @brief Pack one RMT symbol word. */
+    static constexpr uint32_t MakeSymbol(bool level0, uint32_t ticks0, bool level1, uint32_t ticks1) noexcept {
+        return (ticks0 & kMaxTicks) | (static_cast<uint32_t>(level0) << 15) |
+               ((ticks1 & kMaxTicks) << 16) | (static_cast<uint32_t>(level1) << 31);
+    }
+
+    /** @brief Convert nanoseconds to RMT ticks, rounded to nearest. */
+    static constexpr uint32_t NsToTicks(uint32_t ns, uint32_t resolution_hz) noexcept {
+        return static_cast<uint32_t>((static_cast<uint64_t>(ns) * resolution_hz + 500000000ULL) / 1000000000ULL);
+    }
+
+    /** @brief Symbols for a frame of @p bytes data bytes, including the trailing reset symbol. */
+    static constexpr size_t FrameSymbols(size_t bytes) noexcept { return bytes * kSymbolsPerByte + 1; }
+
+    /**
+     * @brief Build the lookup table from bit timings.
+     * @param resolution_hz RMT tick rate
+     * @param t0h_ns High time of a 0 bit
+     * @param t0l_ns Low time of a 0 bit
+     * @param t1h_ns High time of a 1 bit
+     * @param t1l_ns Low time of a 1 bit
+     * @param reset_us Latch low time appended after the last byte
+     * @return false (table unchanged) if a timing rounds to 0 ticks or does not fit a symbol
+     */
+    bool Configure(uint32_t resolution_hz, uint16_t t0h_ns, uint16_t t0l_ns, uint16_t t1h_ns, uint16_t t1l_ns,
+                   uint32_t reset_us = kDefaultResetUs) noexcept {
+        const uint32_t ticks[] = {
+            NsToTicks(t0h_ns, resolution_hz), NsToTicks(t0l_ns, resolution_hz),
+            NsToTicks(t1h_ns, resolution_hz), NsToTicks(t1l_ns, resolution_hz),
+        };
+        for (uint32_t t : ticks) {
+            if (t == 0 || t > kMaxTicks) {
+                return false;
+            }
+        }
+        // The reset is split across both halves of one symbol
+        const uint64_t reset_ticks = static_cast<uint64_t>(reset_us) * resolution_hz / 1000000ULL;
+        if (reset_ticks < 2 || reset_ticks > 2ULL * kMaxTicks) {
+            return false;
+        }
+
+        zero_ = MakeSymbol(true, ticks[0], false, ticks[1]);
+        one_ = MakeSymbol(true, ticks[2], false, ticks[3]);
+        const auto half = static_cast<uint32_t>(reset_ticks / 2);
+        reset_ = MakeSymbol(false, half, false, static_cast<uint32_t>(reset_ticks - half));
+        bit_time_ns_ = static_cast<uint32_t>(
+            (static_cast<uint64_t>(ticks[0] + ticks[1] + ticks[2] + ticks[3]) * 1000000000ULL / resolution_hz) / 2);
+        reset_us_ = reset_us;
+
+        // MSB is sent first
+        for (size_t value = 0; value < lut_.size(); ++value) {
+            for (size_t bit = 0; bit < kSymbolsPerByte; ++bit) {
+                lut_[value][bit] = (value & (0x80U >> bit)) ? one_ : zero_;
+            }
+        }
+        configured_ = true;
+        return true;
+    }
+
+    /** @brief Whether Configure() has succeeded. */
+    [[nodiscard]] bool IsConfigured() const noexcept { return configured_; }
+
+    /** @brief Symbol of a 0 bit. */
+    [[nodiscard]] uint32_t GetZeroSymbol() const noexcept { return zero_; }
+
+    /** @brief Symbol of a 1 bit. */
+    [[nodiscard]] uint32_t GetOneSymbol() const noexcept { return one_; }
+
+    /** @brief Latch symbol ending every frame. */
+    [[nodiscard]] uint32_t GetResetSymbol() const noexcept { return reset_; }
+
+    /** @brief The 8 symbols of @p value (table row). */
+    [[nodiscard]] const uint32_t* GetByteSymbols(uint8_t value) const noexcept { return lut_[value].data(); }
+
+    /** @brief Estimated wire time of a frame of @p bytes bytes in microseconds (average bit, plus reset). */
+    [[nodiscard]] uint32_t GetFrameTimeUs(size_t bytes) const noexcept {
+        return static_cast<uint32_t>(static_cast<uint64_t>(bytes) * kSymbolsPerByte * bit_time_ns_ / 1000U) +
+               reset_us_;
+    }
+
+    /**
+     * @brief Encode @p count bytes (no reset symbol).
+     * @param bytes Data in wire order
+     * @param count Number of bytes
+     * @param symbols Output, count * kSymbolsPerByte words
+     * @return Symbols written
+     */
+    size_t Encode(const uint8_t* bytes, size_t count, uint32_t* symbols) const noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            std::memcpy(symbols + i * kSymbolsPerByte, lut_[bytes[i]].data(), sizeof(lut_[0]));
+        }
+        return count * kSymbolsPerByte;
+    }
+
+    /**
+     * @brief Bit-by-bit encoding; reference for the lookup table (tests, benchmarks).
+     * @return Symbols written (count * kSymbolsPerByte)
+     */
+    size_t EncodeBitwise(const uint8_t* bytes, size_t count, uint32_t* symbols) const noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t bit = 0; bit < kSymbolsPerByte; ++bit) {
+                *symbols++ = (bytes[i] & (0x80U >> bit)) ? one_ : zero_;
+            }
+        }
+        return count * kSymbolsPerByte;
+    }
+
+    /**
+     * @brief Encode the next part of a frame into a partially free symbol buffer.
+     *
+     * Follows the RMT simple-encoder contract: called repeatedly with the
+     * number of symbols already produced for this frame and the space now
+     * available. Only whole bytes are written; when fewer than
+     * kSymbolsPerByte symbols fit, 0 is returned and the caller retries with
+     * more space. The reset symbol follows the last byte.
+     *
+     * @param bytes Whole frame, wire order
+     * @param size Frame length in bytes
+     * @param symbols_written Symbols produced by earlier calls for this frame
+     * @param symbols_free Room in @p symbols
+     * @param symbols Output
+     * @param done Set once the reset symbol has been written
+     * @return Symbols written by this call
+     */
+    size_t EncodeChunk(const uint8_t* bytes, size_t size, size_t symbols_written, size_t symbols_free,
+                       uint32_t* symbols, bool& done) const noexcept {
+        done = false;
+        const size_t next_byte = symbols_written / kSymbolsPerByte;
+        size_t written = 0;
+        if (next_byte < size) {
+            size_t count = size - next_byte;
+            if (count > symbols_free / kSymbolsPerByte) {
+                count = symbols_free / kSymbolsPerByte;
+            }
+            written = Encode(bytes + next_byte, count, symbols);
+            if (next_byte + count < size) {
+                return written;
+            }
+        }
+        if (written < symbols_free) {
+            symbols[written++] = reset_;
+            done = true;
+        }
+        return written;
+    }
+
+private:
+    std::array<std::array<uint32_t, kSymbolsPerByte>, 256> lut_{};  ///< Symbols of every byte value
+    uint32_t zero_ = 0;             ///< 0-bit symbol
+    uint32_t one_ = 0;              ///< 1-bit symbol
+    uint32_t reset_ = 0;            ///< Latch symbol
+    uint32_t bit_time_ns_ = 0;      ///< Average bit period
+    uint32_t reset_us_ = 0;         ///< Latch time
+    bool configured_ = false;       ///< Table built
+};
+
+#endif  // COMPONENT_HANDLER_WS2812_SYMBOL_ENCODER_H_